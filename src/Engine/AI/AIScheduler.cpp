@@ -0,0 +1,182 @@
+#include "AIScheduler.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Destiny {
+
+AIScheduler::AIScheduler(const AISchedulerConfig& config)
+    : m_Config(config) {
+}
+
+AITaskHandle AIScheduler::Register(const AITaskDesc& desc) {
+    Task task;
+    task.func = desc.func;
+    task.handle = m_NextHandle++;
+    task.priority = std::max(desc.priority, 1u);
+    task.interval = std::max(desc.interval, 1u);
+    task.maxDeferTicks = desc.maxDeferTicks;
+    task.costUs = desc.costUs;
+    if (m_HasTicked)
+        Anchor(task, m_CurrentTick);
+
+    // Durante Update no se toca m_Tasks: la tarea en curso vive ahí
+    if (m_Updating)
+        m_PendingTasks.push_back(std::move(task));
+    else
+        m_Tasks.push_back(std::move(task));
+
+    m_ActiveCount++;
+    return m_NextHandle - 1;
+}
+
+void AIScheduler::Unregister(AITaskHandle handle) {
+    Task* task = Find(handle);
+    if (!task || !task->active)
+        return;
+
+    // Se borra al final del próximo Update: puede ser la tarea que se está ejecutando
+    task->active = false;
+    m_ActiveCount--;
+}
+
+void AIScheduler::Wake(AITaskHandle handle) {
+    Task* task = Find(handle);
+    if (!task || !task->active)
+        return;
+
+    // Vencida ya; la urgencia sigue siendo la de su prioridad
+    if (task->anchored && m_CurrentTick - task->lastRun < task->interval)
+        task->lastRun = m_CurrentTick - task->interval;
+}
+
+void AIScheduler::Update(uint32_t tick) {
+    auto start = std::chrono::high_resolution_clock::now();
+    m_CurrentTick = tick;
+    m_HasTicked = true;
+    m_Updating = true;
+
+    // Candidatas: vencidas, de más a menos urgente. Las forzadas van delante
+    m_Candidates.clear();
+    for (uint32_t i = 0; i < m_Tasks.size(); i++) {
+        Task& task = m_Tasks[i];
+        if (!task.active)
+            continue;
+        if (!task.anchored)
+            Anchor(task, tick);
+
+        uint32_t elapsed = tick - task.lastRun;
+        if (elapsed < task.interval)
+            continue;
+
+        uint32_t late = elapsed - task.interval;
+        Candidate candidate;
+        candidate.urgency = static_cast<uint64_t>(late + 1) * task.priority;
+        candidate.handle = task.handle;
+        candidate.index = i;
+        candidate.forced = late >= task.maxDeferTicks;
+        m_Candidates.push_back(candidate);
+    }
+
+    std::sort(m_Candidates.begin(), m_Candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.forced != b.forced)
+            return a.forced;
+        if (a.urgency != b.urgency)
+            return a.urgency > b.urgency;
+        return a.handle < b.handle;
+    });
+
+    Stats& stats = m_Stats;
+    stats.dueTasks = static_cast<uint32_t>(m_Candidates.size());
+    stats.tasksRun = 0;
+    stats.forcedRuns = 0;
+    stats.estimatedUs = 0;
+    stats.maxLatencyTicks = 0;
+    uint64_t latencySum = 0;
+    float spentUs = 0.0f;
+
+    for (const Candidate& candidate : m_Candidates) {
+        Task& task = m_Tasks[candidate.index];
+        if (!task.active)
+            continue;       // La quitó otra tarea de este tick
+
+        // Se comprueba antes de ejecutar: la última tarea puede pasarse del presupuesto
+        if (!candidate.forced && spentUs >= static_cast<float>(m_Config.budgetUs))
+            break;
+
+        uint32_t elapsed = tick - task.lastRun;
+        uint32_t late = elapsed - task.interval;
+        task.lastRun = tick;
+
+        task.func(tick, elapsed);
+
+        stats.tasksRun++;
+        stats.forcedRuns += candidate.forced ? 1 : 0;
+        stats.estimatedUs += task.costUs;
+        stats.maxLatencyTicks = std::max(stats.maxLatencyTicks, late);
+        latencySum += late;
+
+        if (m_Config.deterministic) {
+            spentUs = static_cast<float>(stats.estimatedUs);
+        }
+        else {
+            auto now = std::chrono::high_resolution_clock::now();
+            spentUs = std::chrono::duration<float, std::micro>(now - start).count();
+        }
+    }
+
+    m_Updating = false;
+
+    // Quitar las tareas dadas de baja y meter las registradas durante el tick
+    m_Tasks.erase(std::remove_if(m_Tasks.begin(), m_Tasks.end(), [](const Task& task) { return !task.active; }),
+                  m_Tasks.end());
+    for (Task& task : m_PendingTasks) {
+        if (task.active)
+            m_Tasks.push_back(std::move(task));
+    }
+    m_PendingTasks.clear();
+
+    auto end = std::chrono::high_resolution_clock::now();
+    stats.elapsedUs = std::chrono::duration<float, std::micro>(end - start).count();
+    stats.tasksDeferred = stats.dueTasks - stats.tasksRun;
+    stats.meanLatencyTicks = stats.tasksRun ? static_cast<float>(latencySum) / stats.tasksRun : 0.0f;
+    stats.overBudget = stats.elapsedUs > static_cast<float>(m_Config.budgetUs);
+
+    stats.totalRuns += stats.tasksRun;
+    stats.totalDeferrals += stats.tasksDeferred;
+    stats.totalForcedRuns += stats.forcedRuns;
+    stats.overrunTicks += stats.overBudget ? 1 : 0;
+    stats.maxElapsedUs = std::max(stats.maxElapsedUs, stats.elapsedUs);
+    stats.worstLatencyTicks = std::max(stats.worstLatencyTicks, stats.maxLatencyTicks);
+}
+
+void AIScheduler::LogStats() const {
+    DESTINY_CORE_INFO("IA: {0} tareas, {1} ejecuciones, {2} aplazamientos, {3} forzadas",
+                      m_ActiveCount, m_Stats.totalRuns, m_Stats.totalDeferrals, m_Stats.totalForcedRuns);
+    DESTINY_CORE_INFO("IA: {0} ticks sobre el presupuesto de {1} us, máx {2} us, peor retraso {3} ticks",
+                      m_Stats.overrunTicks, m_Config.budgetUs, m_Stats.maxElapsedUs, m_Stats.worstLatencyTicks);
+}
+
+AIScheduler::Task* AIScheduler::Find(AITaskHandle handle) {
+    // Los handles crecen, así que ambas listas están ordenadas por handle
+    auto byHandle = [](const Task& task, AITaskHandle value) { return task.handle < value; };
+
+    auto it = std::lower_bound(m_Tasks.begin(), m_Tasks.end(), handle, byHandle);
+    if (it != m_Tasks.end() && it->handle == handle)
+        return &*it;
+
+    it = std::lower_bound(m_PendingTasks.begin(), m_PendingTasks.end(), handle, byHandle);
+    if (it != m_PendingTasks.end() && it->handle == handle)
+        return &*it;
+
+    return nullptr;
+}
+
+void AIScheduler::Anchor(Task& task, uint32_t tick) const {
+    // Escalonar por handle dentro del intervalo: vence entre tick + 1 y tick + interval
+    task.lastRun = tick - task.handle % task.interval;
+    task.anchored = true;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Destiny {
+
+// tick: el de la simulación; elapsedTicks: ticks desde la ejecución anterior
+using AITaskFunc = std::function<void(uint32_t tick, uint32_t elapsedTicks)>;
+using AITaskHandle = uint32_t;
+
+struct AITaskDesc {
+    AITaskFunc func;
+    uint32_t priority = 1;          // Peso: con el mismo retraso pasa antes la de más peso
+    uint32_t interval = 1;          // Ticks deseados entre ejecuciones
+    uint32_t maxDeferTicks = 30;    // Retraso sobre interval a partir del cual se ejecuta sin mirar el presupuesto
+    uint32_t costUs = 50;           // Coste estimado; es lo que gasta del presupuesto en modo determinista
+};
+
+struct AISchedulerConfig {
+    uint32_t budgetUs = 2000;       // Por tick
+    // En lockstep qué tareas corren no puede depender del reloj de cada máquina:
+    // el presupuesto se gasta con los costUs declarados y el reloj sólo se mide.
+    // Sin él se corta cuando el tiempo medido pasa del presupuesto.
+    bool deterministic = true;
+};
+
+// Planificador de IA repartida en varios ticks (elección de objetivos, planes de
+// construcción, tácticas de escuadra). Cada tick se ordenan las tareas que ya
+// tocan por urgencia (ticks de espera por prioridad, desempate por handle) y se
+// ejecutan hasta agotar el presupuesto en microsegundos; el resto se aplaza al
+// tick siguiente, donde llega con más urgencia. Las que superan maxDeferTicks de
+// retraso se ejecutan siempre para que ninguna se quede sin turno.
+//
+// Las tareas nuevas se escalonan por handle dentro de su intervalo para que mil
+// unidades registradas a la vez no caigan en el mismo tick. Con deterministic el
+// orden y la selección sólo dependen de los ticks y de las tareas registradas,
+// así que todos los jugadores ejecutan lo mismo.
+class AIScheduler {
+public:
+    explicit AIScheduler(const AISchedulerConfig& config = AISchedulerConfig());
+    ~AIScheduler() = default;
+
+    // No permitir copia
+    AIScheduler(const AIScheduler&) = delete;
+    AIScheduler& operator=(const AIScheduler&) = delete;
+
+    // Se pueden llamar desde una tarea; la nueva no corre hasta el tick siguiente
+    AITaskHandle Register(const AITaskDesc& desc);
+    void Unregister(AITaskHandle handle);
+
+    // Pedir que la tarea corra cuanto antes (p. ej. la unidad ha perdido su objetivo)
+    void Wake(AITaskHandle handle);
+
+    // Una vez por tick de simulación, con el número de tick (el de LockstepSession)
+    void Update(uint32_t tick);
+
+    void SetBudget(uint32_t budgetUs) { m_Config.budgetUs = budgetUs; }
+    const AISchedulerConfig& GetConfig() const { return m_Config; }
+    uint32_t GetTaskCount() const { return m_ActiveCount; }
+
+    struct Stats {
+        // Último tick
+        uint32_t dueTasks = 0;          // Tareas a las que les tocaba
+        uint32_t tasksRun = 0;
+        uint32_t tasksDeferred = 0;     // Les tocaba y pasan al tick siguiente
+        uint32_t forcedRuns = 0;        // Por maxDeferTicks, fuera de presupuesto
+        uint32_t estimatedUs = 0;       // Suma de costUs de lo ejecutado
+        float elapsedUs = 0.0f;         // Medido
+        float meanLatencyTicks = 0.0f;  // Retraso medio sobre interval de lo ejecutado
+        uint32_t maxLatencyTicks = 0;
+        bool overBudget = false;        // elapsedUs > budgetUs
+
+        // Acumulado desde el inicio
+        uint64_t totalRuns = 0;
+        uint64_t totalDeferrals = 0;
+        uint64_t totalForcedRuns = 0;
+        uint32_t overrunTicks = 0;
+        float maxElapsedUs = 0.0f;
+        uint32_t worstLatencyTicks = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+    void LogStats() const;
+
+private:
+    struct Task {
+        AITaskFunc func;
+        AITaskHandle handle = 0;
+        uint32_t priority = 1;
+        uint32_t interval = 1;
+        uint32_t maxDeferTicks = 0;
+        uint32_t costUs = 0;
+        uint32_t lastRun = 0;           // Tick de la última ejecución (o el de referencia al registrarla)
+        bool anchored = false;          // lastRun ya apunta a un tick real
+        bool active = true;
+    };
+
+    // Candidata del tick: urgencia y posición en m_Tasks
+    struct Candidate {
+        uint64_t urgency;
+        AITaskHandle handle;
+        uint32_t index;
+        bool forced;
+    };
+
+    Task* Find(AITaskHandle handle);
+    void Anchor(Task& task, uint32_t tick) const;
+
+    AISchedulerConfig m_Config;
+    std::vector<Task> m_Tasks;          // Ordenadas por handle
+    std::vector<Task> m_PendingTasks;   // Registradas durante Update; entran al terminar
+    std::vector<Candidate> m_Candidates;
+    AITaskHandle m_NextHandle = 1;
+    uint32_t m_ActiveCount = 0;
+    uint32_t m_CurrentTick = 0;
+    bool m_HasTicked = false;
+    bool m_Updating = false;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
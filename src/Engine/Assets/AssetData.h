@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+namespace Destiny {
+
+// Vista de sólo lectura sobre el contenido de un asset.
+// Para entradas sin comprimir de un paquete apunta directamente a la región
+// proyectada; m_Owner mantiene vivo el paquete o el buffer que respalda los bytes.
+class AssetData {
+public:
+    AssetData() = default;
+    AssetData(const uint8_t* data, size_t size, std::shared_ptr<const void> owner)
+        : m_Data(data), m_Size(size), m_Owner(std::move(owner)) {
+    }
+
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    bool IsValid() const { return m_Data != nullptr; }
+
+    std::string_view AsString() const {
+        return std::string_view(reinterpret_cast<const char*>(m_Data), m_Size);
+    }
+
+private:
+    const uint8_t* m_Data = nullptr;
+    size_t m_Size = 0;
+    std::shared_ptr<const void> m_Owner;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "AssetPack.h"
+#include "LZ4.h"
+#include "../Core/Log.h"
+
+#include <cstring>
+
+namespace Destiny {
+
+AssetPack::AssetPack(const std::string& path)
+    : m_Path(path) {
+    if (!m_File.Open(path)) {
+        DESTINY_CORE_ERROR("No se pudo abrir el paquete de assets: {0}", path);
+        return;
+    }
+
+    if (!ParseTableOfContents()) {
+        DESTINY_CORE_ERROR("Paquete de assets inválido: {0}", path);
+        m_File.Close();
+        return;
+    }
+
+    m_Valid = true;
+    DESTINY_CORE_INFO("Paquete montado: {0} ({1} entradas, {2} bytes)", path, m_EntryCount, m_File.GetSize());
+}
+
+bool AssetPack::ParseTableOfContents() {
+    const uint8_t* base = m_File.GetData();
+    size_t fileSize = m_File.GetSize();
+
+    if (fileSize < sizeof(PackHeader))
+        return false;
+
+    // La cabecera está al inicio de la proyección, que siempre está alineada a página
+    const PackHeader* header = reinterpret_cast<const PackHeader*>(base);
+    if (std::memcmp(header->magic, PackMagic, sizeof(PackMagic)) != 0)
+        return false;
+    if (header->version != PackVersion) {
+        DESTINY_CORE_ERROR("Versión de paquete no soportada: {0}", header->version);
+        return false;
+    }
+
+    // Los límites se comprueban restando para que un offset enorme no desborde la suma
+    uint64_t tocSize = static_cast<uint64_t>(header->entryCount) * sizeof(PackEntry);
+    if (header->tocOffset % alignof(PackEntry) != 0 || header->tocOffset > fileSize || tocSize > fileSize - header->tocOffset)
+        return false;
+    if (header->stringTableOffset > fileSize || header->stringTableSize > fileSize - header->stringTableOffset)
+        return false;
+
+    m_Entries = reinterpret_cast<const PackEntry*>(base + header->tocOffset);
+    m_Strings = reinterpret_cast<const char*>(base + header->stringTableOffset);
+    m_EntryCount = header->entryCount;
+
+    // Validar la tabla una sola vez para que Read no tenga que comprobar límites
+    for (uint32_t i = 0; i < m_EntryCount; i++) {
+        const PackEntry& entry = m_Entries[i];
+        if (entry.offset > fileSize || entry.storedSize > fileSize - entry.offset)
+            return false;
+        if (static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > header->stringTableSize)
+            return false;
+        if (!(entry.flags & PackEntryLZ4) && entry.storedSize != entry.size)
+            return false;
+        if (i > 0 && m_Entries[i - 1].pathHash > entry.pathHash)
+            return false;
+    }
+
+    return true;
+}
+
+const PackEntry* AssetPack::FindEntry(const std::string& path) const {
+    if (!m_Valid)
+        return nullptr;
+
+    std::string normalized = NormalizeAssetPath(path);
+    uint64_t hash = HashAssetPath(normalized);
+
+    // Búsqueda binaria por hash y comparación de la ruta para descartar colisiones
+    uint32_t low = 0, high = m_EntryCount;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        if (m_Entries[mid].pathHash < hash)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    for (uint32_t i = low; i < m_EntryCount && m_Entries[i].pathHash == hash; i++) {
+        const PackEntry& entry = m_Entries[i];
+        if (normalized.compare(0, std::string::npos, m_Strings + entry.pathOffset, entry.pathLength) == 0)
+            return &entry;
+    }
+
+    return nullptr;
+}
+
+bool AssetPack::Contains(const std::string& path) const {
+    return FindEntry(path) != nullptr;
+}
+
+AssetData AssetPack::Read(const std::string& path) {
+    const PackEntry* entry = FindEntry(path);
+    if (!entry)
+        return {};
+
+    const uint8_t* stored = m_File.GetData() + entry->offset;
+
+    if (!(entry->flags & PackEntryLZ4))
+        return AssetData(stored, static_cast<size_t>(entry->size), shared_from_this());
+
+    size_t index = static_cast<size_t>(entry - m_Entries);
+    std::lock_guard<std::mutex> lock(m_CacheMutex);
+
+    auto it = m_Decompressed.find(index);
+    if (it == m_Decompressed.end()) {
+        auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(entry->size));
+        if (!LZ4::Decompress(stored, static_cast<size_t>(entry->storedSize), buffer->data(), buffer->size())) {
+            DESTINY_CORE_ERROR("Entrada LZ4 corrupta en {0}: {1}", m_Path, path);
+            return {};
+        }
+        it = m_Decompressed.emplace(index, std::move(buffer)).first;
+    }
+
+    return AssetData(it->second->data(), it->second->size(), it->second);
+}
+
+} // namespace Destiny
\ No newline at end of file
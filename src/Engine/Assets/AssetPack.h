@@ -0,0 +1,53 @@
+#pragma once
+
+#include "AssetData.h"
+#include "AssetPackFormat.h"
+#include "MappedFile.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Destiny {
+
+// Paquete .pak proyectado en memoria; se crea con std::make_shared
+class AssetPack : public std::enable_shared_from_this<AssetPack> {
+public:
+    AssetPack(const std::string& path);
+    ~AssetPack() = default;
+
+    // No permitir copia
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    bool IsValid() const { return m_Valid; }
+
+    // Sin copia para entradas sin comprimir; las comprimidas se descomprimen una vez
+    AssetData Read(const std::string& path);
+    bool Contains(const std::string& path) const;
+
+    // Información
+    const std::string& GetPath() const { return m_Path; }
+    uint32_t GetEntryCount() const { return m_EntryCount; }
+    size_t GetMappedSize() const { return m_File.GetSize(); }
+
+private:
+    bool ParseTableOfContents();
+    const PackEntry* FindEntry(const std::string& path) const;
+
+    std::string m_Path;
+    MappedFile m_File;
+
+    const PackEntry* m_Entries = nullptr;
+    const char* m_Strings = nullptr;
+    uint32_t m_EntryCount = 0;
+    bool m_Valid = false;
+
+    // Entradas LZ4 ya descomprimidas, por índice en la tabla
+    std::mutex m_CacheMutex;
+    std::unordered_map<size_t, std::shared_ptr<std::vector<uint8_t>>> m_Decompressed;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Destiny {
+
+// Formato binario de los paquetes de assets (.pak), compartido por el motor y AssetPacker.
+//
+//   PackHeader
+//   PackEntry[entryCount]      ordenadas por pathHash para búsqueda binaria
+//   tabla de strings           rutas normalizadas, sin terminador
+//   blobs                      cada uno alineado a PackDataAlignment
+//
+// Todos los enteros están en little-endian y las estructuras no tienen relleno.
+
+static constexpr char PackMagic[4] = { 'D', 'P', 'A', 'K' };
+static constexpr uint32_t PackVersion = 1;
+static constexpr uint64_t PackDataAlignment = 64;
+
+enum PackEntryFlags : uint32_t {
+    PackEntryNone = 0,
+    PackEntryLZ4  = (1 << 0)   // Blob comprimido en formato de bloque LZ4
+};
+
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t stringTableSize;
+    uint64_t tocOffset;
+    uint64_t stringTableOffset;
+};
+
+struct PackEntry {
+    uint64_t pathHash;
+    uint64_t offset;       // Desde el inicio del archivo
+    uint64_t size;         // Tamaño descomprimido
+    uint64_t storedSize;   // Tamaño en el archivo
+    uint32_t pathOffset;   // Dentro de la tabla de strings
+    uint32_t pathLength;
+    uint32_t flags;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(PackHeader) == 32, "PackHeader debe ocupar 32 bytes");
+static_assert(sizeof(PackEntry) == 48, "PackEntry debe ocupar 48 bytes");
+
+// Rutas en minúsculas, con '/' y sin "./" inicial, para que "Shaders\Quad.vert"
+// y "shaders/quad.vert" encuentren la misma entrada
+inline std::string NormalizeAssetPath(const std::string& path) {
+    std::string result;
+    result.reserve(path.size());
+
+    size_t start = 0;
+    while (path.compare(start, 2, "./") == 0 || path.compare(start, 2, ".\\") == 0)
+        start += 2;
+
+    for (size_t i = start; i < path.size(); i++) {
+        char c = path[i];
+        if (c == '\\')
+            c = '/';
+        else if (c >= 'A' && c <= 'Z')
+            c = static_cast<char>(c - 'A' + 'a');
+        result.push_back(c);
+    }
+    return result;
+}
+
+// FNV-1a de 64 bits sobre la ruta normalizada
+inline uint64_t HashAssetPath(const std::string& normalizedPath) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : normalizedPath) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace Destiny
\ No newline at end of file
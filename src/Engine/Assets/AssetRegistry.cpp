@@ -0,0 +1,297 @@
+#include "AssetRegistry.h"
+#include "AssetPackFormat.h"
+#include "../Core/Log.h"
+#include "../Graphics/Shader.h"
+#include "../Graphics/Texture.h"
+
+#include <GL/glew.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace Destiny {
+
+AssetRegistry* AssetRegistry::s_Instance = nullptr;
+
+static const char* AssetTypeName(AssetType type) {
+    switch (type) {
+        case AssetType::Texture: return "Texturas";
+        case AssetType::Shader:  return "Shaders";
+        default:                 return "Desconocido";
+    }
+}
+
+AssetRegistry::AssetRegistry(size_t textureBudget)
+    : m_TextureBudget(textureBudget) {
+    s_Instance = this;
+}
+
+AssetRegistry::~AssetRegistry() {
+    // Los recursos de OpenGL se liberan aquí, antes de destruir el contexto
+    m_Textures.clear();
+    m_Shaders.clear();
+
+    if (s_Instance == this)
+        s_Instance = nullptr;
+}
+
+TextureHandle AssetRegistry::AcquireTexture(const std::string& path) {
+    std::string key = NormalizeAssetPath(path);
+
+    auto it = m_TextureLookup.find(key);
+    if (it != m_TextureLookup.end()) {
+        TextureSlot& slot = m_Textures[it->second];
+        slot.refCount++;
+        return { it->second, slot.generation };
+    }
+
+    uint32_t index;
+    if (!m_FreeTextureSlots.empty()) {
+        index = m_FreeTextureSlots.back();
+        m_FreeTextureSlots.pop_back();
+    }
+    else {
+        index = static_cast<uint32_t>(m_Textures.size());
+        m_Textures.emplace_back();
+    }
+
+    TextureSlot& slot = m_Textures[index];
+    slot.path = path;
+    slot.refCount = 1;
+    m_TextureLookup[key] = index;
+    m_Stats[static_cast<size_t>(AssetType::Texture)].assetCount++;
+
+    LoadTexture(slot);
+    return { index, slot.generation };
+}
+
+ShaderHandle AssetRegistry::AcquireShader(const std::string& vertexPath, const std::string& fragmentPath) {
+    std::string key = NormalizeAssetPath(vertexPath) + "|" + NormalizeAssetPath(fragmentPath);
+
+    auto it = m_ShaderLookup.find(key);
+    if (it != m_ShaderLookup.end()) {
+        ShaderSlot& slot = m_Shaders[it->second];
+        slot.refCount++;
+        return { it->second, slot.generation };
+    }
+
+    std::unique_ptr<Shader> shader;
+    try {
+        shader = std::make_unique<Shader>(vertexPath, fragmentPath);
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_ERROR("No se pudo crear el shader {0}: {1}", key, e.what());
+        return {};
+    }
+
+    uint32_t index;
+    if (!m_FreeShaderSlots.empty()) {
+        index = m_FreeShaderSlots.back();
+        m_FreeShaderSlots.pop_back();
+    }
+    else {
+        index = static_cast<uint32_t>(m_Shaders.size());
+        m_Shaders.emplace_back();
+    }
+
+    ShaderSlot& slot = m_Shaders[index];
+    slot.key = key;
+    slot.shader = std::move(shader);
+    slot.memorySize = EstimateShaderMemory(*slot.shader);
+    slot.refCount = 1;
+    m_ShaderLookup[key] = index;
+
+    TypeStats& stats = m_Stats[static_cast<size_t>(AssetType::Shader)];
+    stats.assetCount++;
+    stats.loadedCount++;
+    stats.memoryBytes += slot.memorySize;
+
+    return { index, slot.generation };
+}
+
+void AssetRegistry::Release(TextureHandle handle) {
+    TextureSlot* slot = ResolveTexture(handle);
+    if (!slot || --slot->refCount > 0)
+        return;
+
+    UnloadTexture(*slot);
+    m_TextureLookup.erase(NormalizeAssetPath(slot->path));
+    slot->path.clear();
+    slot->generation++;
+    m_FreeTextureSlots.push_back(handle.index);
+    m_Stats[static_cast<size_t>(AssetType::Texture)].assetCount--;
+}
+
+void AssetRegistry::Release(ShaderHandle handle) {
+    if (handle.index >= m_Shaders.size())
+        return;
+
+    ShaderSlot& slot = m_Shaders[handle.index];
+    if (slot.generation != handle.generation || slot.refCount == 0 || --slot.refCount > 0)
+        return;
+
+    TypeStats& stats = m_Stats[static_cast<size_t>(AssetType::Shader)];
+    stats.assetCount--;
+    stats.loadedCount--;
+    stats.memoryBytes -= slot.memorySize;
+
+    m_ShaderLookup.erase(slot.key);
+    slot.shader.reset();
+    slot.memorySize = 0;
+    slot.key.clear();
+    slot.generation++;
+    m_FreeShaderSlots.push_back(handle.index);
+}
+
+std::shared_ptr<Texture> AssetRegistry::GetTexture(TextureHandle handle) {
+    TextureSlot* slot = ResolveTexture(handle);
+    if (!slot)
+        return nullptr;
+
+    // Recarga transparente de una textura expulsada
+    if (!slot->texture) {
+        LoadTexture(*slot);
+        m_Stats[static_cast<size_t>(AssetType::Texture)].reloads++;
+    }
+
+    slot->lastUsedFrame = m_Frame;
+    return slot->texture;
+}
+
+Shader* AssetRegistry::GetShader(ShaderHandle handle) const {
+    if (handle.index >= m_Shaders.size())
+        return nullptr;
+
+    const ShaderSlot& slot = m_Shaders[handle.index];
+    return slot.generation == handle.generation ? slot.shader.get() : nullptr;
+}
+
+size_t AssetRegistry::GetMemoryBytes(TextureHandle handle) const {
+    if (handle.index >= m_Textures.size())
+        return 0;
+
+    const TextureSlot& slot = m_Textures[handle.index];
+    if (slot.generation != handle.generation || slot.refCount == 0)
+        return 0;
+
+    // Una textura expulsada no ocupa VRAM hasta que se recargue
+    return slot.texture ? slot.memorySize : 0;
+}
+
+size_t AssetRegistry::GetMemoryBytes(ShaderHandle handle) const {
+    if (handle.index >= m_Shaders.size())
+        return 0;
+
+    const ShaderSlot& slot = m_Shaders[handle.index];
+    return slot.generation == handle.generation ? slot.memorySize : 0;
+}
+
+void AssetRegistry::NewFrame() {
+    m_Frame++;
+
+    // Reintentar si en frames anteriores no se pudo expulsar nada
+    EnforceTextureBudget(nullptr);
+}
+
+void AssetRegistry::SetTextureBudget(size_t bytes) {
+    m_TextureBudget = bytes;
+    m_OverBudgetWarned = false;
+    EnforceTextureBudget(nullptr);
+}
+
+void AssetRegistry::LogStats() const {
+    for (size_t i = 0; i < static_cast<size_t>(AssetType::Count); i++) {
+        const TypeStats& stats = m_Stats[i];
+        DESTINY_CORE_INFO("{0}: {1} assets, {2} residentes, {3} KB, {4} expulsiones, {5} recargas",
+                          AssetTypeName(static_cast<AssetType>(i)), stats.assetCount, stats.loadedCount,
+                          stats.memoryBytes / 1024, stats.evictions, stats.reloads);
+    }
+}
+
+AssetRegistry::TextureSlot* AssetRegistry::ResolveTexture(TextureHandle handle) {
+    if (handle.index >= m_Textures.size())
+        return nullptr;
+
+    TextureSlot& slot = m_Textures[handle.index];
+    if (slot.generation != handle.generation || slot.refCount == 0)
+        return nullptr;
+
+    return &slot;
+}
+
+void AssetRegistry::LoadTexture(TextureSlot& slot) {
+    slot.texture = std::make_shared<Texture>(slot.path);
+    slot.memorySize = EstimateTextureMemory(*slot.texture);
+    slot.lastUsedFrame = m_Frame;
+
+    TypeStats& stats = m_Stats[static_cast<size_t>(AssetType::Texture)];
+    stats.loadedCount++;
+    stats.memoryBytes += slot.memorySize;
+
+    EnforceTextureBudget(&slot);
+}
+
+void AssetRegistry::UnloadTexture(TextureSlot& slot) {
+    if (!slot.texture)
+        return;
+
+    TypeStats& stats = m_Stats[static_cast<size_t>(AssetType::Texture)];
+    stats.loadedCount--;
+    stats.memoryBytes -= slot.memorySize;
+
+    slot.texture.reset();
+    slot.memorySize = 0;
+}
+
+void AssetRegistry::EnforceTextureBudget(const TextureSlot* keep) {
+    TypeStats& stats = m_Stats[static_cast<size_t>(AssetType::Texture)];
+
+    while (m_TextureBudget != 0 && stats.memoryBytes > m_TextureBudget) {
+        // Candidata: la menos usada recientemente que nadie retiene fuera del registro
+        // y que no se ha usado en este frame (puede estar en un batch pendiente)
+        TextureSlot* victim = nullptr;
+        uint64_t oldest = std::numeric_limits<uint64_t>::max();
+
+        for (TextureSlot& slot : m_Textures) {
+            if (&slot == keep || !slot.texture || slot.lastUsedFrame >= m_Frame)
+                continue;
+            if (slot.texture.use_count() > 1)
+                continue;
+            if (slot.lastUsedFrame < oldest) {
+                oldest = slot.lastUsedFrame;
+                victim = &slot;
+            }
+        }
+
+        if (!victim) {
+            if (!m_OverBudgetWarned) {
+                DESTINY_CORE_WARN("Presupuesto de VRAM superado ({0} KB de {1} KB) sin texturas expulsables",
+                                  stats.memoryBytes / 1024, m_TextureBudget / 1024);
+                m_OverBudgetWarned = true;
+            }
+            return;
+        }
+
+        UnloadTexture(*victim);
+        stats.evictions++;
+    }
+
+    m_OverBudgetWarned = false;
+}
+
+size_t AssetRegistry::EstimateTextureMemory(const Texture& texture) {
+    // Los drivers guardan RGB8 con 4 bytes por píxel; no generamos mipmaps
+    return static_cast<size_t>(texture.GetWidth()) * texture.GetHeight() * 4;
+}
+
+size_t AssetRegistry::EstimateShaderMemory(const Shader& shader) {
+    // Tamaño del binario enlazado que guarda el driver; sin GL 4.1 no hay forma de consultarlo
+    if (!GLEW_VERSION_4_1 || shader.GetRendererID() == 0)
+        return 0;
+
+    GLint length = 0;
+    glGetProgramiv(shader.GetRendererID(), GL_PROGRAM_BINARY_LENGTH, &length);
+    return length > 0 ? static_cast<size_t>(length) : 0;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Destiny {
+
+class Shader;
+class Texture;
+
+// Tipos de asset gestionados por el registro
+enum class AssetType {
+    Texture = 0,
+    Shader,
+    Count
+};
+
+// Handle generacional: index apunta a un slot y generation detecta slots reutilizados
+template<typename T>
+struct AssetHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;   // 0 = handle inválido
+
+    bool IsValid() const { return generation != 0; }
+    bool operator==(const AssetHandle& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const AssetHandle& other) const { return !(*this == other); }
+};
+
+using TextureHandle = AssetHandle<Texture>;
+using ShaderHandle = AssetHandle<Shader>;
+
+// Registro de assets: deduplica cargas por ruta, cuenta referencias y mantiene
+// las texturas dentro de un presupuesto de VRAM expulsando las menos usadas.
+// Las texturas expulsadas se recargan al pedirlas de nuevo con GetTexture.
+// Debe usarse desde el hilo que posee el contexto de OpenGL.
+class AssetRegistry {
+public:
+    // textureBudget en bytes; 0 = sin límite
+    AssetRegistry(size_t textureBudget = 0);
+    ~AssetRegistry();
+
+    // No permitir copia
+    AssetRegistry(const AssetRegistry&) = delete;
+    AssetRegistry& operator=(const AssetRegistry&) = delete;
+
+    // Cargar (o reutilizar) y sumar una referencia
+    TextureHandle AcquireTexture(const std::string& path);
+    ShaderHandle AcquireShader(const std::string& vertexPath, const std::string& fragmentPath);
+
+    // Quitar una referencia; con 0 referencias el asset se libera
+    void Release(TextureHandle handle);
+    void Release(ShaderHandle handle);
+
+    // Acceso; nullptr si el handle ya no es válido
+    std::shared_ptr<Texture> GetTexture(TextureHandle handle);
+    Shader* GetShader(ShaderHandle handle) const;
+
+    // VRAM estimada de un asset concreto; 0 si el handle no es válido o la textura está expulsada
+    size_t GetMemoryBytes(TextureHandle handle) const;
+    size_t GetMemoryBytes(ShaderHandle handle) const;
+
+    // Avanzar el reloj LRU (una vez por frame)
+    void NewFrame();
+
+    // Presupuesto de VRAM para texturas
+    void SetTextureBudget(size_t bytes);
+    size_t GetTextureBudget() const { return m_TextureBudget; }
+
+    // Estadísticas por tipo de asset
+    struct TypeStats {
+        uint32_t assetCount = 0;     // Slots vivos (con referencias)
+        uint32_t loadedCount = 0;    // Residentes en GPU
+        size_t memoryBytes = 0;      // VRAM estimada de los residentes
+        uint32_t evictions = 0;
+        uint32_t reloads = 0;
+    };
+
+    const TypeStats& GetStats(AssetType type) const { return m_Stats[static_cast<size_t>(type)]; }
+    void LogStats() const;
+
+    // Instancia global (la crea Engine). Los objetos que puedan sobrevivir al
+    // registro (p. ej. en su destructor) deben comprobar HasInstance antes de Get
+    static AssetRegistry& Get() { return *s_Instance; }
+    static bool HasInstance() { return s_Instance != nullptr; }
+
+private:
+    struct TextureSlot {
+        std::string path;
+        std::shared_ptr<Texture> texture;   // nullptr si está expulsada
+        size_t memorySize = 0;
+        uint32_t generation = 1;
+        uint32_t refCount = 0;
+        uint64_t lastUsedFrame = 0;
+    };
+
+    struct ShaderSlot {
+        std::string key;
+        std::unique_ptr<Shader> shader;
+        size_t memorySize = 0;
+        uint32_t generation = 1;
+        uint32_t refCount = 0;
+    };
+
+    TextureSlot* ResolveTexture(TextureHandle handle);
+    void LoadTexture(TextureSlot& slot);
+    void UnloadTexture(TextureSlot& slot);
+    void EnforceTextureBudget(const TextureSlot* keep);
+
+    static size_t EstimateTextureMemory(const Texture& texture);
+    static size_t EstimateShaderMemory(const Shader& shader);
+
+    std::vector<TextureSlot> m_Textures;
+    std::vector<uint32_t> m_FreeTextureSlots;
+    std::unordered_map<std::string, uint32_t> m_TextureLookup;
+
+    std::vector<ShaderSlot> m_Shaders;
+    std::vector<uint32_t> m_FreeShaderSlots;
+    std::unordered_map<std::string, uint32_t> m_ShaderLookup;
+
+    size_t m_TextureBudget = 0;
+    uint64_t m_Frame = 1;
+    bool m_OverBudgetWarned = false;
+    TypeStats m_Stats[static_cast<size_t>(AssetType::Count)];
+
+    static AssetRegistry* s_Instance;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "FileSystem.h"
+#include "AssetPack.h"
+#include "../Core/Log.h"
+
+#include <fstream>
+
+namespace Destiny {
+
+std::vector<std::shared_ptr<AssetPack>> FileSystem::s_Packs;
+std::mutex FileSystem::s_Mutex;
+
+bool FileSystem::Mount(const std::string& packPath) {
+    auto pack = std::make_shared<AssetPack>(packPath);
+    if (!pack->IsValid())
+        return false;
+
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Packs.push_back(std::move(pack));
+    return true;
+}
+
+void FileSystem::UnmountAll() {
+    // Los AssetData aún vivos mantienen su paquete proyectado hasta liberarse
+    std::lock_guard<std::mutex> lock(s_Mutex);
+    s_Packs.clear();
+}
+
+AssetData FileSystem::Read(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        for (auto it = s_Packs.rbegin(); it != s_Packs.rend(); ++it) {
+            AssetData data = (*it)->Read(path);
+            if (data.IsValid())
+                return data;
+        }
+    }
+
+    return ReadLooseFile(path);
+}
+
+bool FileSystem::Exists(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        for (const auto& pack : s_Packs) {
+            if (pack->Contains(path))
+                return true;
+        }
+    }
+
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    return static_cast<bool>(in);
+}
+
+AssetData FileSystem::ReadLooseFile(const std::string& path) {
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    if (!in)
+        return {};
+
+    in.seekg(0, std::ios::end);
+    auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(reinterpret_cast<char*>(buffer->data()), buffer->size());
+
+    // Un buffer vacío sigue siendo un archivo válido
+    static const uint8_t empty = 0;
+    const uint8_t* data = buffer->empty() ? &empty : buffer->data();
+    return AssetData(data, buffer->size(), buffer);
+}
+
+} // namespace Destiny
\ No newline at end of file
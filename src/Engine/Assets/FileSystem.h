@@ -0,0 +1,31 @@
+#pragma once
+
+#include "AssetData.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Destiny {
+
+class AssetPack;
+
+// Acceso a assets: primero los paquetes montados (el último montado tiene
+// prioridad) y, si no están ahí, archivos sueltos en disco para desarrollo
+class FileSystem {
+public:
+    static bool Mount(const std::string& packPath);
+    static void UnmountAll();
+
+    static AssetData Read(const std::string& path);
+    static bool Exists(const std::string& path);
+
+private:
+    static AssetData ReadLooseFile(const std::string& path);
+
+    static std::vector<std::shared_ptr<AssetPack>> s_Packs;
+    static std::mutex s_Mutex;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,174 @@
+#include "LZ4.h"
+
+#include <cstring>
+#include <vector>
+
+namespace Destiny {
+
+// Restricciones del formato de bloque
+static constexpr size_t MinMatch = 4;
+static constexpr size_t LastLiterals = 5;   // Los últimos 5 bytes siempre son literales
+static constexpr size_t MatchFindLimit = 12; // Un match no puede empezar en los últimos 12 bytes
+static constexpr size_t MaxOffset = 65535;
+static constexpr int HashBits = 14;
+
+static inline uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t HashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - HashBits);
+}
+
+// Escribe la extensión de una longitud >= 15 (bytes de 255 y un resto)
+static inline bool WriteLength(size_t length, uint8_t*& op, const uint8_t* dstEnd) {
+    while (length >= 255) {
+        if (op >= dstEnd)
+            return false;
+        *op++ = 255;
+        length -= 255;
+    }
+    if (op >= dstEnd)
+        return false;
+    *op++ = static_cast<uint8_t>(length);
+    return true;
+}
+
+static inline bool WriteSequence(const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength,
+                                 uint8_t*& op, const uint8_t* dstEnd) {
+    if (op >= dstEnd)
+        return false;
+
+    uint8_t* token = op++;
+    *token = static_cast<uint8_t>((literalLength >= 15 ? 15 : literalLength) << 4);
+    if (literalLength >= 15 && !WriteLength(literalLength - 15, op, dstEnd))
+        return false;
+
+    if (static_cast<size_t>(dstEnd - op) < literalLength)
+        return false;
+    std::memcpy(op, literals, literalLength);
+    op += literalLength;
+
+    // Secuencia final: sólo literales
+    if (matchLength == 0)
+        return true;
+
+    if (dstEnd - op < 2)
+        return false;
+    *op++ = static_cast<uint8_t>(offset & 0xff);
+    *op++ = static_cast<uint8_t>(offset >> 8);
+
+    size_t extra = matchLength - MinMatch;
+    *token |= static_cast<uint8_t>(extra >= 15 ? 15 : extra);
+    if (extra >= 15 && !WriteLength(extra - 15, op, dstEnd))
+        return false;
+
+    return true;
+}
+
+size_t LZ4::Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity) {
+    uint8_t* op = dst;
+    const uint8_t* dstEnd = dst + dstCapacity;
+    size_t anchor = 0;
+
+    if (srcSize > MatchFindLimit) {
+        std::vector<uint32_t> table(size_t(1) << HashBits, UINT32_MAX);
+        size_t matchStartLimit = srcSize - MatchFindLimit;
+        size_t matchEndLimit = srcSize - LastLiterals;
+
+        size_t ip = 0;
+        while (ip <= matchStartLimit) {
+            uint32_t sequence = Read32(src + ip);
+            uint32_t h = HashSequence(sequence);
+            uint32_t ref = table[h];
+            table[h] = static_cast<uint32_t>(ip);
+
+            if (ref == UINT32_MAX || ip - ref > MaxOffset || Read32(src + ref) != sequence) {
+                ip++;
+                continue;
+            }
+
+            size_t length = MinMatch;
+            while (ip + length < matchEndLimit && src[ref + length] == src[ip + length])
+                length++;
+
+            if (!WriteSequence(src + anchor, ip - anchor, ip - ref, length, op, dstEnd))
+                return 0;
+
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    if (!WriteSequence(src + anchor, srcSize - anchor, 0, 0, op, dstEnd))
+        return 0;
+
+    return static_cast<size_t>(op - dst);
+}
+
+bool LZ4::Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    const uint8_t* ip = src;
+    const uint8_t* srcEnd = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* dstEnd = dst + dstSize;
+
+    while (ip < srcEnd) {
+        uint8_t token = *ip++;
+
+        // Literales
+        size_t literalLength = token >> 4;
+        if (literalLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= srcEnd)
+                    return false;
+                b = *ip++;
+                literalLength += b;
+            } while (b == 255);
+        }
+
+        if (static_cast<size_t>(srcEnd - ip) < literalLength || static_cast<size_t>(dstEnd - op) < literalLength)
+            return false;
+        std::memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == srcEnd)
+            break;
+
+        // Match
+        if (srcEnd - ip < 2)
+            return false;
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst))
+            return false;
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15) {
+            uint8_t b;
+            do {
+                if (ip >= srcEnd)
+                    return false;
+                b = *ip++;
+                matchLength += b;
+            } while (b == 255);
+        }
+        matchLength += MinMatch;
+
+        if (static_cast<size_t>(dstEnd - op) < matchLength)
+            return false;
+
+        // Copia byte a byte: el match puede solaparse con la salida
+        const uint8_t* match = op - offset;
+        for (size_t i = 0; i < matchLength; i++)
+            op[i] = match[i];
+        op += matchLength;
+    }
+
+    return op == dstEnd;
+}
+
+} // namespace Destiny
\ No newline at end of file
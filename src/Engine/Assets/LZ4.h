@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Destiny {
+
+// Compresión en formato de bloque LZ4 (sin cabecera de frame).
+// El compresor es voraz y sencillo; el descompresor valida todos los límites
+// y es compatible con bloques generados por la biblioteca lz4 de referencia.
+class LZ4 {
+public:
+    // Tamaño máximo de salida de Compress para srcSize bytes
+    static size_t CompressBound(size_t srcSize) { return srcSize + srcSize / 255 + 16; }
+
+    // Devuelve los bytes escritos en dst, o 0 si no cabe en dstCapacity
+    static size_t Compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+
+    // dstSize es el tamaño descomprimido exacto; false si el bloque es inválido
+    static bool Decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Destiny {
+
+// Archivo de sólo lectura proyectado en memoria (mmap / MapViewOfFile)
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // No permitir copia
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+    bool IsOpen() const { return m_Data != nullptr; }
+
+private:
+    const uint8_t* m_Data = nullptr;
+    size_t m_Size = 0;
+
+#ifdef _WIN32
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+#endif
+};
+
+} // namespace Destiny
\ No newline at end of file
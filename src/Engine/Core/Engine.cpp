@@ -1,5 +1,8 @@
 #include "Engine.h"
 #include "Log.h"
+#include "../Assets/FileSystem.h"
+#include "../Events/ApplicationEvent.h"
+#include "../Graphics/DebugDraw.h"
 
 #include <GL/glew.h>  // GLEW primero
 #include <GLFW/glfw3.h>
@@ -28,6 +31,13 @@ Engine::~Engine() {
 bool Engine::Initialize() {
     DESTINY_CORE_INFO("Inicializando motor");
     
+    // Desde aquí Shutdown tiene algo que liberar aunque Initialize falle a medias
+    m_NeedsShutdown = true;
+    
+    // Montar assets empaquetados antes de crear recursos que los lean
+    if (!m_Config.assetPack.empty() && !FileSystem::Mount(m_Config.assetPack))
+        DESTINY_CORE_WARN("Usando archivos sueltos en lugar de {0}", m_Config.assetPack);
+    
     // Crear ventana
     m_Window = std::make_unique<Window>(m_Config.appName, m_Config.width, m_Config.height, m_Config.vsync);
     if (!m_Window->IsValid()) {
@@ -35,12 +45,50 @@ bool Engine::Initialize() {
         return false;
     }
     
+    // Registro de assets (necesita el contexto de OpenGL de la ventana)
+    m_AssetRegistry = std::make_unique<AssetRegistry>(m_Config.textureBudgetMB * 1024 * 1024);
+    
+    // Hilos de trabajo compartidos por los subsistemas
+    m_JobSystem = std::make_unique<JobSystem>();
+    
     // Inicializar renderer
-    m_Renderer = std::make_unique<Renderer>();
+    m_Renderer = std::make_unique<Renderer>(m_JobSystem.get());
     if (!m_Renderer->Initialize()) {
         DESTINY_CORE_ERROR("No se pudo inicializar el renderer");
         return false;
     }
+    if (!m_Config.gpuDriven && m_Renderer->IsGpuDrivenSupported())
+        m_Renderer->SetGpuDriven(false);
+    
+    if (m_Config.dynamicResolution) {
+        DynamicResolutionDesc resolution;
+        resolution.minScale = m_Config.minResolutionScale;
+        resolution.maxScale = m_Config.maxResolutionScale;
+        resolution.targetFrameMs = m_Config.targetFrameMs;
+        m_DynamicResolution = std::make_unique<DynamicResolution>(m_Window->GetWidth(), m_Window->GetHeight(), resolution);
+        if (!m_DynamicResolution->IsValid()) {
+            DESTINY_CORE_WARN("Resolución dinámica no disponible, se dibuja a resolución nativa");
+            m_DynamicResolution.reset();
+        }
+    }
+    
+    // Render targets temporales de las pasadas del frame
+    m_RenderTargetPool = std::make_unique<RenderTargetPool>(m_Window->GetWidth(), m_Window->GetHeight());
+    
+    m_Window->SetEventCallback([this](Event& event) { OnEvent(event); });
+    
+    // Ritmo de frames (toma el control del intervalo de swap de la ventana)
+    FramePacerConfig pacing;
+    pacing.targetFrameRate = m_Config.targetFrameRate;
+    pacing.lowLatency = m_Config.lowLatency;
+    pacing.vsync = m_Config.vsync;
+    pacing.adaptiveVSync = m_Config.adaptiveVSync;
+    m_FramePacer = std::make_unique<FramePacer>(*m_Window, pacing);
+    
+    // IA repartida entre ticks (determinista para lockstep)
+    AISchedulerConfig ai;
+    ai.budgetUs = m_Config.aiBudgetUs;
+    m_AIScheduler = std::make_unique<AIScheduler>(ai);
     
     m_Running = true;
     m_LastFrameTime = 0.0f;
@@ -53,36 +101,85 @@ void Engine::Run() {
     DESTINY_CORE_INFO("Iniciando bucle principal");
     
     while (m_Running && !m_Window->ShouldClose()) {
+        // Esperar al plazo del frame (y a la GPU en bajo retardo) antes de leer la entrada
+        m_FramePacer->BeginFrame();
+        m_Window->PollEvents();
+        
         // Calcular tiempo delta
         float time = static_cast<float>(glfwGetTime());
         float deltaTime = time - m_LastFrameTime;
         m_LastFrameTime = time;
         
+        m_AssetRegistry->NewFrame();
+        m_RenderTargetPool->NewFrame();
+#if DESTINY_DEBUG_DRAW
+        DebugDraw::NewFrame(deltaTime);
+#endif
+        
+        // El mundo va al render target escalado; la UI, después, a resolución nativa
+        if (m_DynamicResolution)
+            m_DynamicResolution->BeginScene();
+        
         // Limpiar pantalla con color azul oscuro
         m_Renderer->Clear({ 0.1f, 0.1f, 0.2f, 1.0f });
         
         // Aquí se implementaría la lógica de actualización y renderizado
         
-        // Intercambiar buffers y procesar eventos
+        if (m_DynamicResolution)
+            m_DynamicResolution->EndScene();
+        
+        // Intercambiar buffers
         m_Window->SwapBuffers();
-        m_Window->PollEvents();
+        m_FramePacer->EndFrame();
     }
     
     DESTINY_CORE_INFO("Bucle principal finalizado");
 }
 
+void Engine::OnEvent(Event& event) {
+    EventDispatcher dispatcher(event);
+    dispatcher.Dispatch<WindowResizeEvent>([this](WindowResizeEvent& resize) {
+        if (resize.IsMinimized())
+            return false;
+        
+        glViewport(0, 0, resize.GetWidth(), resize.GetHeight());
+        if (m_DynamicResolution)
+            m_DynamicResolution->Resize(resize.GetWidth(), resize.GetHeight());
+        return m_RenderTargetPool->OnWindowResize(resize);
+    });
+}
+
 void Engine::Shutdown() {
-    if (!m_Running) {
+    if (!m_NeedsShutdown) {
         return;
     }
     
     DESTINY_CORE_INFO("Apagando motor");
     
-    // Liberar recursos en orden inverso
+    // Liberar recursos en orden inverso (sólo los que llegaron a crearse)
+    if (m_FramePacer)
+        m_FramePacer->LogStats();
+    m_FramePacer.reset();
+    if (m_AIScheduler)
+        m_AIScheduler->LogStats();
+    m_AIScheduler.reset();
+    if (m_RenderTargetPool)
+        m_RenderTargetPool->LogStats();
+    m_RenderTargetPool.reset();
+    m_DynamicResolution.reset();
+#if DESTINY_DEBUG_DRAW
+    DebugDraw::Shutdown();
+#endif
     m_Renderer.reset();
+    if (m_AssetRegistry)
+        m_AssetRegistry->LogStats();
+    m_AssetRegistry.reset();
+    m_JobSystem.reset();
     m_Window.reset();
+    FileSystem::UnmountAll();
     
     m_Running = false;
+    m_NeedsShutdown = false;
 }
 
 } // namespace Destiny
\ No newline at end of file
@@ -2,11 +2,19 @@
 
 #include <memory>
 #include <string>
+#include "FramePacer.h"
+#include "JobSystem.h"
 #include "Window.h"
+#include "../AI/AIScheduler.h"
+#include "../Graphics/DynamicResolution.h"
 #include "../Graphics/Renderer.h"
+#include "../Graphics/RenderTargetPool.h"
+#include "../Assets/AssetRegistry.h"
 
 namespace Destiny {
 
+class Event;
+
 class Engine {
 public:
     struct Config {
@@ -15,10 +23,25 @@ public:
         int width;
         int height;
         bool vsync;
+        std::string assetPack;  // Paquete .pak a montar; sin él se leen archivos sueltos
+        size_t textureBudgetMB; // Presupuesto de VRAM para texturas (0 = sin límite)
+        bool gpuDriven;         // Culling en GPU y multi-draw indirect si hay OpenGL 4.3
+        float targetFrameRate;  // Limitador de frames (0 = sin límite)
+        bool lowLatency;        // Esperar a la GPU antes de leer la entrada
+        bool adaptiveVSync;     // Opcional: sin vsync mientras los frames no llegan al refresco (permite tearing)
+        bool dynamicResolution; // Escena a escala variable para mantener targetFrameMs de GPU
+        float minResolutionScale;
+        float maxResolutionScale;
+        float targetFrameMs;
+        uint32_t aiBudgetUs;    // Presupuesto de IA por tick de simulación
         
         // Constructor por defecto con valores predefinidos
         Config() 
-            : appName("Destiny Engine App"), width(1280), height(720), vsync(true) {}
+            : appName("Destiny Engine App"), width(1280), height(720), vsync(true),
+              assetPack("assets.pak"), textureBudgetMB(512), gpuDriven(true),
+              targetFrameRate(0.0f), lowLatency(false), adaptiveVSync(false),
+              dynamicResolution(false), minResolutionScale(0.5f), maxResolutionScale(1.0f), targetFrameMs(14.0f),
+              aiBudgetUs(2000) {}
     };
 
     Engine(const Config& config = Config());
@@ -40,17 +63,33 @@ public:
     // Acceso a componentes
     Window& GetWindow() { return *m_Window; }
     Renderer& GetRenderer() { return *m_Renderer; }
+    JobSystem& GetJobSystem() { return *m_JobSystem; }
+    AssetRegistry& GetAssetRegistry() { return *m_AssetRegistry; }
+    FramePacer& GetFramePacer() { return *m_FramePacer; }
+    DynamicResolution* GetDynamicResolution() { return m_DynamicResolution.get(); }  // nullptr si está desactivada
+    RenderTargetPool& GetRenderTargetPool() { return *m_RenderTargetPool; }
+    AIScheduler& GetAIScheduler() { return *m_AIScheduler; }  // El juego llama a Update en cada tick de simulación
     
     // Instancia global
     static Engine& Get() { return *s_Instance; }
 
 private:
+    // Eventos de la ventana
+    void OnEvent(Event& event);
+    
     bool m_Running = false;
+    bool m_NeedsShutdown = false;   // Initialize empezó: hay que liberar aunque haya fallado
     float m_LastFrameTime = 0.0f;
     
     Config m_Config;
     std::unique_ptr<Window> m_Window;
+    std::unique_ptr<JobSystem> m_JobSystem;
+    std::unique_ptr<AssetRegistry> m_AssetRegistry;
     std::unique_ptr<Renderer> m_Renderer;
+    std::unique_ptr<FramePacer> m_FramePacer;
+    std::unique_ptr<DynamicResolution> m_DynamicResolution;
+    std::unique_ptr<RenderTargetPool> m_RenderTargetPool;
+    std::unique_ptr<AIScheduler> m_AIScheduler;
     
     // Para acceso global
     static Engine* s_Instance;
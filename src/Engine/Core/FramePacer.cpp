@@ -0,0 +1,219 @@
+#include "FramePacer.h"
+#include "Window.h"
+#include "Log.h"
+
+#include <GLFW/glfw3.h>
+#include <algorithm>
+#include <bitset>
+#include <thread>
+
+namespace Destiny {
+
+static float ToMs(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<float, std::milli>(duration).count();
+}
+
+void FrameHistogram::Record(float ms) {
+    uint32_t bucket = std::min(static_cast<uint32_t>(std::max(ms, 0.0f) / BucketMs), BucketCount - 1);
+    m_Buckets[bucket]++;
+    m_Count++;
+    m_Sum += ms;
+    m_Max = std::max(m_Max, ms);
+}
+
+void FrameHistogram::Reset() {
+    m_Buckets.fill(0);
+    m_Count = 0;
+    m_Sum = 0.0;
+    m_Max = 0.0f;
+}
+
+float FrameHistogram::Percentile(float p) const {
+    if (m_Count == 0)
+        return 0.0f;
+
+    uint64_t rank = static_cast<uint64_t>(std::clamp(p, 0.0f, 1.0f) * (m_Count - 1)) + 1;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BucketCount; i++) {
+        seen += m_Buckets[i];
+        if (seen >= rank)
+            return (i + 1) * BucketMs;
+    }
+    return MaxMs;
+}
+
+FramePacer::FramePacer(Window& window, const FramePacerConfig& config)
+    : m_Window(window), m_Config(config) {
+    m_HasSwapTear = glfwExtensionSupported("WGL_EXT_swap_control_tear") ||
+                    glfwExtensionSupported("GLX_EXT_swap_control_tear");
+
+    const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor());
+    if (mode && mode->refreshRate > 0)
+        m_RefreshMs = 1000.0f / static_cast<float>(mode->refreshRate);
+
+    m_Config.maxFramesInFlight = std::max(m_Config.maxFramesInFlight, 1u);
+    SetVSync(config.vsync, config.adaptiveVSync);
+
+    DESTINY_CORE_INFO("Ritmo de frames: objetivo {0} fps, bajo retardo {1}, refresco {2} ms",
+                      m_Config.targetFrameRate, m_Config.lowLatency ? "sí" : "no", m_RefreshMs);
+}
+
+FramePacer::~FramePacer() {
+    for (PendingFrame& frame : m_PendingFrames)
+        glDeleteSync(frame.fence);
+}
+
+void FramePacer::SetTargetFrameRate(float framesPerSecond) {
+    m_Config.targetFrameRate = std::max(framesPerSecond, 0.0f);
+    m_FirstFrame = true;
+}
+
+void FramePacer::SetLowLatency(bool enabled) {
+    m_Config.lowLatency = enabled;
+}
+
+void FramePacer::SetVSync(bool enabled, bool adaptive) {
+    m_Config.vsync = enabled;
+    m_Config.adaptiveVSync = adaptive;
+    m_MissHistory = 0;
+
+    // -1 = vsync salvo cuando el frame llega tarde, que se presenta sin esperar
+    if (!enabled)
+        ApplySwapInterval(0);
+    else if (adaptive && m_HasSwapTear)
+        ApplySwapInterval(-1);
+    else
+        ApplySwapInterval(1);
+}
+
+void FramePacer::ApplySwapInterval(int interval) {
+    m_SwapInterval = interval;
+    glfwSwapInterval(interval);
+}
+
+void FramePacer::BeginFrame() {
+    Clock::time_point now = Clock::now();
+    if (!m_FirstFrame) {
+        float frameMs = ToMs(now - m_FrameStart);
+        m_Stats.frameMs = frameMs;
+        m_Stats.workMs = frameMs - m_FrameWaitMs;
+        m_FrameTimes.Record(frameMs);
+        UpdateAdaptiveVSync(m_Stats.workMs);
+    }
+    m_FrameStart = now;
+
+    // En bajo retardo la GPU tiene que haber terminado el frame anterior antes
+    // de leer la entrada. Se espera antes del limitador: el plazo es absoluto, así
+    // que esta espera sale del sleep y no se suma al frame
+    Clock::time_point gpuStart = Clock::now();
+    if (m_Config.lowLatency)
+        RetireFrames(1);
+    m_Stats.gpuWaitMs = ToMs(Clock::now() - gpuStart);
+
+    WaitForDeadline();
+
+    // Sin bajo retardo sólo se bloquea si hay demasiados frames encolados
+    if (!m_Config.lowLatency) {
+        gpuStart = Clock::now();
+        RetireFrames(m_Config.maxFramesInFlight);
+        m_Stats.gpuWaitMs = ToMs(Clock::now() - gpuStart);
+    }
+    m_InputTime = Clock::now();
+
+    m_FrameWaitMs = m_Stats.limiterWaitMs + m_Stats.gpuWaitMs;
+    m_FirstFrame = false;
+}
+
+void FramePacer::EndFrame() {
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    glFlush();
+    m_PendingFrames.push_back({ fence, m_InputTime });
+    m_Stats.framesInFlight = static_cast<uint32_t>(m_PendingFrames.size());
+}
+
+void FramePacer::WaitForDeadline() {
+    m_Stats.limiterWaitMs = 0.0f;
+    if (m_Config.targetFrameRate <= 0.0f)
+        return;
+
+    auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / m_Config.targetFrameRate));
+    Clock::time_point start = Clock::now();
+
+    // Plazos fijos (no "ahora + periodo") para que el error de cada espera no se
+    // acumule; si vamos más de un periodo tarde se reinicia en vez de recuperar
+    if (m_FirstFrame || start - m_Deadline > period)
+        m_Deadline = start;
+    else
+        m_Deadline += period;
+
+    auto spin = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float, std::milli>(m_Config.spinMs));
+    if (m_Deadline - start > spin)
+        std::this_thread::sleep_for(m_Deadline - start - spin);
+    while (Clock::now() < m_Deadline)
+        std::this_thread::yield();
+
+    m_Stats.limiterWaitMs = ToMs(Clock::now() - start);
+}
+
+void FramePacer::RetireFrames(uint32_t maxInFlight) {
+    // Frames que la GPU ya terminó, sin bloquear
+    while (!m_PendingFrames.empty()) {
+        PendingFrame& frame = m_PendingFrames.front();
+        GLenum result = glClientWaitSync(frame.fence, 0, 0);
+        if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED)
+            break;
+
+        m_Stats.latencyMs = ToMs(Clock::now() - frame.inputTime);
+        m_Latencies.Record(m_Stats.latencyMs);
+        glDeleteSync(frame.fence);
+        m_PendingFrames.pop_front();
+    }
+
+    // Bloquear hasta que queden menos de maxInFlight encolados
+    while (m_PendingFrames.size() >= maxInFlight && !m_PendingFrames.empty()) {
+        PendingFrame& frame = m_PendingFrames.front();
+        GLenum result = glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000);   // 100 ms
+        if (result == GL_WAIT_FAILED)
+            DESTINY_CORE_WARN("Fallo esperando la fence del frame");
+
+        m_Stats.latencyMs = ToMs(Clock::now() - frame.inputTime);
+        m_Latencies.Record(m_Stats.latencyMs);
+        glDeleteSync(frame.fence);
+        m_PendingFrames.pop_front();
+    }
+}
+
+void FramePacer::UpdateAdaptiveVSync(float workMs) {
+    // Con swap tear del driver no hay nada que decidir aquí
+    if (!m_Config.vsync || !m_Config.adaptiveVSync || m_HasSwapTear)
+        return;
+
+    bool miss = m_SwapInterval != 0 ? workMs > m_RefreshMs * 1.05f : workMs > m_RefreshMs * 0.85f;
+    m_MissHistory = (m_MissHistory << 1) | (miss ? 1u : 0u);
+    uint32_t recentMisses = static_cast<uint32_t>(std::bitset<16>(m_MissHistory & 0xffff).count());
+
+    // Con vsync un frame que no cabe espera al siguiente refresco (60 -> 30 fps)
+    if (m_SwapInterval != 0 && recentMisses >= 8) {
+        ApplySwapInterval(0);
+        m_MissHistory = 0xffff;
+    }
+    else if (m_SwapInterval == 0 && recentMisses == 0) {
+        ApplySwapInterval(1);
+    }
+}
+
+void FramePacer::ResetHistograms() {
+    m_FrameTimes.Reset();
+    m_Latencies.Reset();
+}
+
+void FramePacer::LogStats() const {
+    DESTINY_CORE_INFO("Frames: {0}, media {1} ms, p50 {2} ms, p99 {3} ms, máx {4} ms",
+                      m_FrameTimes.GetCount(), m_FrameTimes.GetMean(), m_FrameTimes.Percentile(0.5f),
+                      m_FrameTimes.Percentile(0.99f), m_FrameTimes.GetMax());
+    DESTINY_CORE_INFO("Retardo entrada-presentación: media {0} ms, p50 {1} ms, p99 {2} ms",
+                      m_Latencies.GetMean(), m_Latencies.Percentile(0.5f), m_Latencies.Percentile(0.99f));
+}
+
+} // namespace Destiny
\ No newline at end of file
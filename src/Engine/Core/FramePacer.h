@@ -0,0 +1,129 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+
+#include <GL/glew.h>
+
+namespace Destiny {
+
+class Window;
+
+// Histograma de tiempos en milisegundos con cubos fijos de BucketMs;
+// lo que pasa de MaxMs cae en el último cubo
+class FrameHistogram {
+public:
+    static constexpr float BucketMs = 0.5f;
+    static constexpr uint32_t BucketCount = 200;       // Hasta 100 ms
+    static constexpr float MaxMs = BucketMs * BucketCount;
+
+    void Record(float ms);
+    void Reset();
+
+    // p en [0, 1]; devuelve el límite superior del cubo (error máximo BucketMs)
+    float Percentile(float p) const;
+    float GetMean() const { return m_Count ? static_cast<float>(m_Sum / m_Count) : 0.0f; }
+    float GetMax() const { return m_Max; }
+    uint64_t GetCount() const { return m_Count; }
+    const std::array<uint32_t, BucketCount>& GetBuckets() const { return m_Buckets; }
+
+private:
+    std::array<uint32_t, BucketCount> m_Buckets{};
+    uint64_t m_Count = 0;
+    double m_Sum = 0.0;
+    float m_Max = 0.0f;
+};
+
+struct FramePacerConfig {
+    float targetFrameRate = 0.0f;      // 0 = sin límite (sólo vsync)
+    float spinMs = 1.5f;               // Último tramo de la espera en espera activa
+    bool lowLatency = false;           // Esperar a la GPU antes de leer la entrada
+    uint32_t maxFramesInFlight = 2;    // Frames encolados en la GPU permitidos (1 en bajo retardo)
+    bool vsync = true;
+    bool adaptiveVSync = false;        // Quitar vsync mientras no se llega al refresco
+};
+
+// Ritmo de frames del bucle principal. BeginFrame espera al plazo del limitador
+// (sleep y después espera activa: el sleep del sistema llega tarde, el spin no)
+// y, en bajo retardo, a que la GPU termine los frames anteriores, de modo que la
+// entrada se lee lo más cerca posible del frame que la va a mostrar. EndFrame
+// pone una fence tras el swap y con ella se mide el retardo entrada-presentación.
+//
+// Con adaptiveVSync se usa el swap tear del driver si existe (intervalo -1); si
+// no, el vsync se quita mientras la mayoría de frames recientes no caben en un
+// refresco y se vuelve a poner cuando sobra margen.
+class FramePacer {
+public:
+    FramePacer(Window& window, const FramePacerConfig& config = FramePacerConfig());
+    ~FramePacer();
+
+    // No permitir copia
+    FramePacer(const FramePacer&) = delete;
+    FramePacer& operator=(const FramePacer&) = delete;
+
+    // Antes de leer la entrada / después de SwapBuffers
+    void BeginFrame();
+    void EndFrame();
+
+    void SetTargetFrameRate(float framesPerSecond);
+    void SetLowLatency(bool enabled);
+    void SetVSync(bool enabled, bool adaptive);
+
+    const FramePacerConfig& GetConfig() const { return m_Config; }
+    bool IsVSyncActive() const { return m_SwapInterval != 0; }
+
+    const FrameHistogram& GetFrameTimes() const { return m_FrameTimes; }
+    const FrameHistogram& GetLatencies() const { return m_Latencies; }
+    void ResetHistograms();
+    void LogStats() const;
+
+    // Estadísticas del último frame
+    struct Stats {
+        float frameMs = 0.0f;          // De BeginFrame a BeginFrame
+        float workMs = 0.0f;           // Frame sin las esperas del pacer
+        float limiterWaitMs = 0.0f;
+        float gpuWaitMs = 0.0f;
+        float latencyMs = 0.0f;        // Entrada hasta fence señalada del último frame retirado
+        uint32_t framesInFlight = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PendingFrame {
+        GLsync fence;
+        Clock::time_point inputTime;
+    };
+
+    void WaitForDeadline();
+    void RetireFrames(uint32_t maxInFlight);
+    void ApplySwapInterval(int interval);
+    void UpdateAdaptiveVSync(float frameMs);
+
+    Window& m_Window;
+    FramePacerConfig m_Config;
+
+    Clock::time_point m_Deadline;
+    Clock::time_point m_FrameStart;
+    Clock::time_point m_InputTime;
+    bool m_FirstFrame = true;
+    float m_FrameWaitMs = 0.0f;
+
+    std::deque<PendingFrame> m_PendingFrames;
+
+    // Vsync adaptativo
+    int m_SwapInterval = 1;
+    bool m_HasSwapTear = false;
+    float m_RefreshMs = 1000.0f / 60.0f;
+    uint32_t m_MissHistory = 0;        // Bit i = el frame i-ésimo más reciente no cupo en un refresco
+
+    FrameHistogram m_FrameTimes;
+    FrameHistogram m_Latencies;
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "JobSystem.h"
+#include "Log.h"
+
+#include <algorithm>
+
+namespace Destiny {
+
+JobSystem::JobSystem(uint32_t threadCount) {
+    if (threadCount == 0) {
+        uint32_t cores = std::thread::hardware_concurrency();
+        threadCount = cores > 1 ? cores - 1 : 0;
+    }
+
+    m_Workers.reserve(threadCount);
+    for (uint32_t i = 0; i < threadCount; i++)
+        m_Workers.emplace_back([this]() { WorkerLoop(); });
+
+    DESTINY_CORE_INFO("Sistema de trabajos iniciado con {0} hilos", threadCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_WakeCondition.notify_all();
+
+    for (auto& worker : m_Workers)
+        worker.join();
+}
+
+void JobSystem::Execute(std::function<void()> job) {
+    m_PendingJobs++;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queue.push_back(std::move(job));
+    }
+    m_WakeCondition.notify_one();
+}
+
+void JobSystem::Wait() {
+    while (m_PendingJobs > 0) {
+        if (RunPendingJob())
+            continue;
+
+        // Cola vacía: los trabajos restantes se están ejecutando en otros hilos
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_IdleCondition.wait(lock, [this]() { return m_PendingJobs == 0 || !m_Queue.empty(); });
+    }
+}
+
+uint32_t JobSystem::GetRangeCount(uint32_t count, uint32_t minRangeSize) const {
+    if (count == 0)
+        return 0;
+
+    // Unos pocos rangos por hilo para repartir mejor la carga desigual
+    uint32_t threads = GetWorkerCount() + 1;
+    uint32_t rangeSize = std::max(std::max(minRangeSize, 1u), (count + threads * 4 - 1) / (threads * 4));
+    return (count + rangeSize - 1) / rangeSize;
+}
+
+void JobSystem::ParallelFor(uint32_t count, uint32_t minRangeSize,
+                            const std::function<void(uint32_t, uint32_t)>& func) {
+    uint32_t rangeCount = GetRangeCount(count, minRangeSize);
+    if (rangeCount == 0)
+        return;
+
+    if (rangeCount == 1 || m_Workers.empty()) {
+        func(0, count);
+        return;
+    }
+
+    uint32_t rangeSize = (count + rangeCount - 1) / rangeCount;
+    std::atomic<uint32_t> remaining{ rangeCount - 1 };
+
+    // El primer rango lo ejecuta el hilo que llama
+    for (uint32_t range = 1; range < rangeCount; range++) {
+        uint32_t begin = range * rangeSize;
+        uint32_t end = std::min(count, begin + rangeSize);
+        Execute([&func, &remaining, begin, end]() {
+            func(begin, end);
+            remaining--;
+        });
+    }
+
+    func(0, std::min(count, rangeSize));
+
+    // Ayudar con trabajos pendientes en lugar de bloquear el hilo
+    while (remaining > 0) {
+        if (!RunPendingJob())
+            std::this_thread::yield();
+    }
+}
+
+bool JobSystem::RunPendingJob() {
+    std::function<void()> job;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_Queue.empty())
+            return false;
+        job = std::move(m_Queue.front());
+        m_Queue.pop_front();
+    }
+
+    job();
+
+    if (--m_PendingJobs == 0) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_IdleCondition.notify_all();
+    }
+    return true;
+}
+
+void JobSystem::WorkerLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_WakeCondition.wait(lock, [this]() { return m_Stopping || !m_Queue.empty(); });
+            if (m_Stopping && m_Queue.empty())
+                return;
+        }
+
+        RunPendingJob();
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
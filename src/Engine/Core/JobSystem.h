@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Destiny {
+
+// Pool de hilos trabajadores para tareas paralelas del motor
+class JobSystem {
+public:
+    // threadCount = 0 usa (núcleos - 1) trabajadores; el hilo que espera también ejecuta trabajos
+    explicit JobSystem(uint32_t threadCount = 0);
+    ~JobSystem();
+
+    // No permitir copia
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Encolar un trabajo asíncrono
+    void Execute(std::function<void()> job);
+
+    // Esperar a que terminen todos los trabajos encolados con Execute
+    void Wait();
+
+    // Ejecutar func(begin, end) sobre [0, count) dividido en rangos contiguos.
+    // Los rangos dependen de count, minRangeSize y el número de hilos, nunca del orden
+    // de ejecución, y la llamada bloquea hasta que todos han terminado.
+    void ParallelFor(uint32_t count, uint32_t minRangeSize,
+                     const std::function<void(uint32_t, uint32_t)>& func);
+
+    // Información
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+
+    // Número de rangos en que ParallelFor dividiría count elementos
+    uint32_t GetRangeCount(uint32_t count, uint32_t minRangeSize) const;
+
+private:
+    void WorkerLoop();
+
+    // Ejecuta un trabajo pendiente en el hilo actual; false si la cola estaba vacía
+    bool RunPendingJob();
+
+    std::vector<std::thread> m_Workers;
+    std::deque<std::function<void()>> m_Queue;
+    std::mutex m_Mutex;
+    std::condition_variable m_WakeCondition;
+    std::condition_variable m_IdleCondition;
+    std::atomic<uint32_t> m_PendingJobs{ 0 };
+    bool m_Stopping = false;
+};
+
+} // namespace Destiny
\ No newline at end of file
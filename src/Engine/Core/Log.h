@@ -55,22 +55,10 @@ public:
     }
     
     // Función auxiliar para formatear string
+    // Sustituye el marcador {n} de menor índice que quede en el texto
     template<typename T>
     static std::string Format(const std::string& format, T arg) {
         std::string result = format;
-        size_t pos = result.find("{0}");
-        if (pos != std::string::npos) {
-            std::ostringstream ss;
-            ss << arg;
-            result.replace(pos, 3, ss.str());
-        }
-        return result;
-    }
-    
-    // Versión recursiva para formatear múltiples argumentos
-    template<typename T, typename... Args>
-    static std::string Format(const std::string& format, T arg, Args... args) {
-        std::string result = format;
         
         // Buscar el próximo marcador {n}
         for (int i = 0; i < 10; i++) {  // Soportamos hasta {9}
@@ -83,9 +71,14 @@ public:
                 break;
             }
         }
-        
+        return result;
+    }
+    
+    // Versión recursiva para formatear múltiples argumentos
+    template<typename T, typename... Args>
+    static std::string Format(const std::string& format, T arg, Args... args) {
         // Continuar con el resto de argumentos
-        return Format(result, args...);
+        return Format(Format(format, arg), args...);
     }
     
     // Función base para terminar la recursión
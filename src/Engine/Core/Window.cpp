@@ -1,5 +1,6 @@
 #include "Window.h"
 #include "Log.h"
+#include "../Events/ApplicationEvent.h"
 
 // Es crucial incluir GLEW antes que GLFW
 #include <GL/glew.h>
@@ -35,13 +36,23 @@ bool Window::Init() {
     // Configurar callback de error
     glfwSetErrorCallback(GLFWErrorCallback);
     
-    // Configurar opciones de GLFW
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    // Configurar opciones de GLFW: primero 4.3 (compute e indirect), si no 3.3
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     
-    // Crear ventana
+    // Sin callback durante el intento: que no haya 4.3 no es un error
+    glfwSetErrorCallback(nullptr);
     m_Window = glfwCreateWindow(m_Width, m_Height, m_Title.c_str(), nullptr, nullptr);
+    glfwSetErrorCallback(GLFWErrorCallback);
+    
+    if (!m_Window) {
+        DESTINY_CORE_INFO("OpenGL 4.3 no disponible, usando 3.3");
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+        m_Window = glfwCreateWindow(m_Width, m_Height, m_Title.c_str(), nullptr, nullptr);
+    }
+    
     if (!m_Window) {
         DESTINY_CORE_ERROR("No se pudo crear la ventana GLFW");
         glfwTerminate();
@@ -59,10 +70,38 @@ bool Window::Init() {
         return false;
     }
     
+    glGetIntegerv(GL_MAJOR_VERSION, &m_ContextMajor);
+    glGetIntegerv(GL_MINOR_VERSION, &m_ContextMinor);
+    
     // Configurar VSync
     glfwSwapInterval(m_VSync ? 1 : 0);
     
-    DESTINY_CORE_INFO("Ventana creada correctamente: {0} ({1}x{2})", m_Title, m_Width, m_Height);
+    // El tamaño que importa para los render targets es el del framebuffer (HiDPI)
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(m_Window, &framebufferWidth, &framebufferHeight);
+    m_Width = framebufferWidth;
+    m_Height = framebufferHeight;
+    
+    glfwSetWindowUserPointer(m_Window, this);
+    glfwSetFramebufferSizeCallback(m_Window, [](GLFWwindow* nativeWindow, int width, int height) {
+        Window& window = *static_cast<Window*>(glfwGetWindowUserPointer(nativeWindow));
+        if (width == window.m_Width && height == window.m_Height)
+            return;
+        
+        // Minimizada se conserva el último tamaño válido
+        if (width > 0 && height > 0) {
+            window.m_Width = width;
+            window.m_Height = height;
+        }
+        
+        if (window.m_EventCallback) {
+            WindowResizeEvent event(width, height);
+            window.m_EventCallback(event);
+        }
+    });
+    
+    DESTINY_CORE_INFO("Ventana creada correctamente: {0} ({1}x{2}), OpenGL {3}.{4}", m_Title, m_Width, m_Height,
+                      m_ContextMajor, m_ContextMinor);
     return true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 
 // Para prevenir problemas, primero incluimos GL/glew.h
@@ -9,8 +10,12 @@
 
 namespace Destiny {
 
+class Event;
+
 class Window {
 public:
+    using EventCallbackFn = std::function<void(Event&)>;
+    
     Window(const std::string& title, int width, int height, bool vsync = true);
     ~Window();
     
@@ -23,12 +28,19 @@ public:
     void SwapBuffers();
     bool ShouldClose() const;
     
+    // Recibe los eventos de la ventana (por ahora WindowResizeEvent) durante PollEvents
+    void SetEventCallback(const EventCallbackFn& callback) { m_EventCallback = callback; }
+    
     // Información
     int GetWidth() const { return m_Width; }
     int GetHeight() const { return m_Height; }
     bool IsVSync() const { return m_VSync; }
     bool IsValid() const { return m_Window != nullptr; }
     
+    // Versión del contexto de OpenGL obtenido
+    int GetContextMajor() const { return m_ContextMajor; }
+    int GetContextMinor() const { return m_ContextMinor; }
+    
     // Acceso a la ventana nativa
     GLFWwindow* GetNativeWindow() const { return m_Window; }
 
@@ -38,6 +50,9 @@ private:
     int m_Width;
     int m_Height;
     bool m_VSync;
+    int m_ContextMajor = 0;
+    int m_ContextMinor = 0;
+    EventCallbackFn m_EventCallback;
     
     // Inicialización
     bool Init();
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Event.h"
+#include <sstream>
+
+namespace Destiny {
+
+// Evento de cambio de tamaño del framebuffer de la ventana (en píxeles)
+class WindowResizeEvent : public Event {
+public:
+    WindowResizeEvent(int width, int height)
+        : m_Width(width), m_Height(height) {
+    }
+    
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+    
+    // Minimizada: el framebuffer pasa a 0x0
+    bool IsMinimized() const { return m_Width == 0 || m_Height == 0; }
+    
+    std::string ToString() const override {
+        std::stringstream ss;
+        ss << "WindowResizeEvent: " << m_Width << "x" << m_Height;
+        return ss.str();
+    }
+    
+    static EventType GetStaticType() { return EventType::WindowResize; }
+    EventType GetEventType() const override { return GetStaticType(); }
+    const char* GetName() const override { return "WindowResize"; }
+    int GetCategoryFlags() const override { return EventCategoryApplication; }
+    
+private:
+    int m_Width;
+    int m_Height;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,359 @@
+#include "DebugDraw.h"
+
+#if DESTINY_DEBUG_DRAW
+
+#include "Font.h"
+#include "Shader.h"
+#include "TextRenderer.h"
+#include "../Core/Log.h"
+
+#include <GL/glew.h>
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Destiny {
+
+namespace {
+
+struct DebugVertex {
+    glm::vec2 position;
+    uint32_t color;
+};
+
+struct DebugText {
+    std::string text;
+    glm::vec2 position;
+    float size;
+    glm::vec4 color;
+    float remaining;
+};
+
+// Buffer de un hilo: sólo lo escribe su hilo y sólo lo vacía el render
+struct ThreadBuffer {
+    std::vector<DebugVertex> lines;             // Dos vértices por segmento
+    std::vector<DebugVertex> persistentLines;
+    std::vector<float> persistentTimes;         // Uno por segmento
+    std::vector<DebugText> texts;
+};
+
+struct DebugDrawState {
+    std::mutex mutex;                           // Sólo para registrar hilos nuevos
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::atomic<bool> enabled{ true };
+
+    // Persistentes ya recogidas de los hilos
+    std::vector<DebugVertex> persistentLines;
+    std::vector<float> persistentTimes;
+    std::vector<DebugText> persistentTexts;
+
+    std::vector<DebugVertex> upload;
+    std::unique_ptr<Shader> shader;
+    std::unique_ptr<TextRenderer> text;
+    uint32_t vao = 0;
+    uint32_t vbo = 0;
+    size_t vboBytes = 0;
+    bool initialized = false;
+    bool textSubmitted = false;
+    bool rendered = false;
+    bool warnedFont = false;
+
+    glm::vec2 circle[DebugDraw::CircleSegments];
+
+    DebugDraw::Stats stats;
+
+    DebugDrawState() {
+        for (uint32_t i = 0; i < DebugDraw::CircleSegments; i++) {
+            float angle = glm::two_pi<float>() * i / DebugDraw::CircleSegments;
+            circle[i] = glm::vec2(std::cos(angle), std::sin(angle));
+        }
+    }
+};
+
+DebugDrawState& GetState() {
+    static DebugDrawState state;
+    return state;
+}
+
+thread_local ThreadBuffer* t_Buffer = nullptr;
+
+ThreadBuffer& GetThreadBuffer() {
+    if (!t_Buffer) {
+        DebugDrawState& state = GetState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.buffers.push_back(std::make_unique<ThreadBuffer>());
+        t_Buffer = state.buffers.back().get();
+    }
+    return *t_Buffer;
+}
+
+uint32_t PackColor(const glm::vec4& color) {
+    auto channel = [](float value) {
+        return static_cast<uint32_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+    };
+    return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+}
+
+void AppendSegment(ThreadBuffer& buffer, const glm::vec2& from, const glm::vec2& to, uint32_t color, float duration) {
+    if (duration > 0.0f) {
+        buffer.persistentLines.push_back({ from, color });
+        buffer.persistentLines.push_back({ to, color });
+        buffer.persistentTimes.push_back(duration);
+    }
+    else {
+        buffer.lines.push_back({ from, color });
+        buffer.lines.push_back({ to, color });
+    }
+}
+
+bool InitializeGL(DebugDrawState& state) {
+    state.initialized = true;
+    try {
+        state.shader = std::make_unique<Shader>("shaders/DebugLine.vert", "shaders/DebugLine.frag");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_WARN("No se pudo crear el shader de depuración: {0}", e.what());
+        return false;
+    }
+
+    // Un archivo que falta no lanza: el shader queda con el programa 0
+    if (state.shader->GetRendererID() == 0) {
+        DESTINY_CORE_WARN("Shader de depuración no disponible");
+        state.shader.reset();
+        return false;
+    }
+
+    glGenVertexArrays(1, &state.vao);
+    glBindVertexArray(state.vao);
+    glGenBuffers(1, &state.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, state.vbo);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, color));
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+} // namespace
+
+void DebugDraw::Line(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float duration) {
+    if (!GetState().enabled.load(std::memory_order_relaxed))
+        return;
+
+    AppendSegment(GetThreadBuffer(), from, to, PackColor(color), duration);
+}
+
+void DebugDraw::Rect(const glm::vec2& min, const glm::vec2& max, const glm::vec4& color, float duration) {
+    if (!GetState().enabled.load(std::memory_order_relaxed))
+        return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    uint32_t packed = PackColor(color);
+    AppendSegment(buffer, min, glm::vec2(max.x, min.y), packed, duration);
+    AppendSegment(buffer, glm::vec2(max.x, min.y), max, packed, duration);
+    AppendSegment(buffer, max, glm::vec2(min.x, max.y), packed, duration);
+    AppendSegment(buffer, glm::vec2(min.x, max.y), min, packed, duration);
+}
+
+void DebugDraw::Circle(const glm::vec2& center, float radius, const glm::vec4& color, float duration) {
+    DebugDrawState& state = GetState();
+    if (!state.enabled.load(std::memory_order_relaxed))
+        return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    uint32_t packed = PackColor(color);
+    glm::vec2 previous = center + state.circle[CircleSegments - 1] * radius;
+    for (uint32_t i = 0; i < CircleSegments; i++) {
+        glm::vec2 point = center + state.circle[i] * radius;
+        AppendSegment(buffer, previous, point, packed, duration);
+        previous = point;
+    }
+}
+
+void DebugDraw::Arrow(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float duration) {
+    if (!GetState().enabled.load(std::memory_order_relaxed))
+        return;
+
+    ThreadBuffer& buffer = GetThreadBuffer();
+    uint32_t packed = PackColor(color);
+    AppendSegment(buffer, from, to, packed, duration);
+
+    // Punta a 25 grados con un quinto de la longitud
+    glm::vec2 back = (from - to) * 0.2f;
+    constexpr float Cos = 0.906307787f, Sin = 0.422618262f;
+    glm::vec2 left(back.x * Cos - back.y * Sin, back.x * Sin + back.y * Cos);
+    glm::vec2 right(back.x * Cos + back.y * Sin, -back.x * Sin + back.y * Cos);
+    AppendSegment(buffer, to, to + left, packed, duration);
+    AppendSegment(buffer, to, to + right, packed, duration);
+}
+
+void DebugDraw::Text(const glm::vec2& position, const std::string& text, const glm::vec4& color, float size, float duration) {
+    if (!GetState().enabled.load(std::memory_order_relaxed))
+        return;
+
+    GetThreadBuffer().texts.push_back({ text, position, size, color, duration });
+}
+
+void DebugDraw::SetEnabled(bool enabled) {
+    GetState().enabled.store(enabled);
+}
+
+bool DebugDraw::IsEnabled() {
+    return GetState().enabled.load();
+}
+
+void DebugDraw::SetFont(const std::shared_ptr<Font>& font) {
+    DebugDrawState& state = GetState();
+    state.text = font ? std::make_unique<TextRenderer>(font) : nullptr;
+}
+
+void DebugDraw::NewFrame(float deltaTime) {
+    DebugDrawState& state = GetState();
+    state.textSubmitted = false;
+    state.rendered = false;
+
+    // Envejecer y compactar en el sitio
+    size_t kept = 0;
+    for (size_t i = 0; i < state.persistentTimes.size(); i++) {
+        float remaining = state.persistentTimes[i] - deltaTime;
+        if (remaining <= 0.0f)
+            continue;
+
+        state.persistentTimes[kept] = remaining;
+        state.persistentLines[kept * 2] = state.persistentLines[i * 2];
+        state.persistentLines[kept * 2 + 1] = state.persistentLines[i * 2 + 1];
+        kept++;
+    }
+    state.persistentTimes.resize(kept);
+    state.persistentLines.resize(kept * 2);
+
+    for (DebugText& text : state.persistentTexts)
+        text.remaining -= deltaTime;
+    state.persistentTexts.erase(std::remove_if(state.persistentTexts.begin(), state.persistentTexts.end(),
+                                               [](const DebugText& text) { return text.remaining <= 0.0f; }),
+                                state.persistentTexts.end());
+}
+
+void DebugDraw::SubmitText(Renderer& renderer) {
+    DebugDrawState& state = GetState();
+    if (state.textSubmitted)
+        return;
+    state.textSubmitted = true;
+
+    uint32_t count = 0;
+    auto draw = [&](const DebugText& text) {
+        if (state.text)
+            state.text->DrawString(text.text, text.position, text.size, text.color);
+        count++;
+    };
+
+    // Las de un frame se dibujan aquí; las persistentes pasan a su lista y salen una sola vez con ella
+    for (const std::unique_ptr<ThreadBuffer>& buffer : state.buffers) {
+        for (DebugText& text : buffer->texts) {
+            if (text.remaining > 0.0f)
+                state.persistentTexts.push_back(std::move(text));
+            else
+                draw(text);
+        }
+        buffer->texts.clear();
+    }
+    for (const DebugText& text : state.persistentTexts)
+        draw(text);
+
+    state.stats.textCount = count;
+    if (count == 0)
+        return;
+
+    if (state.text) {
+        state.text->Submit(renderer);
+    }
+    else if (!state.warnedFont) {
+        DESTINY_CORE_WARN("DebugDraw::Text sin fuente: llama a DebugDraw::SetFont");
+        state.warnedFont = true;
+    }
+}
+
+void DebugDraw::Render(const glm::mat4& viewProjection) {
+    DebugDrawState& state = GetState();
+    if (state.rendered)
+        return;
+    state.rendered = true;
+
+    // Juntar los buffers de todos los hilos; las persistentes pasan a la lista global
+    state.upload.clear();
+    for (const std::unique_ptr<ThreadBuffer>& buffer : state.buffers) {
+        state.upload.insert(state.upload.end(), buffer->lines.begin(), buffer->lines.end());
+        state.persistentLines.insert(state.persistentLines.end(), buffer->persistentLines.begin(), buffer->persistentLines.end());
+        state.persistentTimes.insert(state.persistentTimes.end(), buffer->persistentTimes.begin(), buffer->persistentTimes.end());
+        buffer->lines.clear();
+        buffer->persistentLines.clear();
+        buffer->persistentTimes.clear();
+    }
+
+    state.stats.lineCount = static_cast<uint32_t>(state.upload.size() / 2);
+    state.stats.persistentLines = static_cast<uint32_t>(state.persistentTimes.size());
+    state.stats.threadBuffers = static_cast<uint32_t>(state.buffers.size());
+    state.stats.drawCalls = 0;
+    state.upload.insert(state.upload.end(), state.persistentLines.begin(), state.persistentLines.end());
+
+    if (state.upload.empty())
+        return;
+    if (!state.initialized && !InitializeGL(state))
+        return;
+    if (!state.shader)
+        return;
+
+    glBindVertexArray(state.vao);
+    glBindBuffer(GL_ARRAY_BUFFER, state.vbo);
+    size_t bytes = state.upload.size() * sizeof(DebugVertex);
+    if (bytes > state.vboBytes)
+        state.vboBytes = std::max(bytes, state.vboBytes * 2);
+    glBufferData(GL_ARRAY_BUFFER, state.vboBytes, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, state.upload.data());
+
+    // Siempre encima de la escena
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    glDisable(GL_DEPTH_TEST);
+
+    state.shader->Bind();
+    state.shader->SetMat4("u_ViewProjection", viewProjection);
+    glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(state.upload.size()));
+    state.shader->Unbind();
+    state.stats.drawCalls = 1;
+
+    if (depthTest)
+        glEnable(GL_DEPTH_TEST);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+}
+
+void DebugDraw::Shutdown() {
+    DebugDrawState& state = GetState();
+    if (state.vao) {
+        glDeleteVertexArrays(1, &state.vao);
+        glDeleteBuffers(1, &state.vbo);
+    }
+    state.vao = 0;
+    state.vbo = 0;
+    state.vboBytes = 0;
+    state.shader.reset();
+    state.text.reset();
+    state.initialized = false;
+}
+
+const DebugDraw::Stats& DebugDraw::GetStats() {
+    return GetState().stats;
+}
+
+} // namespace Destiny
+
+#endif
\ No newline at end of file
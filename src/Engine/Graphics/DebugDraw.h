@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <glm/glm.hpp>
+
+// Sólo existe en builds de depuración (sin NDEBUG); se puede forzar con
+// DESTINY_DEBUG_DRAW=0/1. Desactivado, las macros no evalúan sus argumentos.
+#ifndef DESTINY_DEBUG_DRAW
+    #ifdef NDEBUG
+        #define DESTINY_DEBUG_DRAW 0
+    #else
+        #define DESTINY_DEBUG_DRAW 1
+    #endif
+#endif
+
+#if DESTINY_DEBUG_DRAW
+
+namespace Destiny {
+
+class Font;
+class Renderer;
+
+// Dibujo de depuración en modo inmediato (caminos, colisiones, IA).
+// Se puede llamar desde cualquier hilo o trabajo: cada hilo escribe en su propio
+// buffer sin bloqueos y el renderer los junta en el primer EndScene del frame,
+// todas las líneas en un único GL_LINES y el texto dentro del batch de quads.
+// Con duration > 0 la primitiva se mantiene ese número de segundos; con 0 dura
+// un frame. Las coordenadas son las de la escena del mundo.
+//
+// Los trabajos que dibujan deben haber terminado antes de EndScene (ParallelFor
+// ya espera a sus rangos).
+class DebugDraw {
+public:
+    static void Line(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float duration = 0.0f);
+    static void Rect(const glm::vec2& min, const glm::vec2& max, const glm::vec4& color, float duration = 0.0f);
+    static void Circle(const glm::vec2& center, float radius, const glm::vec4& color, float duration = 0.0f);
+    static void Arrow(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float duration = 0.0f);
+    // position: esquina inferior izquierda; size: alto de la letra. Requiere SetFont
+    static void Text(const glm::vec2& position, const std::string& text, const glm::vec4& color,
+                     float size = 1.0f, float duration = 0.0f);
+
+    static void SetEnabled(bool enabled);
+    static bool IsEnabled();
+    static void SetFont(const std::shared_ptr<Font>& font);
+
+    // Inicio de frame: envejece las primitivas persistentes y descarta las caducadas
+    static void NewFrame(float deltaTime);
+
+    // Las llama Renderer::EndScene (sólo actúan la primera vez en cada frame)
+    static void SubmitText(Renderer& renderer);
+    static void Render(const glm::mat4& viewProjection);
+
+    // Liberar los recursos de OpenGL antes de destruir el contexto
+    static void Shutdown();
+
+    static constexpr uint32_t CircleSegments = 24;
+
+    // Estadísticas del último Render
+    struct Stats {
+        uint32_t lineCount = 0;
+        uint32_t persistentLines = 0;
+        uint32_t textCount = 0;
+        uint32_t threadBuffers = 0;
+        uint32_t drawCalls = 0;
+    };
+
+    static const Stats& GetStats();
+};
+
+} // namespace Destiny
+
+#define DESTINY_DEBUG_LINE(...)   ::Destiny::DebugDraw::Line(__VA_ARGS__)
+#define DESTINY_DEBUG_RECT(...)   ::Destiny::DebugDraw::Rect(__VA_ARGS__)
+#define DESTINY_DEBUG_CIRCLE(...) ::Destiny::DebugDraw::Circle(__VA_ARGS__)
+#define DESTINY_DEBUG_ARROW(...)  ::Destiny::DebugDraw::Arrow(__VA_ARGS__)
+#define DESTINY_DEBUG_TEXT(...)   ::Destiny::DebugDraw::Text(__VA_ARGS__)
+
+#else
+
+#define DESTINY_DEBUG_LINE(...)   ((void)0)
+#define DESTINY_DEBUG_RECT(...)   ((void)0)
+#define DESTINY_DEBUG_CIRCLE(...) ((void)0)
+#define DESTINY_DEBUG_ARROW(...)  ((void)0)
+#define DESTINY_DEBUG_TEXT(...)   ((void)0)
+
+#endif
\ No newline at end of file
@@ -0,0 +1,272 @@
+#include "DynamicResolution.h"
+#include "Shader.h"
+#include "../Core/Log.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Destiny {
+
+DynamicResolution::DynamicResolution(uint32_t width, uint32_t height, const DynamicResolutionDesc& desc)
+    : m_Desc(desc), m_Width(width), m_Height(height) {
+    m_Desc.maxScale = std::clamp(m_Desc.maxScale, 0.1f, 2.0f);
+    m_Desc.minScale = std::clamp(m_Desc.minScale, 0.1f, m_Desc.maxScale);
+
+    try {
+        m_UpscaleShader = std::make_unique<Shader>("shaders/Upscale.vert", "shaders/Upscale.frag");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_ERROR("No se pudo crear el shader de escalado: {0}", e.what());
+        return;
+    }
+
+    // Si falta el archivo el constructor no lanza: el programa queda a 0
+    if (m_UpscaleShader->GetRendererID() == 0) {
+        DESTINY_CORE_ERROR("Shader de escalado no disponible");
+        m_UpscaleShader.reset();
+        return;
+    }
+
+    m_UpscaleShader->Bind();
+    m_UpscaleShader->SetInt("u_Scene", 0);
+    m_UpscaleShader->Unbind();
+
+    // El triángulo de pantalla completa sale de gl_VertexID, pero el perfil core exige un VAO
+    glGenVertexArrays(1, &m_EmptyVAO);
+    glGenQueries(QueryCount, m_Queries.data());
+
+    if (!CreateTargets())
+        return;
+
+    ApplyScale(m_Desc.maxScale);
+    DESTINY_CORE_INFO("Resolución dinámica: escala {0}-{1}, presupuesto {2} ms", m_Desc.minScale, m_Desc.maxScale,
+                      m_Desc.targetFrameMs);
+}
+
+DynamicResolution::~DynamicResolution() {
+    DestroyTargets();
+    if (m_EmptyVAO) {
+        glDeleteQueries(QueryCount, m_Queries.data());
+        glDeleteVertexArrays(1, &m_EmptyVAO);
+    }
+}
+
+bool DynamicResolution::CreateTargets() {
+    m_TargetWidth = std::max(1u, static_cast<uint32_t>(std::ceil(m_Width * m_Desc.maxScale)));
+    m_TargetHeight = std::max(1u, static_cast<uint32_t>(std::ceil(m_Height * m_Desc.maxScale)));
+
+    glGenTextures(1, &m_ColorTexture);
+    glBindTexture(GL_TEXTURE_2D, m_ColorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_TargetWidth, m_TargetHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &m_DepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_DepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, m_TargetWidth, m_TargetHeight);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &m_Framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_DepthBuffer);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        DESTINY_CORE_ERROR("Framebuffer de resolución dinámica incompleto: {0}", status);
+        DestroyTargets();
+        return false;
+    }
+    return true;
+}
+
+void DynamicResolution::DestroyTargets() {
+    glDeleteFramebuffers(1, &m_Framebuffer);
+    glDeleteRenderbuffers(1, &m_DepthBuffer);
+    glDeleteTextures(1, &m_ColorTexture);
+    m_Framebuffer = 0;
+    m_DepthBuffer = 0;
+    m_ColorTexture = 0;
+}
+
+void DynamicResolution::Resize(uint32_t width, uint32_t height) {
+    if (width == m_Width && height == m_Height)
+        return;
+
+    m_Width = std::max(width, 1u);
+    m_Height = std::max(height, 1u);
+    if (!m_UpscaleShader)
+        return;
+
+    DestroyTargets();
+    if (CreateTargets())
+        ApplyScale(m_Scale);
+}
+
+void DynamicResolution::SetScaleRange(float minScale, float maxScale) {
+    float previousMax = m_Desc.maxScale;
+    m_Desc.maxScale = std::clamp(maxScale, 0.1f, 2.0f);
+    m_Desc.minScale = std::clamp(minScale, 0.1f, m_Desc.maxScale);
+    if (!m_UpscaleShader)
+        return;
+
+    if (m_Desc.maxScale != previousMax) {
+        DestroyTargets();
+        if (!CreateTargets())
+            return;
+    }
+    ApplyScale(m_Scale);
+}
+
+void DynamicResolution::SetFilter(UpscaleFilter filter, float sharpness) {
+    m_Desc.filter = filter;
+    m_Desc.sharpness = std::clamp(sharpness, 0.0f, 1.0f);
+}
+
+void DynamicResolution::ApplyScale(float scale) {
+    scale = std::clamp(scale, m_Desc.minScale, m_Desc.maxScale);
+
+    m_RenderWidth = std::clamp(static_cast<uint32_t>(std::lround(m_Width * scale)), 1u, m_TargetWidth);
+    m_RenderHeight = std::clamp(static_cast<uint32_t>(std::lround(m_Height * scale)), 1u, m_TargetHeight);
+    m_Scale = scale;
+
+    m_Stats.scale = m_Scale;
+    m_Stats.renderWidth = m_RenderWidth;
+    m_Stats.renderHeight = m_RenderHeight;
+}
+
+void DynamicResolution::BeginScene() {
+    if (!IsValid())
+        return;
+
+    CollectTimings();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_Framebuffer);
+    glViewport(0, 0, m_RenderWidth, m_RenderHeight);
+
+    // Si la query de este hueco aún no tiene resultado, este frame no se mide
+    m_QueryActive = !m_QueryPending[m_QueryIndex];
+    if (m_QueryActive) {
+        m_QueryScales[m_QueryIndex] = m_Scale;
+        glBeginQuery(GL_TIME_ELAPSED, m_Queries[m_QueryIndex]);
+    }
+}
+
+void DynamicResolution::EndScene() {
+    if (!IsValid())
+        return;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, m_Width, m_Height);
+
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean blend = glIsEnabled(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+
+    float uvScaleX = static_cast<float>(m_RenderWidth) / m_TargetWidth;
+    float uvScaleY = static_cast<float>(m_RenderHeight) / m_TargetHeight;
+    float sharpness = m_Desc.filter == UpscaleFilter::Sharpen ? m_Desc.sharpness : 0.0f;
+
+    m_UpscaleShader->Bind();
+    m_UpscaleShader->SetFloat2("u_UVScale", { uvScaleX, uvScaleY });
+    m_UpscaleShader->SetFloat2("u_UVMax", { uvScaleX - 0.5f / m_TargetWidth, uvScaleY - 0.5f / m_TargetHeight });
+    m_UpscaleShader->SetFloat2("u_TexelSize", { 1.0f / m_TargetWidth, 1.0f / m_TargetHeight });
+    m_UpscaleShader->SetFloat("u_Sharpness", sharpness);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_ColorTexture);
+    glBindVertexArray(m_EmptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    m_UpscaleShader->Unbind();
+
+    if (depthTest)
+        glEnable(GL_DEPTH_TEST);
+    if (blend)
+        glEnable(GL_BLEND);
+
+    // La medida incluye el escalado: es coste de GPU que también hay que pagar
+    if (m_QueryActive) {
+        glEndQuery(GL_TIME_ELAPSED);
+        m_QueryPending[m_QueryIndex] = true;
+        m_QueryIndex = (m_QueryIndex + 1) % QueryCount;
+        m_QueryActive = false;
+    }
+}
+
+void DynamicResolution::CollectTimings() {
+    // De la más antigua a la más reciente; las posteriores a una sin resultado tampoco lo tienen
+    for (uint32_t i = 0; i < QueryCount; i++) {
+        uint32_t slot = (m_QueryIndex + i) % QueryCount;
+        if (!m_QueryPending[slot])
+            continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(m_Queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            break;
+
+        GLuint64 nanoseconds = 0;
+        glGetQueryObjectui64v(m_Queries[slot], GL_QUERY_RESULT, &nanoseconds);
+        m_QueryPending[slot] = false;
+        UpdateScale(static_cast<float>(nanoseconds) * 1.0e-6f, m_QueryScales[slot]);
+    }
+}
+
+void DynamicResolution::UpdateScale(float gpuMs, float scale) {
+    m_Stats.gpuMs = gpuMs;
+
+    // El coste crece con los píxeles: normalizar a escala 1 permite comparar
+    // medidas hechas a escalas distintas (las queries llegan con frames de retraso)
+    float cost = gpuMs / (scale * scale);
+
+    // Los primeros frames incluyen compilación de shaders y subidas: no cuentan
+    if (m_WarmupSamples > 0) {
+        m_WarmupSamples--;
+        return;
+    }
+
+    if (m_CostPerFullFrame <= 0.0f)
+        m_CostPerFullFrame = cost;
+    else {
+        // Subidas rápidas (la batalla empieza ya), bajadas lentas (evitar oscilar).
+        // Un tirón aislado (carga, cambio de ventana) no puede hundir la escala de golpe
+        cost = std::min(cost, m_CostPerFullFrame * 4.0f);
+        float weight = cost > m_CostPerFullFrame ? 0.5f : 0.1f;
+        m_CostPerFullFrame += (cost - m_CostPerFullFrame) * weight;
+    }
+
+    float predictedMs = m_CostPerFullFrame * m_Scale * m_Scale;
+    m_Stats.smoothedMs = predictedMs;
+
+    if (m_Cooldown > 0) {
+        m_Cooldown--;
+        return;
+    }
+
+    // Escala que deja un 10% de margen en el presupuesto
+    float desired = std::sqrt(m_Desc.targetFrameMs * 0.9f / m_CostPerFullFrame);
+    desired = std::clamp(desired, m_Desc.minScale, m_Desc.maxScale);
+
+    float next = m_Scale;
+    if (predictedMs > m_Desc.targetFrameMs)
+        next = desired;
+    else if (desired > m_Scale + 0.05f)
+        next = std::min(desired, m_Scale + 0.05f);   // Subir poco a poco
+
+    if (std::fabs(next - m_Scale) < 0.01f)
+        return;
+
+    ApplyScale(next);
+    m_Stats.scaleChanges++;
+    m_Cooldown = QueryCount;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace Destiny {
+
+class Shader;
+
+enum class UpscaleFilter {
+    Bilinear = 0,
+    Sharpen
+};
+
+struct DynamicResolutionDesc {
+    float minScale = 0.5f;             // Fracción del lado de la ventana
+    float maxScale = 1.0f;
+    float targetFrameMs = 14.0f;       // Presupuesto de GPU de la escena más el escalado
+    UpscaleFilter filter = UpscaleFilter::Sharpen;
+    float sharpness = 0.35f;
+};
+
+// Resolución dinámica. La escena se dibuja en un FBO reservado a maxScale y cada
+// frame se usa sólo un viewport de scale * ventana, así que cambiar de escala no
+// recrea nada. Un controlador lee los tiempos de GPU con timer queries (con unos
+// frames de retraso, sin bloquear), los normaliza por píxel y elige la escala que
+// cabe en el presupuesto. EndScene escala al framebuffer de la ventana; la UI se
+// dibuja después, a resolución nativa.
+class DynamicResolution {
+public:
+    DynamicResolution(uint32_t width, uint32_t height, const DynamicResolutionDesc& desc = DynamicResolutionDesc());
+    ~DynamicResolution();
+
+    // No permitir copia
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    bool IsValid() const { return m_Framebuffer != 0; }
+
+    // Tamaño de la ventana
+    void Resize(uint32_t width, uint32_t height);
+
+    // Entre BeginScene y EndScene se dibuja el mundo; después de EndScene, la UI
+    void BeginScene();
+    void EndScene();
+
+    void SetScaleRange(float minScale, float maxScale);
+    void SetTargetFrameMs(float ms) { m_Desc.targetFrameMs = ms; }
+    void SetFilter(UpscaleFilter filter, float sharpness);
+
+    float GetScale() const { return m_Scale; }
+    uint32_t GetRenderWidth() const { return m_RenderWidth; }
+    uint32_t GetRenderHeight() const { return m_RenderHeight; }
+
+    // Estadísticas
+    struct Stats {
+        float scale = 1.0f;
+        float gpuMs = 0.0f;            // Última medida leída (de un frame anterior)
+        float smoothedMs = 0.0f;       // Coste filtrado reescalado a la escala actual
+        uint32_t renderWidth = 0;
+        uint32_t renderHeight = 0;
+        uint32_t scaleChanges = 0;     // Acumulado
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+    // Frames de latencia que admiten las timer queries antes de reutilizarse
+    static constexpr uint32_t QueryCount = 4;
+
+private:
+    bool CreateTargets();
+    void DestroyTargets();
+    void CollectTimings();
+    void UpdateScale(float gpuMs, float scale);
+    void ApplyScale(float scale);
+
+    DynamicResolutionDesc m_Desc;
+    uint32_t m_Width;
+    uint32_t m_Height;
+
+    // Render target reservado a maxScale
+    uint32_t m_Framebuffer = 0;
+    uint32_t m_ColorTexture = 0;
+    uint32_t m_DepthBuffer = 0;
+    uint32_t m_TargetWidth = 0;
+    uint32_t m_TargetHeight = 0;
+
+    std::unique_ptr<Shader> m_UpscaleShader;
+    uint32_t m_EmptyVAO = 0;
+
+    float m_Scale = 1.0f;
+    uint32_t m_RenderWidth = 0;
+    uint32_t m_RenderHeight = 0;
+
+    // Timer queries en anillo y la escala con la que se midió cada una
+    std::array<uint32_t, QueryCount> m_Queries{};
+    std::array<float, QueryCount> m_QueryScales{};
+    std::array<bool, QueryCount> m_QueryPending{};
+    uint32_t m_QueryIndex = 0;
+    bool m_QueryActive = false;
+
+    // Coste por frame a escala 1 (ms / scale^2), filtrado
+    float m_CostPerFullFrame = 0.0f;
+    uint32_t m_Cooldown = 0;
+    uint32_t m_WarmupSamples = QueryCount;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
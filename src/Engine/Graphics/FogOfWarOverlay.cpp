@@ -0,0 +1,108 @@
+#include "FogOfWarOverlay.h"
+#include "Renderer.h"
+#include "Texture.h"
+#include "../Visibility/VisibilityGrid.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <chrono>
+
+namespace Destiny {
+
+FogOfWarOverlay::FogOfWarOverlay(VisibilityGrid& grid)
+    : m_Grid(grid) {
+    m_Texture = std::make_shared<Texture>(grid.GetWidth(), grid.GetHeight(), 1);
+    m_Texture->SetLinearFiltering(true);
+    m_Pixels.resize(static_cast<size_t>(grid.GetWidth()) * grid.GetHeight());
+
+    // La densidad va al alfa; el color sale del tinte del quad
+    GLint swizzle[4] = { GL_ONE, GL_ONE, GL_ONE, GL_RED };
+    glBindTexture(GL_TEXTURE_2D, m_Texture->GetRendererID());
+    glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void FogOfWarOverlay::SetExploredDensity(float density) {
+    uint8_t value = static_cast<uint8_t>(std::clamp(density, 0.0f, 1.0f) * 255.0f + 0.5f);
+    if (value == m_ExploredDensity)
+        return;
+
+    m_ExploredDensity = value;
+    m_FullUpload = true;
+}
+
+void FogOfWarOverlay::Update(uint32_t player) {
+    auto start = std::chrono::high_resolution_clock::now();
+    m_Stats.rowsUploaded = 0;
+
+    uint32_t firstRow = 0;
+    uint32_t lastRow = 0;
+    bool dirty = m_Grid.ConsumeDirtyRows(player, firstRow, lastRow);
+
+    if (player != m_Player || m_FullUpload) {
+        m_Player = player;
+        m_FullUpload = false;
+        firstRow = 0;
+        lastRow = m_Grid.GetHeight() - 1;
+        dirty = true;
+    }
+
+    if (dirty) {
+        ConvertRows(firstRow, lastRow);
+
+        // La fila 0 de la textura es la de abajo, igual que la fila 0 de la rejilla
+        uint32_t width = m_Grid.GetWidth();
+        m_Texture->SetSubData(0, firstRow, width, lastRow - firstRow + 1, &m_Pixels[static_cast<size_t>(firstRow) * width]);
+        m_Stats.rowsUploaded = lastRow - firstRow + 1;
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.uploadMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void FogOfWarOverlay::ConvertRows(uint32_t firstRow, uint32_t lastRow) {
+    const uint32_t width = m_Grid.GetWidth();
+    const uint32_t wordsPerRow = m_Grid.GetWordsPerRow();
+    const uint64_t* visible = m_Grid.GetVisibleBits(m_Player);
+    const uint64_t* explored = m_Grid.GetExploredBits(m_Player);
+
+    // Densidad indexada por (explorado << 1 | visible)
+    const uint8_t density[4] = { 255, 0, m_ExploredDensity, 0 };
+
+    for (uint32_t y = firstRow; y <= lastRow; y++) {
+        const uint64_t* visibleRow = visible + static_cast<size_t>(y) * wordsPerRow;
+        const uint64_t* exploredRow = explored + static_cast<size_t>(y) * wordsPerRow;
+        uint8_t* pixels = &m_Pixels[static_cast<size_t>(y) * width];
+
+        for (uint32_t w = 0; w < wordsPerRow; w++) {
+            uint64_t v = visibleRow[w];
+            uint64_t e = exploredRow[w];
+            uint32_t x0 = w * 64;
+            uint32_t count = std::min(64u, width - x0);
+
+            // Palabras uniformes (todo oculto o todo visible) de una vez
+            if ((v | e) == 0 || v == ~0ull) {
+                std::fill_n(pixels + x0, count, v ? density[1] : density[0]);
+                continue;
+            }
+
+            for (uint32_t bit = 0; bit < count; bit++)
+                pixels[x0 + bit] = density[((e >> bit) & 1) << 1 | ((v >> bit) & 1)];
+        }
+    }
+}
+
+void FogOfWarOverlay::Submit(Renderer& renderer) {
+    glm::vec2 size = glm::vec2(m_Grid.GetWidth(), m_Grid.GetHeight()) * m_Grid.GetCellSize();
+    const glm::vec2& origin = m_Grid.GetOrigin();
+
+    QuadBatchInput input;
+    input.positionX = &origin.x;
+    input.positionY = &origin.y;
+    input.sizeX = &size.x;
+    input.sizeY = &size.y;
+    input.color = m_Color;
+    renderer.DrawQuads(input, 1, m_Texture);
+}
+
+} // namespace Destiny
\ No newline at end of file
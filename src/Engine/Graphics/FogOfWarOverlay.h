@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class Renderer;
+class Texture;
+class VisibilityGrid;
+
+// Dibujo de la niebla de guerra de un jugador. Convierte los bitsets de
+// VisibilityGrid en una textura R8 de una celda por píxel (densidad de niebla) y
+// sólo vuelve a subir las filas que cambiaron. La textura lleva un swizzle
+// (1, 1, 1, R), así que el shader de quads del batch la tiñe con el color de la
+// niebla sin shader propio; el filtrado bilineal suaviza los bordes.
+class FogOfWarOverlay {
+public:
+    explicit FogOfWarOverlay(VisibilityGrid& grid);
+    ~FogOfWarOverlay() = default;
+
+    // No permitir copia
+    FogOfWarOverlay(const FogOfWarOverlay&) = delete;
+    FogOfWarOverlay& operator=(const FogOfWarOverlay&) = delete;
+
+    // Llamar después de VisibilityGrid::Update; cambiar de jugador sube la textura entera
+    void Update(uint32_t player);
+
+    // Un quad del tamaño del mapa (entre BeginScene y EndScene, encima del mundo)
+    void Submit(Renderer& renderer);
+
+    // Color de la niebla; el alfa se multiplica por la densidad
+    void SetColor(const glm::vec4& color) { m_Color = color; }
+    // Densidad de las celdas exploradas que ahora no se ven (0 = despejado, 1 = opaco)
+    void SetExploredDensity(float density);
+
+    const glm::vec4& GetColor() const { return m_Color; }
+    const std::shared_ptr<Texture>& GetTexture() const { return m_Texture; }
+
+    // Estadísticas del último Update
+    struct Stats {
+        uint32_t rowsUploaded = 0;
+        float uploadMs = 0.0f;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    void ConvertRows(uint32_t firstRow, uint32_t lastRow);
+
+    VisibilityGrid& m_Grid;
+    std::shared_ptr<Texture> m_Texture;
+    std::vector<uint8_t> m_Pixels;
+
+    uint32_t m_Player = 0xffffffff;
+    uint8_t m_ExploredDensity = 160;
+    bool m_FullUpload = true;
+    glm::vec4 m_Color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,248 @@
+#include "Font.h"
+#include "Texture.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Destiny {
+
+static constexpr float DistanceInfinity = 1.0e20f;
+
+// Transformada de distancia euclídea al cuadrado en 1D (Felzenszwalb y Huttenlocher)
+static void DistanceTransform1D(const float* f, float* d, uint32_t count, std::vector<uint32_t>& v, std::vector<float>& z) {
+    v.resize(count);
+    z.resize(count + 1);
+
+    uint32_t k = 0;
+    v[0] = 0;
+    z[0] = -DistanceInfinity;
+    z[1] = DistanceInfinity;
+
+    // z[0] = -infinito hace de centinela: el bucle nunca baja de la primera parábola
+    for (uint32_t q = 1; q < count; q++) {
+        float s = ((f[q] + static_cast<float>(q * q)) - (f[v[k]] + static_cast<float>(v[k] * v[k]))) / (2.0f * (q - v[k]));
+        while (s <= z[k]) {
+            k--;
+            s = ((f[q] + static_cast<float>(q * q)) - (f[v[k]] + static_cast<float>(v[k] * v[k]))) / (2.0f * (q - v[k]));
+        }
+
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = DistanceInfinity;
+    }
+
+    k = 0;
+    for (uint32_t q = 0; q < count; q++) {
+        while (z[k + 1] < static_cast<float>(q))
+            k++;
+        float delta = static_cast<float>(q) - static_cast<float>(v[k]);
+        d[q] = delta * delta + f[v[k]];
+    }
+}
+
+// grid: 0 en los píxeles objetivo, infinito en el resto; sale la distancia al cuadrado
+static void DistanceTransform2D(std::vector<float>& grid, uint32_t width, uint32_t height) {
+    std::vector<float> f(std::max(width, height)), d(std::max(width, height));
+    std::vector<uint32_t> v;
+    std::vector<float> z;
+
+    for (uint32_t x = 0; x < width; x++) {
+        for (uint32_t y = 0; y < height; y++)
+            f[y] = grid[y * width + x];
+        DistanceTransform1D(f.data(), d.data(), height, v, z);
+        for (uint32_t y = 0; y < height; y++)
+            grid[y * width + x] = d[y];
+    }
+
+    for (uint32_t y = 0; y < height; y++) {
+        DistanceTransform1D(&grid[y * width], d.data(), width, v, z);
+        std::copy_n(d.data(), width, &grid[y * width]);
+    }
+}
+
+Font::Font(const FontDesc& desc)
+    : m_Desc(desc) {
+    if (!Texture::LoadCoverage(desc.sheetPath, m_Sheet, m_SheetWidth, m_SheetHeight)) {
+        m_Sheet.clear();
+        return;
+    }
+
+    m_SheetColumns = m_SheetWidth / std::max(desc.cellWidth, 1u);
+    m_SheetGlyphs = m_SheetColumns * (m_SheetHeight / std::max(desc.cellHeight, 1u));
+
+    m_AtlasPixels.assign(static_cast<size_t>(desc.atlasSize) * desc.atlasSize * 4, 0);
+    for (size_t i = 0; i < m_AtlasPixels.size(); i += 4)
+        m_AtlasPixels[i] = m_AtlasPixels[i + 1] = m_AtlasPixels[i + 2] = 255;
+
+    m_Atlas = std::make_shared<Texture>(desc.atlasSize, desc.atlasSize);
+    m_Atlas->SetLinearFiltering(true);
+    m_AtlasDirty = true;
+
+    m_MissingGlyph.advance = 0.5f;
+
+    DESTINY_CORE_INFO("Fuente cargada: {0} ({1} glifos)", desc.sheetPath, m_SheetGlyphs);
+}
+
+Font::~Font() = default;
+
+const GlyphInfo& Font::GetGlyph(uint32_t codepoint) {
+    auto it = m_Glyphs.find(codepoint);
+    if (it != m_Glyphs.end())
+        return it->second;
+
+    if (!IsLoaded() || codepoint < m_Desc.firstCodepoint || codepoint - m_Desc.firstCodepoint >= m_SheetGlyphs)
+        return m_MissingGlyph;
+
+    GlyphInfo glyph;
+    if (!RasterizeGlyph(codepoint, glyph))
+        glyph.visible = false;
+
+    return m_Glyphs.emplace(codepoint, glyph).first->second;
+}
+
+void Font::UploadAtlas() {
+    if (!m_AtlasDirty || !m_Atlas)
+        return;
+
+    m_Atlas->SetData(m_AtlasPixels.data(), static_cast<uint32_t>(m_AtlasPixels.size()));
+    m_AtlasDirty = false;
+}
+
+bool Font::RasterizeGlyph(uint32_t codepoint, GlyphInfo& outGlyph) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    uint32_t index = codepoint - m_Desc.firstCodepoint;
+    uint32_t cellX = (index % m_SheetColumns) * m_Desc.cellWidth;
+    uint32_t cellY = (index / m_SheetColumns) * m_Desc.cellHeight;
+    auto coverage = [&](uint32_t x, uint32_t y) { return m_Sheet[(cellY + y) * m_SheetWidth + cellX + x]; };
+
+    // Columnas con tinta: dan el avance proporcional y recortan el glifo
+    uint32_t inkMin = m_Desc.cellWidth, inkMax = 0;
+    for (uint32_t y = 0; y < m_Desc.cellHeight; y++) {
+        for (uint32_t x = 0; x < m_Desc.cellWidth; x++) {
+            if (coverage(x, y) >= 128) {
+                inkMin = std::min(inkMin, x);
+                inkMax = std::max(inkMax, x);
+            }
+        }
+    }
+
+    float cellEm = 1.0f / m_Desc.cellHeight;
+    if (inkMin > inkMax) {
+        outGlyph.advance = m_Desc.monospace ? m_Desc.cellWidth * cellEm : 0.3f;
+        return true;
+    }
+
+    uint32_t firstColumn = m_Desc.monospace ? 0 : inkMin;
+    uint32_t columns = m_Desc.monospace ? m_Desc.cellWidth : inkMax - inkMin + 1;
+    outGlyph.advance = m_Desc.monospace ? m_Desc.cellWidth * cellEm : columns * cellEm + m_Desc.letterSpacing;
+
+    // Píxeles de la hoja por píxel del atlas y margen para que quepa el campo
+    float scale = static_cast<float>(m_Desc.cellHeight) / m_Desc.glyphPixels;
+    uint32_t padding = static_cast<uint32_t>(std::ceil(m_Desc.spread)) + 1;
+    uint32_t sourcePadding = static_cast<uint32_t>(std::ceil(padding * scale));
+
+    uint32_t width = columns + 2 * sourcePadding;
+    uint32_t height = m_Desc.cellHeight + 2 * sourcePadding;
+    m_DistanceToInk.assign(static_cast<size_t>(width) * height, DistanceInfinity);
+    m_DistanceToEmpty.assign(static_cast<size_t>(width) * height, 0.0f);
+
+    for (uint32_t y = 0; y < m_Desc.cellHeight; y++) {
+        for (uint32_t x = 0; x < columns; x++) {
+            if (coverage(firstColumn + x, y) >= 128) {
+                size_t i = static_cast<size_t>(y + sourcePadding) * width + x + sourcePadding;
+                m_DistanceToInk[i] = 0.0f;
+                m_DistanceToEmpty[i] = DistanceInfinity;
+            }
+        }
+    }
+
+    DistanceTransform2D(m_DistanceToInk, width, height);
+    DistanceTransform2D(m_DistanceToEmpty, width, height);
+
+    // Distancia con signo en píxeles de la hoja: positiva dentro, negativa fuera
+    std::vector<float>& signedDistance = m_DistanceToInk;
+    for (size_t i = 0; i < signedDistance.size(); i++) {
+        float toInk = std::sqrt(m_DistanceToInk[i]);
+        float toEmpty = std::sqrt(m_DistanceToEmpty[i]);
+        signedDistance[i] = toEmpty > 0.0f ? toEmpty - 0.5f : 0.5f - toInk;
+    }
+
+    uint32_t glyphWidth = static_cast<uint32_t>(std::ceil(columns / scale)) + 2 * padding;
+    uint32_t glyphHeight = m_Desc.glyphPixels + 2 * padding;
+
+    uint32_t atlasX, atlasY;
+    if (!AllocateRegion(glyphWidth, glyphHeight, atlasX, atlasY))
+        return false;
+
+    // Muestreo bilineal en el centro de cada píxel del atlas
+    float normalize = 0.5f / (m_Desc.spread * scale);
+    float origin = static_cast<float>(sourcePadding) - padding * scale;
+    for (uint32_t y = 0; y < glyphHeight; y++) {
+        float sy = std::clamp(origin + (y + 0.5f) * scale - 0.5f, 0.0f, static_cast<float>(height - 1));
+        uint32_t y0 = static_cast<uint32_t>(sy);
+        uint32_t y1 = std::min(y0 + 1, height - 1);
+        float fy = sy - y0;
+
+        // La hoja va de arriba abajo y el atlas de abajo arriba
+        uint8_t* row = &m_AtlasPixels[(static_cast<size_t>(atlasY + glyphHeight - 1 - y) * m_Desc.atlasSize + atlasX) * 4];
+
+        for (uint32_t x = 0; x < glyphWidth; x++) {
+            float sx = std::clamp(origin + (x + 0.5f) * scale - 0.5f, 0.0f, static_cast<float>(width - 1));
+            uint32_t x0 = static_cast<uint32_t>(sx);
+            uint32_t x1 = std::min(x0 + 1, width - 1);
+            float fx = sx - x0;
+
+            float top = signedDistance[y0 * width + x0] * (1.0f - fx) + signedDistance[y0 * width + x1] * fx;
+            float bottom = signedDistance[y1 * width + x0] * (1.0f - fx) + signedDistance[y1 * width + x1] * fx;
+            float distance = top * (1.0f - fy) + bottom * fy;
+
+            row[x * 4 + 3] = static_cast<uint8_t>(std::clamp(0.5f + distance * normalize, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+    }
+
+    float atlasSize = static_cast<float>(m_Desc.atlasSize);
+    float pixelEm = 1.0f / m_Desc.glyphPixels;
+    outGlyph.offset = glm::vec2(-static_cast<float>(padding) * pixelEm);
+    outGlyph.size = glm::vec2(glyphWidth * pixelEm, glyphHeight * pixelEm);
+    outGlyph.texRect = glm::vec4(atlasX / atlasSize, atlasY / atlasSize,
+                                 (atlasX + glyphWidth) / atlasSize, (atlasY + glyphHeight) / atlasSize);
+    outGlyph.visible = true;
+
+    m_AtlasDirty = true;
+    m_Stats.glyphCount++;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.rasterizeMs += std::chrono::duration<float, std::milli>(end - start).count();
+    return true;
+}
+
+bool Font::AllocateRegion(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY) {
+    if (m_AtlasFull)
+        return false;
+
+    // Estante nuevo si no cabe en el actual (1 píxel de separación entre glifos)
+    if (m_ShelfX + width > m_Desc.atlasSize) {
+        m_ShelfY += m_ShelfHeight + 1;
+        m_ShelfX = 0;
+        m_ShelfHeight = 0;
+    }
+
+    if (width > m_Desc.atlasSize || m_ShelfY + height > m_Desc.atlasSize) {
+        DESTINY_CORE_WARN("Atlas de la fuente lleno: {0}", m_Desc.sheetPath);
+        m_AtlasFull = true;
+        return false;
+    }
+
+    outX = m_ShelfX;
+    outY = m_ShelfY;
+    m_ShelfX += width + 1;
+    m_ShelfHeight = std::max(m_ShelfHeight, height);
+    m_Stats.atlasRowsUsed = m_ShelfY + m_ShelfHeight;
+    return true;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class Texture;
+
+// Fuente a partir de una hoja de glifos: un TGA con los caracteres en rejilla,
+// claros sobre fondo oscuro o transparente, en orden de codepoint
+struct FontDesc {
+    std::string sheetPath;
+    uint32_t cellWidth = 32;           // Píxeles de cada celda en la hoja
+    uint32_t cellHeight = 32;
+    uint32_t firstCodepoint = 32;
+
+    uint32_t glyphPixels = 32;         // Alto de cada glifo en el atlas
+    float spread = 4.0f;               // Alcance del campo en píxeles del atlas a cada lado del borde
+    uint32_t atlasSize = 512;
+
+    bool monospace = false;            // false = avance según la tinta de cada glifo
+    float letterSpacing = 0.06f;       // Em
+    float lineSpacing = 0.2f;          // Em
+};
+
+// Métricas de un glifo en em (1 em = alto de celda)
+struct GlyphInfo {
+    glm::vec2 offset = glm::vec2(0.0f);    // Esquina inferior izquierda del quad respecto al lápiz
+    glm::vec2 size = glm::vec2(0.0f);
+    glm::vec4 texRect = glm::vec4(0.0f);   // minU, minV, maxU, maxV en el atlas
+    float advance = 0.0f;
+    bool visible = false;                  // false = espacio o glifo sin hueco en el atlas
+};
+
+// Atlas de campos de distancia con caché de glifos. Cada glifo se convierte la
+// primera vez que se pide: transformada de distancia exacta sobre la cobertura de
+// la hoja y muestreo al tamaño del atlas. Los glifos no se mueven nunca dentro del
+// atlas, así que las regiones guardadas por TextRenderer siguen siendo válidas.
+class Font {
+public:
+    explicit Font(const FontDesc& desc);
+    ~Font();
+
+    // No permitir copia
+    Font(const Font&) = delete;
+    Font& operator=(const Font&) = delete;
+
+    bool IsLoaded() const { return !m_Sheet.empty(); }
+
+    const GlyphInfo& GetGlyph(uint32_t codepoint);
+    float GetLineHeight() const { return 1.0f + m_Desc.lineSpacing; }
+
+    // Subir el atlas si hay glifos nuevos desde la última llamada
+    void UploadAtlas();
+    const std::shared_ptr<Texture>& GetAtlas() const { return m_Atlas; }
+
+    // Estadísticas
+    struct Stats {
+        uint32_t glyphCount = 0;
+        uint32_t atlasRowsUsed = 0;
+        float rasterizeMs = 0.0f;      // Acumulado
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    bool RasterizeGlyph(uint32_t codepoint, GlyphInfo& outGlyph);
+    bool AllocateRegion(uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY);
+
+    FontDesc m_Desc;
+
+    // Hoja de glifos en cobertura de 8 bits, fila 0 arriba
+    std::vector<uint8_t> m_Sheet;
+    uint32_t m_SheetWidth = 0;
+    uint32_t m_SheetHeight = 0;
+    uint32_t m_SheetColumns = 0;
+    uint32_t m_SheetGlyphs = 0;
+
+    std::unordered_map<uint32_t, GlyphInfo> m_Glyphs;
+    GlyphInfo m_MissingGlyph;
+
+    // Atlas RGBA (blanco, distancia en alfa), fila 0 abajo; estantes de izquierda a derecha
+    std::shared_ptr<Texture> m_Atlas;
+    std::vector<uint8_t> m_AtlasPixels;
+    uint32_t m_ShelfX = 0;
+    uint32_t m_ShelfY = 0;
+    uint32_t m_ShelfHeight = 0;
+    bool m_AtlasDirty = false;
+    bool m_AtlasFull = false;
+
+    // Buffers de trabajo de la transformada de distancia
+    std::vector<float> m_DistanceToInk;
+    std::vector<float> m_DistanceToEmpty;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "Lighting2D.h"
+#include "Shader.h"
+#include "../Core/Log.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace Destiny {
+
+Lighting2D::Lighting2D(uint32_t maxLights)
+    : m_MaxLights(maxLights) {
+    glGenBuffers(1, &m_Buffer);
+    glGenTextures(1, &m_Texture);
+}
+
+Lighting2D::~Lighting2D() {
+    glDeleteTextures(1, &m_Texture);
+    glDeleteBuffers(1, &m_Buffer);
+}
+
+void Lighting2D::AddLight(const glm::vec2& position, float radius, const glm::vec3& color, float intensity) {
+    if (m_PositionX.size() >= m_MaxLights)
+        return;
+
+    m_PositionX.push_back(position.x);
+    m_PositionY.push_back(position.y);
+    m_Radius.push_back(radius);
+    m_Colors.emplace_back(color.x, color.y, color.z, intensity);
+}
+
+void Lighting2D::Clear() {
+    m_PositionX.clear();
+    m_PositionY.clear();
+    m_Radius.clear();
+    m_Colors.clear();
+}
+
+void Lighting2D::Build(const glm::mat4& viewProjection, const glm::ivec4& viewport) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    uint32_t lightCount = static_cast<uint32_t>(m_PositionX.size());
+    float width = static_cast<float>(std::max(viewport.z, 1));
+    float height = static_cast<float>(std::max(viewport.w, 1));
+    m_TilesX = (static_cast<uint32_t>(width) + TileSize - 1) / TileSize;
+    m_TilesY = (static_cast<uint32_t>(height) + TileSize - 1) / TileSize;
+    uint32_t tileCount = m_TilesX * m_TilesY;
+
+    // Mundo -> píxeles relativos al viewport: transformación afín (ortográfica)
+    float ax = viewProjection[0][0] * 0.5f * width, bx = viewProjection[1][0] * 0.5f * width;
+    float cx = (viewProjection[3][0] * 0.5f + 0.5f) * width;
+    float ay = viewProjection[0][1] * 0.5f * height, by = viewProjection[1][1] * 0.5f * height;
+    float cy = (viewProjection[3][1] * 0.5f + 0.5f) * height;
+    float radiusScale = std::sqrt(ax * ax + ay * ay);
+
+    m_ScreenX.resize(lightCount);
+    m_ScreenY.resize(lightCount);
+    m_ScreenRadius.resize(lightCount);
+    m_TileMinX.resize(lightCount);
+    m_TileMinY.resize(lightCount);
+    m_TileMaxX.resize(lightCount);
+    m_TileMaxY.resize(lightCount);
+
+    // 1. Posición en píxeles y rango de tiles de cada luz
+    const float invTile = 1.0f / TileSize;
+    uint32_t i = 0;
+
+#ifdef DESTINY_SIMD_X86
+    __m128 vax = _mm_set1_ps(ax), vbx = _mm_set1_ps(bx), vcx = _mm_set1_ps(cx);
+    __m128 vay = _mm_set1_ps(ay), vby = _mm_set1_ps(by), vcy = _mm_set1_ps(cy);
+    __m128 vscale = _mm_set1_ps(radiusScale);
+    __m128 vinv = _mm_set1_ps(invTile);
+    __m128 zero = _mm_setzero_ps();
+    __m128 maxTileX = _mm_set1_ps(static_cast<float>(m_TilesX - 1));
+    __m128 maxTileY = _mm_set1_ps(static_cast<float>(m_TilesY - 1));
+
+    for (; i + 4 <= lightCount; i += 4) {
+        __m128 x = _mm_loadu_ps(&m_PositionX[i]);
+        __m128 y = _mm_loadu_ps(&m_PositionY[i]);
+        __m128 sx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vax, x), _mm_mul_ps(vbx, y)), vcx);
+        __m128 sy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vay, x), _mm_mul_ps(vby, y)), vcy);
+        __m128 sr = _mm_mul_ps(_mm_loadu_ps(&m_Radius[i]), vscale);
+        _mm_storeu_ps(&m_ScreenX[i], sx);
+        _mm_storeu_ps(&m_ScreenY[i], sy);
+        _mm_storeu_ps(&m_ScreenRadius[i], sr);
+
+        // Acotar antes de truncar: con valores >= 0 truncar es floor. Las luces
+        // fuera de pantalla quedan con min > max y se descartan después
+        __m128 minX = _mm_mul_ps(_mm_sub_ps(sx, sr), vinv);
+        __m128 maxX = _mm_mul_ps(_mm_add_ps(sx, sr), vinv);
+        __m128 minY = _mm_mul_ps(_mm_sub_ps(sy, sr), vinv);
+        __m128 maxY = _mm_mul_ps(_mm_add_ps(sy, sr), vinv);
+        __m128i tileMinX = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(minX, zero), _mm_add_ps(maxTileX, _mm_set1_ps(1.0f))));
+        __m128i tileMinY = _mm_cvttps_epi32(_mm_min_ps(_mm_max_ps(minY, zero), _mm_add_ps(maxTileY, _mm_set1_ps(1.0f))));
+        __m128i tileMaxX = _mm_cvttps_epi32(_mm_min_ps(maxX, maxTileX));
+        __m128i tileMaxY = _mm_cvttps_epi32(_mm_min_ps(maxY, maxTileY));
+        // Negativos: truncar hacia cero daría 0; se marcan como -1
+        tileMaxX = _mm_or_si128(tileMaxX, _mm_castps_si128(_mm_cmplt_ps(maxX, zero)));
+        tileMaxY = _mm_or_si128(tileMaxY, _mm_castps_si128(_mm_cmplt_ps(maxY, zero)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_TileMinX[i]), tileMinX);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_TileMinY[i]), tileMinY);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_TileMaxX[i]), tileMaxX);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_TileMaxY[i]), tileMaxY);
+    }
+#endif
+
+    for (; i < lightCount; i++) {
+        float sx = ax * m_PositionX[i] + bx * m_PositionY[i] + cx;
+        float sy = ay * m_PositionX[i] + by * m_PositionY[i] + cy;
+        float sr = m_Radius[i] * radiusScale;
+        m_ScreenX[i] = sx;
+        m_ScreenY[i] = sy;
+        m_ScreenRadius[i] = sr;
+
+        float maxX = (sx + sr) * invTile;
+        float maxY = (sy + sr) * invTile;
+        m_TileMinX[i] = static_cast<int32_t>(std::min(std::max((sx - sr) * invTile, 0.0f), static_cast<float>(m_TilesX)));
+        m_TileMinY[i] = static_cast<int32_t>(std::min(std::max((sy - sr) * invTile, 0.0f), static_cast<float>(m_TilesY)));
+        m_TileMaxX[i] = maxX < 0.0f ? -1 : static_cast<int32_t>(std::min(maxX, static_cast<float>(m_TilesX - 1)));
+        m_TileMaxY[i] = maxY < 0.0f ? -1 : static_cast<int32_t>(std::min(maxY, static_cast<float>(m_TilesY - 1)));
+    }
+
+    // 2. Compactar las visibles y contar luces por tile (círculo contra rectángulo del tile)
+    m_TileCounts.assign(tileCount, 0);
+    m_VisibleColors.resize(lightCount);
+    uint32_t visible = 0;
+    for (uint32_t light = 0; light < lightCount; light++) {
+        if (m_TileMinX[light] > m_TileMaxX[light] || m_TileMinY[light] > m_TileMaxY[light] ||
+            m_ScreenRadius[light] <= 0.0f)
+            continue;
+
+        m_ScreenX[visible] = m_ScreenX[light];
+        m_ScreenY[visible] = m_ScreenY[light];
+        m_ScreenRadius[visible] = m_ScreenRadius[light];
+        m_TileMinX[visible] = m_TileMinX[light];
+        m_TileMinY[visible] = m_TileMinY[light];
+        m_TileMaxX[visible] = m_TileMaxX[light];
+        m_TileMaxY[visible] = m_TileMaxY[light];
+        m_VisibleColors[visible] = m_Colors[light];
+        visible++;
+    }
+
+    auto touches = [&](uint32_t light, int32_t tx, int32_t ty) {
+        float nearestX = std::clamp(m_ScreenX[light], static_cast<float>(tx * TileSize), static_cast<float>((tx + 1) * TileSize));
+        float nearestY = std::clamp(m_ScreenY[light], static_cast<float>(ty * TileSize), static_cast<float>((ty + 1) * TileSize));
+        float dx = m_ScreenX[light] - nearestX;
+        float dy = m_ScreenY[light] - nearestY;
+        return dx * dx + dy * dy <= m_ScreenRadius[light] * m_ScreenRadius[light];
+    };
+
+    for (uint32_t light = 0; light < visible; light++) {
+        for (int32_t ty = m_TileMinY[light]; ty <= m_TileMaxY[light]; ty++) {
+            for (int32_t tx = m_TileMinX[light]; tx <= m_TileMaxX[light]; tx++) {
+                if (touches(light, tx, ty))
+                    m_TileCounts[ty * m_TilesX + tx]++;
+            }
+        }
+    }
+
+    // 3. Cabeceras (inicio y número de índices), datos de luces y listas de índices
+    m_Stats = {};
+    uint32_t totalIndices = 0;
+    for (uint32_t tile = 0; tile < tileCount; tile++) {
+        uint32_t count = m_TileCounts[tile];
+        if (count == 0)
+            continue;
+
+        m_Stats.litTiles++;
+        m_Stats.maxLightsPerTile = std::max(m_Stats.maxLightsPerTile, count);
+        m_Stats.overflowTiles += count > MaxLightsPerTile ? 1 : 0;
+        totalIndices += std::min(count, MaxLightsPerTile);
+    }
+
+    m_DataOffset = tileCount;
+    m_IndexOffset = m_DataOffset + visible * 2;
+    uint32_t texelCount = m_IndexOffset + (totalIndices + 3) / 4;
+    m_Upload.assign(static_cast<size_t>(std::max(texelCount, 1u)) * 4, 0.0f);
+
+    uint32_t offset = 0;
+    for (uint32_t tile = 0; tile < tileCount; tile++) {
+        uint32_t count = std::min(m_TileCounts[tile], MaxLightsPerTile);
+        m_Upload[tile * 4 + 0] = static_cast<float>(offset);
+        m_Upload[tile * 4 + 1] = static_cast<float>(count);
+        offset += count;
+        m_TileCounts[tile] = 0;   // Se reutiliza como cursor de relleno
+    }
+
+    for (uint32_t light = 0; light < visible; light++) {
+        float* data = &m_Upload[static_cast<size_t>(m_DataOffset + light * 2) * 4];
+        data[0] = m_ScreenX[light];
+        data[1] = m_ScreenY[light];
+        data[2] = m_ScreenRadius[light];
+        data[3] = m_VisibleColors[light].w;
+        data[4] = m_VisibleColors[light].x;
+        data[5] = m_VisibleColors[light].y;
+        data[6] = m_VisibleColors[light].z;
+    }
+
+    float* indices = &m_Upload[static_cast<size_t>(m_IndexOffset) * 4];
+    for (uint32_t light = 0; light < visible; light++) {
+        for (int32_t ty = m_TileMinY[light]; ty <= m_TileMaxY[light]; ty++) {
+            for (int32_t tx = m_TileMinX[light]; tx <= m_TileMaxX[light]; tx++) {
+                uint32_t tile = ty * m_TilesX + tx;
+                if (m_TileCounts[tile] >= MaxLightsPerTile || !touches(light, tx, ty))
+                    continue;
+
+                uint32_t first = static_cast<uint32_t>(m_Upload[tile * 4]);
+                indices[first + m_TileCounts[tile]++] = static_cast<float>(light);
+            }
+        }
+    }
+
+    // Subida: un solo buffer, huérfano cada frame para no esperar a la GPU
+    size_t bytes = m_Upload.size() * sizeof(float);
+    glBindBuffer(GL_TEXTURE_BUFFER, m_Buffer);
+    if (bytes > m_BufferBytes) {
+        m_BufferBytes = std::max(bytes, m_BufferBytes * 2);
+        glBufferData(GL_TEXTURE_BUFFER, m_BufferBytes, nullptr, GL_STREAM_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, m_Texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, m_Buffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+    }
+    else {
+        glBufferData(GL_TEXTURE_BUFFER, m_BufferBytes, nullptr, GL_STREAM_DRAW);
+    }
+    glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, m_Upload.data());
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    m_Stats.lightCount = lightCount;
+    m_Stats.visibleLights = visible;
+    m_Stats.tileCount = tileCount;
+    m_Stats.averageLightsPerTile = m_Stats.litTiles ? static_cast<float>(totalIndices) / m_Stats.litTiles : 0.0f;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.buildMs = std::chrono::duration<float, std::milli>(end - start).count();
+
+    m_ViewportOrigin = glm::vec2(static_cast<float>(viewport.x), static_cast<float>(viewport.y));
+}
+
+void Lighting2D::Bind(Shader& shader, uint32_t textureUnit) const {
+    glActiveTexture(GL_TEXTURE0 + textureUnit);
+    glBindTexture(GL_TEXTURE_BUFFER, m_Texture);
+
+    shader.SetInt("u_Lights", static_cast<int>(textureUnit));
+    shader.SetInt("u_LightTilesX", static_cast<int>(m_TilesX));
+    shader.SetInt("u_LightTilesY", static_cast<int>(m_TilesY));
+    shader.SetInt("u_LightDataOffset", static_cast<int>(m_DataOffset));
+    shader.SetInt("u_LightIndexOffset", static_cast<int>(m_IndexOffset));
+    shader.SetFloat2("u_LightOrigin", m_ViewportOrigin);
+    shader.SetFloat3("u_Ambient", m_Ambient);
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class Shader;
+
+// Luces puntuales 2D repartidas en tiles de pantalla. Cada frame se envían las
+// luces (antorchas, fogonazos, hechizos), Build las pasa a píxeles, las asigna a
+// los tiles que tocan (SSE2 para los rangos, prueba círculo-rectángulo por tile)
+// y sube en un único buffer de textura las cabeceras de los tiles, las listas de
+// índices y los datos de las luces. La variante iluminada del shader de quads
+// (QuadLit.frag) sólo recorre la lista de su propio tile, así que el coste
+// depende de las luces por tile y no del total.
+class Lighting2D {
+public:
+    explicit Lighting2D(uint32_t maxLights = 4096);
+    ~Lighting2D();
+
+    // No permitir copia
+    Lighting2D(const Lighting2D&) = delete;
+    Lighting2D& operator=(const Lighting2D&) = delete;
+
+    // Luces del frame en coordenadas de mundo; se descartan en Clear
+    void AddLight(const glm::vec2& position, float radius, const glm::vec3& color, float intensity = 1.0f);
+    void Clear();
+
+    void SetAmbient(const glm::vec3& ambient) { m_Ambient = ambient; }
+    const glm::vec3& GetAmbient() const { return m_Ambient; }
+
+    // Lo llama el renderer al vaciar la escena: viewport en píxeles del framebuffer
+    // activo (x, y, ancho, alto). Supone proyección ortográfica (w = 1)
+    void Build(const glm::mat4& viewProjection, const glm::ivec4& viewport);
+
+    // Enlaza el buffer en la unidad indicada y fija los uniforms u_Light* del shader
+    void Bind(Shader& shader, uint32_t textureUnit) const;
+
+    static constexpr uint32_t TileSize = 32;           // Píxeles
+    static constexpr uint32_t MaxLightsPerTile = 32;   // El resto de luces del tile se ignora
+
+    // Estadísticas del último Build
+    struct Stats {
+        uint32_t lightCount = 0;
+        uint32_t visibleLights = 0;
+        uint32_t tileCount = 0;
+        uint32_t litTiles = 0;             // Tiles con al menos una luz
+        uint32_t maxLightsPerTile = 0;
+        float averageLightsPerTile = 0.0f; // Sobre los tiles con luz
+        uint32_t overflowTiles = 0;        // Tiles que pasaron de MaxLightsPerTile
+        float buildMs = 0.0f;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    uint32_t m_MaxLights;
+    glm::vec3 m_Ambient = glm::vec3(1.0f);
+
+    // Luces del frame (SoA)
+    std::vector<float> m_PositionX, m_PositionY, m_Radius;
+    std::vector<glm::vec4> m_Colors;   // rgb, intensidad
+
+    // Luces visibles en píxeles y su rango de tiles. Build compacta aquí y nunca
+    // en las columnas de entrada, que siguen valiendo hasta Clear
+    std::vector<float> m_ScreenX, m_ScreenY, m_ScreenRadius;
+    std::vector<glm::vec4> m_VisibleColors;
+    std::vector<int32_t> m_TileMinX, m_TileMinY, m_TileMaxX, m_TileMaxY;
+
+    std::vector<uint32_t> m_TileCounts;
+    std::vector<float> m_Upload;       // RGBA32F: cabeceras, datos de luces e índices
+
+    uint32_t m_TilesX = 0;
+    uint32_t m_TilesY = 0;
+    uint32_t m_DataOffset = 0;         // En texels
+    uint32_t m_IndexOffset = 0;
+    glm::vec2 m_ViewportOrigin = glm::vec2(0.0f);
+
+    uint32_t m_Buffer = 0;
+    uint32_t m_Texture = 0;
+    size_t m_BufferBytes = 0;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
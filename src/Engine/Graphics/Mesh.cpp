@@ -0,0 +1,262 @@
+#include "Mesh.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Destiny {
+
+namespace {
+
+// Rejilla de (subdivisions + 1)^2 vértices centrada en center; u x v da la normal
+void AppendGrid(MeshData& mesh, const glm::vec3& center, const glm::vec3& u, const glm::vec3& v,
+                uint32_t subdivisions) {
+    glm::vec3 normal = glm::normalize(glm::cross(u, v));
+    uint32_t first = static_cast<uint32_t>(mesh.vertices.size());
+    uint32_t side = subdivisions + 1;
+
+    for (uint32_t j = 0; j <= subdivisions; j++) {
+        for (uint32_t i = 0; i <= subdivisions; i++) {
+            float s = static_cast<float>(i) / subdivisions;
+            float t = static_cast<float>(j) / subdivisions;
+
+            MeshVertex vertex;
+            vertex.position = center + u * (s - 0.5f) + v * (t - 0.5f);
+            vertex.normal = normal;
+            vertex.texCoord = glm::vec2(s, t);
+            mesh.vertices.push_back(vertex);
+        }
+    }
+
+    for (uint32_t j = 0; j < subdivisions; j++) {
+        for (uint32_t i = 0; i < subdivisions; i++) {
+            uint32_t v00 = first + j * side + i;
+            uint32_t v10 = v00 + 1;
+            uint32_t v01 = v00 + side;
+            uint32_t v11 = v01 + 1;
+            mesh.indices.insert(mesh.indices.end(), { v00, v10, v11, v11, v01, v00 });
+        }
+    }
+}
+
+// Parámetros de Forsyth ("Linear-Speed Vertex Cache Optimisation")
+constexpr uint32_t CacheSize = 32;
+constexpr float CacheDecayPower = 1.5f;
+constexpr float LastTriangleScore = 0.75f;
+constexpr float ValenceBoostScale = 2.0f;
+constexpr float ValenceBoostPower = 0.5f;
+
+float VertexScore(int32_t cachePosition, uint32_t remainingTriangles) {
+    if (remainingTriangles == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        // Los tres del último triángulo puntúan igual: su orden no se puede aprovechar
+        if (cachePosition < 3)
+            score = LastTriangleScore;
+        else
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / (CacheSize - 3), CacheDecayPower);
+    }
+
+    // Primero los vértices con pocos triángulos pendientes, para no dejar huecos sueltos
+    score += ValenceBoostScale * std::pow(static_cast<float>(remainingTriangles), -ValenceBoostPower);
+    return score;
+}
+
+} // namespace
+
+MeshData MeshGenerator::GenerateCube(uint32_t subdivisions) {
+    subdivisions = std::max(subdivisions, 1u);
+
+    MeshData mesh;
+    mesh.vertices.reserve(6 * (subdivisions + 1) * (subdivisions + 1));
+    mesh.indices.reserve(6 * 6 * subdivisions * subdivisions);
+
+    // Caras con bordes propios para que cada una tenga su normal
+    AppendGrid(mesh, { 0.5f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, { 0.0f, 1.0f, 0.0f }, subdivisions);
+    AppendGrid(mesh, { -0.5f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f }, subdivisions);
+    AppendGrid(mesh, { 0.0f, 0.5f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, subdivisions);
+    AppendGrid(mesh, { 0.0f, -0.5f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, subdivisions);
+    AppendGrid(mesh, { 0.0f, 0.0f, 0.5f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, subdivisions);
+    AppendGrid(mesh, { 0.0f, 0.0f, -0.5f }, { -1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, subdivisions);
+    return mesh;
+}
+
+MeshData MeshGenerator::GeneratePlane(uint32_t subdivisions) {
+    subdivisions = std::max(subdivisions, 1u);
+
+    MeshData mesh;
+    AppendGrid(mesh, glm::vec3(0.0f), { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, -1.0f }, subdivisions);
+    return mesh;
+}
+
+MeshData MeshGenerator::GenerateSphere(uint32_t segments, uint32_t rings) {
+    segments = std::max(segments, 3u);
+    rings = std::max(rings, 2u);
+
+    // Columna de costura duplicada para que las UV no den la vuelta
+    MeshData mesh;
+    mesh.vertices.reserve((segments + 1) * (rings + 1));
+    for (uint32_t ring = 0; ring <= rings; ring++) {
+        float v = static_cast<float>(ring) / rings;
+        float theta = v * glm::pi<float>();
+
+        for (uint32_t segment = 0; segment <= segments; segment++) {
+            float u = static_cast<float>(segment) / segments;
+            float phi = u * glm::two_pi<float>();
+
+            MeshVertex vertex;
+            vertex.normal = glm::vec3(std::cos(phi) * std::sin(theta), std::cos(theta), -std::sin(phi) * std::sin(theta));
+            vertex.position = vertex.normal * 0.5f;
+            vertex.texCoord = glm::vec2(u, 1.0f - v);
+            mesh.vertices.push_back(vertex);
+        }
+    }
+
+    // En los polos sólo un triángulo por segmento (el otro sería degenerado)
+    uint32_t side = segments + 1;
+    for (uint32_t ring = 0; ring < rings; ring++) {
+        for (uint32_t segment = 0; segment < segments; segment++) {
+            uint32_t top = ring * side + segment;
+            uint32_t bottom = top + side;
+
+            if (ring != 0)
+                mesh.indices.insert(mesh.indices.end(), { top, bottom + 1, top + 1 });
+            if (ring != rings - 1)
+                mesh.indices.insert(mesh.indices.end(), { top, bottom, bottom + 1 });
+        }
+    }
+    return mesh;
+}
+
+void MeshGenerator::OptimizeVertexCache(MeshData& mesh) {
+    uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    uint32_t triangleCount = static_cast<uint32_t>(mesh.indices.size() / 3);
+    if (triangleCount == 0)
+        return;
+
+    // Triángulos de cada vértice; remaining[v] es la parte viva de su lista
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (uint32_t index : mesh.indices)
+        remaining[index]++;
+
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    for (uint32_t v = 0; v < vertexCount; v++)
+        offsets[v + 1] = offsets[v] + remaining[v];
+
+    std::vector<uint32_t> adjacency(mesh.indices.size());
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (uint32_t i = 0; i < mesh.indices.size(); i++)
+        adjacency[cursor[mesh.indices[i]]++] = i / 3;
+
+    std::vector<int32_t> cachePosition(vertexCount, -1);
+    std::vector<float> vertexScore(vertexCount);
+    for (uint32_t v = 0; v < vertexCount; v++)
+        vertexScore[v] = VertexScore(-1, remaining[v]);
+
+    std::vector<float> triangleScore(triangleCount, 0.0f);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    for (uint32_t i = 0; i < mesh.indices.size(); i++)
+        triangleScore[i / 3] += vertexScore[mesh.indices[i]];
+
+    uint32_t best = static_cast<uint32_t>(std::max_element(triangleScore.begin(), triangleScore.end()) - triangleScore.begin());
+    uint32_t scanCursor = 0;
+
+    std::vector<uint32_t> output;
+    output.reserve(mesh.indices.size());
+    std::vector<uint32_t> cache, nextCache;
+    cache.reserve(CacheSize + 3);
+    nextCache.reserve(CacheSize + 3);
+
+    for (uint32_t n = 0; n < triangleCount; n++) {
+        // Sin candidatos en caché: el siguiente pendiente en orden original
+        if (best == 0xffffffff) {
+            while (emitted[scanCursor])
+                scanCursor++;
+            best = scanCursor;
+        }
+
+        emitted[best] = 1;
+        const uint32_t* triangle = &mesh.indices[best * 3];
+        output.insert(output.end(), triangle, triangle + 3);
+
+        for (uint32_t k = 0; k < 3; k++) {
+            uint32_t v = triangle[k];
+            uint32_t* list = &adjacency[offsets[v]];
+            uint32_t* found = std::find(list, list + remaining[v], best);
+            std::swap(*found, list[remaining[v] - 1]);
+            remaining[v]--;
+        }
+
+        // LRU: el triángulo emitido delante, el resto detrás sin repetidos
+        nextCache.assign(triangle, triangle + 3);
+        for (uint32_t v : cache) {
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+                nextCache.push_back(v);
+        }
+        std::swap(cache, nextCache);
+
+        for (uint32_t i = 0; i < cache.size(); i++) {
+            uint32_t v = cache[i];
+            cachePosition[v] = i < CacheSize ? static_cast<int32_t>(i) : -1;
+
+            float score = VertexScore(cachePosition[v], remaining[v]);
+            float delta = score - vertexScore[v];
+            vertexScore[v] = score;
+            for (uint32_t t = 0; t < remaining[v]; t++)
+                triangleScore[adjacency[offsets[v] + t]] += delta;
+        }
+
+        best = 0xffffffff;
+        float bestScore = -1.0f;
+        if (cache.size() > CacheSize)
+            cache.resize(CacheSize);
+
+        for (uint32_t v : cache) {
+            for (uint32_t t = 0; t < remaining[v]; t++) {
+                uint32_t candidate = adjacency[offsets[v] + t];
+                if (triangleScore[candidate] > bestScore) {
+                    bestScore = triangleScore[candidate];
+                    best = candidate;
+                }
+            }
+        }
+    }
+
+    mesh.indices.swap(output);
+}
+
+void MeshGenerator::OptimizeVertexFetch(MeshData& mesh) {
+    std::vector<uint32_t> remap(mesh.vertices.size(), 0xffffffff);
+    std::vector<MeshVertex> vertices;
+    vertices.reserve(mesh.vertices.size());
+
+    // Los vértices sin usar se descartan
+    for (uint32_t& index : mesh.indices) {
+        if (remap[index] == 0xffffffff) {
+            remap[index] = static_cast<uint32_t>(vertices.size());
+            vertices.push_back(mesh.vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    mesh.vertices.swap(vertices);
+}
+
+float MeshGenerator::ComputeACMR(const MeshData& mesh, uint32_t cacheSize) {
+    uint32_t triangleCount = static_cast<uint32_t>(mesh.indices.size() / 3);
+    if (triangleCount == 0)
+        return 0.0f;
+
+    // Marca de tiempo de la última carga: en caché si entró hace menos de cacheSize fallos
+    std::vector<uint32_t> loadedAt(mesh.vertices.size(), 0);
+    uint32_t misses = 0;
+    for (uint32_t index : mesh.indices) {
+        if (loadedAt[index] == 0 || misses - loadedAt[index] >= cacheSize)
+            loadedAt[index] = ++misses;
+    }
+
+    return static_cast<float>(misses) / triangleCount;
+}
+
+} // namespace Destiny
\ No newline at end of file
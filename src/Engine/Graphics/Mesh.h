@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+// Vértice intercalado de las mallas 3D (36 bytes). El color RGBA8 es blanco en
+// las primitivas; los lotes estáticos lo usan para fundir objetos de distinto color.
+struct MeshVertex {
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec2 texCoord;
+    uint32_t color = 0xffffffff;
+};
+
+struct MeshData {
+    std::vector<MeshVertex> vertices;
+    std::vector<uint32_t> indices;       // Triángulos en sentido antihorario vistos desde fuera
+};
+
+enum class MeshPrimitive {
+    Cube = 0,
+    Plane,
+    Sphere,
+    Count
+};
+
+// Geometría básica procedural y optimización de índices.
+// Las primitivas tienen tamaño unidad centradas en el origen: cubo de lado 1,
+// plano de 1x1 en XZ mirando a +Y y esfera de radio 0.5.
+class MeshGenerator {
+public:
+    // subdivisions: cuadrados por lado de cada cara
+    static MeshData GenerateCube(uint32_t subdivisions = 1);
+    static MeshData GeneratePlane(uint32_t subdivisions = 1);
+    // segments: divisiones en longitud; rings: en latitud
+    static MeshData GenerateSphere(uint32_t segments = 32, uint32_t rings = 16);
+
+    // Reordena los triángulos para la caché post-transformación (algoritmo de
+    // Forsyth: puntuación por posición en una LRU simulada y triángulos pendientes
+    // de cada vértice) y después los vértices por orden de primer uso, para que
+    // las lecturas del vertex fetch sean secuenciales
+    static void OptimizeVertexCache(MeshData& mesh);
+    static void OptimizeVertexFetch(MeshData& mesh);
+
+    // Vértices transformados por triángulo con una caché FIFO de cacheSize entradas
+    // (0.5 es el óptimo teórico en mallas regulares, 3 sin ninguna reutilización)
+    static float ComputeACMR(const MeshData& mesh, uint32_t cacheSize = 16);
+};
+
+} // namespace Destiny
\ No newline at end of file
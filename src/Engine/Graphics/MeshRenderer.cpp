@@ -0,0 +1,357 @@
+#include "MeshRenderer.h"
+#include "Shader.h"
+#include "../Core/Log.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+namespace Destiny {
+
+namespace {
+
+uint32_t PackColor(const glm::vec4& color) {
+    auto channel = [](float value) {
+        return static_cast<uint32_t>(std::min(std::max(value, 0.0f), 1.0f) * 255.0f + 0.5f);
+    };
+    return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) | (channel(color.a) << 24);
+}
+
+const char* GetPrimitiveName(MeshPrimitive primitive) {
+    switch (primitive) {
+        case MeshPrimitive::Cube: return "cubo";
+        case MeshPrimitive::Plane: return "plano";
+        case MeshPrimitive::Sphere: return "esfera";
+        default: return "?";
+    }
+}
+
+} // namespace
+
+MeshRenderer::MeshRenderer(const MeshRendererDesc& desc)
+    : m_Desc(desc) {
+    m_Desc.lodCount = std::min(std::max(m_Desc.lodCount, 1u), MaxLods);
+}
+
+MeshRenderer::~MeshRenderer() {
+    for (const StaticBatch& batch : m_StaticBatches) {
+        if (!batch.alive)
+            continue;
+        glDeleteVertexArrays(1, &batch.vao);
+        glDeleteBuffers(1, &batch.vbo);
+        glDeleteBuffers(1, &batch.ibo);
+    }
+
+    if (m_MeshVAO) {
+        glDeleteVertexArrays(1, &m_MeshVAO);
+        glDeleteBuffers(1, &m_MeshVBO);
+        glDeleteBuffers(1, &m_MeshIBO);
+        glDeleteBuffers(1, &m_InstanceBuffer);
+    }
+}
+
+bool MeshRenderer::Initialize() {
+    try {
+        m_Shader = std::make_unique<Shader>("shaders/Mesh.vert", "shaders/Mesh.frag");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_ERROR("No se pudo crear el shader de mallas: {0}", e.what());
+        return false;
+    }
+
+    // Un archivo que falta no lanza: queda el programa 0
+    if (m_Shader->GetRendererID() == 0) {
+        DESTINY_CORE_ERROR("Shader de mallas no disponible");
+        m_Shader.reset();
+        return false;
+    }
+
+    // Todas las primitivas y LOD en el mismo par de buffers
+    std::vector<MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+    uint32_t primitiveCount = static_cast<uint32_t>(MeshPrimitive::Count);
+
+    for (uint32_t primitive = 0; primitive < primitiveCount; primitive++) {
+        for (uint32_t lod = 0; lod < m_Desc.lodCount; lod++) {
+            MeshData mesh;
+            switch (static_cast<MeshPrimitive>(primitive)) {
+                case MeshPrimitive::Cube:
+                    mesh = MeshGenerator::GenerateCube(std::max(m_Desc.cubeSubdivisions >> lod, 1u));
+                    break;
+                case MeshPrimitive::Plane:
+                    mesh = MeshGenerator::GeneratePlane(std::max(m_Desc.planeSubdivisions >> lod, 1u));
+                    break;
+                default: {
+                    uint32_t segments = std::max(m_Desc.sphereSegments >> lod, 6u);
+                    mesh = MeshGenerator::GenerateSphere(segments, std::max(segments / 2, 3u));
+                    break;
+                }
+            }
+
+            float acmrBefore = MeshGenerator::ComputeACMR(mesh);
+            MeshGenerator::OptimizeVertexCache(mesh);
+            MeshGenerator::OptimizeVertexFetch(mesh);
+            if (lod == 0) {
+                DESTINY_CORE_INFO("Malla {0}: {1} triángulos, ACMR {2} -> {3}",
+                                  GetPrimitiveName(static_cast<MeshPrimitive>(primitive)),
+                                  mesh.indices.size() / 3, acmrBefore, MeshGenerator::ComputeACMR(mesh));
+            }
+
+            MeshRange range;
+            range.firstIndex = static_cast<uint32_t>(indices.size());
+            range.indexCount = static_cast<uint32_t>(mesh.indices.size());
+            range.baseVertex = static_cast<int32_t>(vertices.size());
+            m_Ranges.push_back(range);
+
+            vertices.insert(vertices.end(), mesh.vertices.begin(), mesh.vertices.end());
+            indices.insert(indices.end(), mesh.indices.begin(), mesh.indices.end());
+            m_MeshData.push_back(std::move(mesh));
+        }
+    }
+
+    glGenVertexArrays(1, &m_MeshVAO);
+    glBindVertexArray(m_MeshVAO);
+
+    glGenBuffers(1, &m_MeshVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_MeshVBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(MeshVertex), vertices.data(), GL_STATIC_DRAW);
+    SetupVertexAttributes();
+
+    glGenBuffers(1, &m_MeshIBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_MeshIBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+
+    // Atributos por instancia: matriz (4 columnas) y color; el puntero se fija en cada draw
+    glGenBuffers(1, &m_InstanceBuffer);
+    for (uint32_t location = 4; location <= 8; location++) {
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    m_InstanceQueues.resize(m_Ranges.size() * 2);
+    DESTINY_CORE_INFO("Mallas: {0} vértices y {1} índices compartidos ({2} LOD)",
+                      vertices.size(), indices.size(), m_Desc.lodCount);
+    return true;
+}
+
+void MeshRenderer::SetupVertexAttributes() {
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, normal));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, texCoord));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MeshVertex), (void*)offsetof(MeshVertex, color));
+}
+
+uint32_t MeshRenderer::CreateStaticBatch(const std::vector<StaticMeshInstance>& instances) {
+    if (!m_Shader) {
+        DESTINY_CORE_WARN("MeshRenderer sin inicializar: no se puede crear el lote estático");
+        return InvalidBatch;
+    }
+
+    // Fundir en mundo: posiciones transformadas, normales con la matriz de cofactores
+    // (inversa traspuesta salvo escala, válida con escalados no uniformes)
+    MeshData merged;
+    for (const StaticMeshInstance& instance : instances) {
+        uint32_t lod = std::min(instance.lod, m_Desc.lodCount - 1);
+        const MeshData& mesh = m_MeshData[static_cast<uint32_t>(instance.primitive) * m_Desc.lodCount + lod];
+
+        glm::mat3 model(instance.transform);
+        glm::mat3 normalMatrix(glm::cross(model[1], model[2]), glm::cross(model[2], model[0]),
+                               glm::cross(model[0], model[1]));
+        bool mirrored = glm::dot(model[0], glm::cross(model[1], model[2])) < 0.0f;
+        uint32_t color = PackColor(instance.color);
+        uint32_t base = static_cast<uint32_t>(merged.vertices.size());
+
+        for (const MeshVertex& source : mesh.vertices) {
+            MeshVertex vertex;
+            vertex.position = glm::vec3(instance.transform * glm::vec4(source.position, 1.0f));
+            vertex.normal = glm::normalize(normalMatrix * source.normal) * (mirrored ? -1.0f : 1.0f);
+            vertex.texCoord = source.texCoord;
+            vertex.color = color;
+            merged.vertices.push_back(vertex);
+        }
+
+        // Un espejo invierte el sentido de los triángulos
+        for (size_t i = 0; i < mesh.indices.size(); i += 3) {
+            merged.indices.push_back(base + mesh.indices[i]);
+            merged.indices.push_back(base + mesh.indices[mirrored ? i + 2 : i + 1]);
+            merged.indices.push_back(base + mesh.indices[mirrored ? i + 1 : i + 2]);
+        }
+    }
+
+    uint32_t id;
+    if (!m_FreeBatches.empty()) {
+        id = m_FreeBatches.back();
+        m_FreeBatches.pop_back();
+    }
+    else {
+        id = static_cast<uint32_t>(m_StaticBatches.size());
+        m_StaticBatches.emplace_back();
+    }
+
+    StaticBatch& batch = m_StaticBatches[id];
+    batch.indexCount = static_cast<uint32_t>(merged.indices.size());
+    batch.alive = true;
+
+    glGenVertexArrays(1, &batch.vao);
+    glBindVertexArray(batch.vao);
+
+    glGenBuffers(1, &batch.vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, batch.vbo);
+    glBufferData(GL_ARRAY_BUFFER, merged.vertices.size() * sizeof(MeshVertex), merged.vertices.data(), GL_STATIC_DRAW);
+    SetupVertexAttributes();
+
+    glGenBuffers(1, &batch.ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch.ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, merged.indices.size() * sizeof(uint32_t), merged.indices.data(), GL_STATIC_DRAW);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    DESTINY_CORE_INFO("Lote estático {0}: {1} objetos, {2} triángulos", id, instances.size(), batch.indexCount / 3);
+    return id;
+}
+
+void MeshRenderer::DestroyStaticBatch(uint32_t batch) {
+    if (batch >= m_StaticBatches.size() || !m_StaticBatches[batch].alive)
+        return;
+
+    StaticBatch& staticBatch = m_StaticBatches[batch];
+    glDeleteVertexArrays(1, &staticBatch.vao);
+    glDeleteBuffers(1, &staticBatch.vbo);
+    glDeleteBuffers(1, &staticBatch.ibo);
+    staticBatch = StaticBatch();
+    m_FreeBatches.push_back(batch);
+}
+
+void MeshRenderer::BeginScene(const glm::mat4& viewProjection, const glm::vec3& cameraPosition) {
+    m_ViewProjection = viewProjection;
+    m_CameraPosition = cameraPosition;
+}
+
+void MeshRenderer::DrawStaticBatch(uint32_t batch) {
+    if (batch < m_StaticBatches.size() && m_StaticBatches[batch].alive)
+        m_QueuedBatches.push_back(batch);
+}
+
+void MeshRenderer::DrawMesh(MeshPrimitive primitive, const glm::mat4& transform, const glm::vec4& color) {
+    if (m_InstanceQueues.empty())
+        return;
+
+    // Los espejos van en su propia cola: se dibujan con el sentido de los triángulos invertido
+    glm::mat3 model(transform);
+    bool mirrored = glm::dot(model[0], glm::cross(model[1], model[2])) < 0.0f;
+
+    float distance = glm::length(glm::vec3(transform[3]) - m_CameraPosition);
+    uint32_t range = static_cast<uint32_t>(primitive) * m_Desc.lodCount + SelectLod(distance);
+    m_InstanceQueues[range * 2 + (mirrored ? 1 : 0)].push_back({ transform, color });
+}
+
+uint32_t MeshRenderer::SelectLod(float distance) const {
+    uint32_t lod = 0;
+    for (float threshold = m_Desc.lodDistance; lod + 1 < m_Desc.lodCount && distance >= threshold; threshold *= 2.0f)
+        lod++;
+    return lod;
+}
+
+void MeshRenderer::EndScene() {
+    m_Stats = {};
+    if (!m_Shader) {
+        m_QueuedBatches.clear();
+        return;
+    }
+
+    glEnable(GL_CULL_FACE);
+    m_Shader->Bind();
+    m_Shader->SetMat4("u_ViewProjection", m_ViewProjection);
+    m_Shader->SetFloat3("u_LightDirection", m_LightDirection);
+    m_Shader->SetFloat("u_Ambient", m_Ambient);
+
+    // 1. Lotes estáticos: ya están en mundo, la "instancia" es la identidad en
+    //    los valores constantes de los atributos 4-8 (desactivados en su VAO)
+    glVertexAttrib4f(4, 1.0f, 0.0f, 0.0f, 0.0f);
+    glVertexAttrib4f(5, 0.0f, 1.0f, 0.0f, 0.0f);
+    glVertexAttrib4f(6, 0.0f, 0.0f, 1.0f, 0.0f);
+    glVertexAttrib4f(7, 0.0f, 0.0f, 0.0f, 1.0f);
+    glVertexAttrib4f(8, 1.0f, 1.0f, 1.0f, 1.0f);
+
+    for (uint32_t id : m_QueuedBatches) {
+        const StaticBatch& batch = m_StaticBatches[id];
+        if (!batch.alive)
+            continue;
+
+        glBindVertexArray(batch.vao);
+        glDrawElements(GL_TRIANGLES, batch.indexCount, GL_UNSIGNED_INT, nullptr);
+        m_Stats.drawCalls++;
+        m_Stats.staticBatchesDrawn++;
+        m_Stats.triangleCount += batch.indexCount / 3;
+    }
+    m_QueuedBatches.clear();
+
+    // 2. Instancias: todas las colas en un buffer, una llamada por primitiva, LOD y
+    //    orientación (normal o espejo)
+    m_InstanceUpload.clear();
+    for (const std::vector<MeshInstance>& queue : m_InstanceQueues)
+        m_InstanceUpload.insert(m_InstanceUpload.end(), queue.begin(), queue.end());
+
+    if (!m_InstanceUpload.empty()) {
+        glBindVertexArray(m_MeshVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, m_InstanceBuffer);
+
+        uint32_t count = static_cast<uint32_t>(m_InstanceUpload.size());
+        if (count > m_InstanceCapacity)
+            m_InstanceCapacity = std::max(count, m_InstanceCapacity * 2);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_InstanceCapacity) * sizeof(MeshInstance),
+                     nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(count) * sizeof(MeshInstance), m_InstanceUpload.data());
+
+        size_t offset = 0;
+        for (size_t key = 0; key < m_InstanceQueues.size(); key++) {
+            std::vector<MeshInstance>& queue = m_InstanceQueues[key];
+            if (queue.empty())
+                continue;
+
+            // Sin baseInstance (GL 4.2) se desplazan los punteros de instancia al tramo de la cola
+            size_t base = offset * sizeof(MeshInstance);
+            for (uint32_t column = 0; column < 4; column++) {
+                glVertexAttribPointer(4 + column, 4, GL_FLOAT, GL_FALSE, sizeof(MeshInstance),
+                                      (void*)(base + offsetof(MeshInstance, transform) + column * sizeof(glm::vec4)));
+            }
+            glVertexAttribPointer(8, 4, GL_FLOAT, GL_FALSE, sizeof(MeshInstance),
+                                  (void*)(base + offsetof(MeshInstance, color)));
+
+            bool mirrored = (key & 1) != 0;
+            if (mirrored)
+                glFrontFace(GL_CW);
+
+            const MeshRange& range = m_Ranges[key / 2];
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+                                              (void*)(static_cast<size_t>(range.firstIndex) * sizeof(uint32_t)),
+                                              static_cast<GLsizei>(queue.size()), range.baseVertex);
+
+            if (mirrored)
+                glFrontFace(GL_CCW);
+
+            m_Stats.drawCalls++;
+            m_Stats.instanceCount += static_cast<uint32_t>(queue.size());
+            m_Stats.triangleCount += range.indexCount / 3 * static_cast<uint32_t>(queue.size());
+            offset += queue.size();
+            queue.clear();
+        }
+
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    glBindVertexArray(0);
+    m_Shader->Unbind();
+    glDisable(GL_CULL_FACE);
+}
+
+} // namespace Destiny
\ No newline at end of file
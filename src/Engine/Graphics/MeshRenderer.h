@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Mesh.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class Shader;
+
+struct MeshRendererDesc {
+    // Teselado del LOD 0; cada nivel siguiente usa la mitad
+    uint32_t lodCount = 3;
+    uint32_t cubeSubdivisions = 4;
+    uint32_t planeSubdivisions = 16;
+    uint32_t sphereSegments = 48;     // Anillos = segmentos / 2
+    float lodDistance = 40.0f;        // LOD 1 desde esta distancia a la cámara, LOD 2 desde el doble...
+};
+
+// Objeto fijo del mapa (edificio, roca, muro) para fundir en un lote estático
+struct StaticMeshInstance {
+    MeshPrimitive primitive = MeshPrimitive::Cube;
+    uint32_t lod = 0;
+    glm::mat4 transform = glm::mat4(1.0f);
+    glm::vec4 color = glm::vec4(1.0f);
+};
+
+// Mallas 3D con pocas llamadas de dibujo. Todas las primitivas y sus LOD se
+// generan una vez al inicializar, se optimizan para la caché de vértices y se
+// guardan juntas en un único VBO/IBO intercalado (cada malla es un rango con su
+// vértice base). Los objetos fijos se funden al cargar el mapa en lotes estáticos
+// ya transformados a mundo, de una llamada cada uno; los objetos repetidos que se
+// mueven o aparecen (árboles, cajas, proyectiles) se dibujan con instancing, una
+// llamada por primitiva y LOD (otra más si hay instancias en espejo).
+class MeshRenderer {
+public:
+    explicit MeshRenderer(const MeshRendererDesc& desc = MeshRendererDesc());
+    ~MeshRenderer();
+
+    // No permitir copia
+    MeshRenderer(const MeshRenderer&) = delete;
+    MeshRenderer& operator=(const MeshRenderer&) = delete;
+
+    // Genera las mallas y crea el shader; requiere contexto de OpenGL
+    bool Initialize();
+
+    // Lotes estáticos: se construyen una vez al cargar
+    uint32_t CreateStaticBatch(const std::vector<StaticMeshInstance>& instances);
+    void DestroyStaticBatch(uint32_t batch);
+    static constexpr uint32_t InvalidBatch = 0xffffffff;
+
+    // Escena 3D: los objetos se acumulan y se dibujan en EndScene
+    void BeginScene(const glm::mat4& viewProjection, const glm::vec3& cameraPosition);
+    void DrawStaticBatch(uint32_t batch);
+    // El LOD se elige por la distancia de la cámara a la traslación de transform
+    void DrawMesh(MeshPrimitive primitive, const glm::mat4& transform, const glm::vec4& color = glm::vec4(1.0f));
+    void EndScene();
+
+    uint32_t SelectLod(float distance) const;
+
+    // Luz direccional simple (dirección hacia la que apunta la luz)
+    void SetLightDirection(const glm::vec3& direction) { m_LightDirection = glm::normalize(direction); }
+    void SetAmbient(float ambient) { m_Ambient = ambient; }
+
+    static constexpr uint32_t MaxLods = 8;
+
+    // Estadísticas del último EndScene
+    struct Stats {
+        uint32_t drawCalls = 0;
+        uint32_t triangleCount = 0;
+        uint32_t instanceCount = 0;
+        uint32_t staticBatchesDrawn = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    // Rango de una malla dentro de los buffers compartidos
+    struct MeshRange {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        int32_t baseVertex = 0;
+    };
+
+    // Mismo layout que los atributos 4-8 de Mesh.vert
+    struct MeshInstance {
+        glm::mat4 transform;
+        glm::vec4 color;
+    };
+
+    struct StaticBatch {
+        uint32_t vao = 0;
+        uint32_t vbo = 0;
+        uint32_t ibo = 0;
+        uint32_t indexCount = 0;
+        bool alive = false;
+    };
+
+    const MeshRange& GetRange(MeshPrimitive primitive, uint32_t lod) const {
+        return m_Ranges[static_cast<uint32_t>(primitive) * m_Desc.lodCount + lod];
+    }
+    static void SetupVertexAttributes();
+
+    MeshRendererDesc m_Desc;
+    std::unique_ptr<Shader> m_Shader;
+
+    // Geometría compartida de todas las primitivas y LOD
+    uint32_t m_MeshVAO = 0;
+    uint32_t m_MeshVBO = 0;
+    uint32_t m_MeshIBO = 0;
+    std::vector<MeshRange> m_Ranges;
+    std::vector<MeshData> m_MeshData;          // Copia en CPU para fundir lotes estáticos
+
+    // Instancing: dos colas por primitiva y LOD (índice de rango * 2 + espejo), subidas juntas a un buffer
+    uint32_t m_InstanceBuffer = 0;
+    uint32_t m_InstanceCapacity = 0;
+    std::vector<std::vector<MeshInstance>> m_InstanceQueues;
+    std::vector<MeshInstance> m_InstanceUpload;
+
+    std::vector<StaticBatch> m_StaticBatches;
+    std::vector<uint32_t> m_FreeBatches;
+    std::vector<uint32_t> m_QueuedBatches;
+
+    glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+    glm::vec3 m_CameraPosition = glm::vec3(0.0f);
+    glm::vec3 m_LightDirection = glm::normalize(glm::vec3(-0.4f, -1.0f, -0.3f));
+    float m_Ambient = 0.3f;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,239 @@
+#include "Minimap.h"
+#include "FogOfWarOverlay.h"
+#include "Renderer.h"
+#include "Texture.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Destiny {
+
+namespace {
+
+// Reparto de tiles entre texels de un eje: el texel t cubre los tiles
+// [FirstTile(t), FirstTile(t + 1)). Marcar y resolver usan las mismas dos funciones.
+constexpr uint32_t FirstTile(uint32_t texel, uint32_t tiles, uint32_t texels) {
+    return static_cast<uint32_t>(static_cast<uint64_t>(texel) * tiles / texels);
+}
+
+// Texel dueño del tile: el mayor t con FirstTile(t) <= tile
+constexpr uint32_t OwnerTexel(uint32_t tile, uint32_t tiles, uint32_t texels) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(tile + 1) * texels - 1) / tiles);
+}
+
+constexpr bool IsPartitionConsistent(uint32_t tiles, uint32_t texels) {
+    for (uint32_t tile = 0; tile < tiles; tile++) {
+        uint32_t texel = OwnerTexel(tile, tiles, texels);
+        if (texel >= texels || tile < FirstTile(texel, tiles, texels) || tile >= FirstTile(texel + 1, tiles, texels))
+            return false;
+    }
+    return true;
+}
+
+// Proporciones no enteras, donde un reparto distinto al marcar y al resolver falla
+static_assert(IsPartitionConsistent(300, 256), "Reparto de tiles 300 -> 256 incoherente");
+static_assert(IsPartitionConsistent(257, 256), "Reparto de tiles 257 -> 256 incoherente");
+static_assert(IsPartitionConsistent(1000, 3), "Reparto de tiles 1000 -> 3 incoherente");
+static_assert(IsPartitionConsistent(256, 256), "Reparto de tiles 256 -> 256 incoherente");
+
+} // namespace
+
+Minimap::Minimap(const MinimapDesc& desc)
+    : m_Desc(desc) {
+    // Reducir, nunca ampliar: cada texel cubre al menos un tile
+    m_TextureWidth = std::max(1u, std::min(desc.textureWidth, desc.mapWidth));
+    m_TextureHeight = std::max(1u, std::min(desc.textureHeight, desc.mapHeight));
+
+    m_Tiles.assign(static_cast<size_t>(desc.mapWidth) * desc.mapHeight, 0xff000000);
+    m_Pixels.assign(static_cast<size_t>(m_TextureWidth) * m_TextureHeight, 0xff000000);
+    m_Texture = std::make_shared<Texture>(m_TextureWidth, m_TextureHeight);
+    m_Texture->SetLinearFiltering(true);
+
+    m_BlocksX = (m_TextureWidth + BlockSize - 1) / BlockSize;
+    m_BlocksY = (m_TextureHeight + BlockSize - 1) / BlockSize;
+    m_DirtyBlocks.assign(static_cast<size_t>(m_BlocksX) * m_BlocksY, 1);
+
+    m_PlayerColors.fill(glm::vec4(1.0f));
+}
+
+void Minimap::SetTile(uint32_t x, uint32_t y, uint32_t rgba) {
+    if (x >= m_Desc.mapWidth || y >= m_Desc.mapHeight)
+        return;
+
+    uint32_t& tile = m_Tiles[static_cast<size_t>(y) * m_Desc.mapWidth + x];
+    if (tile == rgba)
+        return;
+
+    tile = rgba;
+    MarkTileDirty(x, y);
+}
+
+void Minimap::SetTiles(const uint32_t* rgba) {
+    std::memcpy(m_Tiles.data(), rgba, m_Tiles.size() * sizeof(uint32_t));
+    std::fill(m_DirtyBlocks.begin(), m_DirtyBlocks.end(), 1);
+    m_AnyDirty = true;
+}
+
+void Minimap::MarkTileDirty(uint32_t x, uint32_t y) {
+    uint32_t tx = OwnerTexel(x, m_Desc.mapWidth, m_TextureWidth);
+    uint32_t ty = OwnerTexel(y, m_Desc.mapHeight, m_TextureHeight);
+    m_DirtyBlocks[(ty / BlockSize) * m_BlocksX + tx / BlockSize] = 1;
+    m_AnyDirty = true;
+}
+
+void Minimap::ResolveTexel(uint32_t tx, uint32_t ty) {
+    // Tiles [x0, x1) x [y0, y1) que caen en este texel
+    uint32_t x0 = FirstTile(tx, m_Desc.mapWidth, m_TextureWidth);
+    uint32_t x1 = FirstTile(tx + 1, m_Desc.mapWidth, m_TextureWidth);
+    uint32_t y0 = FirstTile(ty, m_Desc.mapHeight, m_TextureHeight);
+    uint32_t y1 = FirstTile(ty + 1, m_Desc.mapHeight, m_TextureHeight);
+
+    uint32_t sum[4] = { 0, 0, 0, 0 };
+    for (uint32_t y = y0; y < y1; y++) {
+        const uint32_t* row = &m_Tiles[static_cast<size_t>(y) * m_Desc.mapWidth];
+        for (uint32_t x = x0; x < x1; x++) {
+            uint32_t tile = row[x];
+            sum[0] += tile & 0xff;
+            sum[1] += (tile >> 8) & 0xff;
+            sum[2] += (tile >> 16) & 0xff;
+            sum[3] += tile >> 24;
+        }
+    }
+
+    uint32_t count = (x1 - x0) * (y1 - y0);
+    uint32_t half = count / 2;
+    m_Pixels[static_cast<size_t>(ty) * m_TextureWidth + tx] =
+        ((sum[0] + half) / count) | (((sum[1] + half) / count) << 8) |
+        (((sum[2] + half) / count) << 16) | (((sum[3] + half) / count) << 24);
+}
+
+void Minimap::UploadDirtyBlocks() {
+    if (!m_AnyDirty)
+        return;
+
+    // Se recalculan sólo los bloques sucios, pero se sube la franja de filas
+    // completa de cada fila de bloques: es contigua y basta un glTexSubImage2D
+    for (uint32_t by = 0; by < m_BlocksY; by++) {
+        uint32_t rowFirst = by * BlockSize;
+        uint32_t rowEnd = std::min(rowFirst + BlockSize, m_TextureHeight);
+        bool rowDirty = false;
+
+        for (uint32_t bx = 0; bx < m_BlocksX; bx++) {
+            uint8_t& dirty = m_DirtyBlocks[by * m_BlocksX + bx];
+            if (!dirty)
+                continue;
+
+            dirty = 0;
+            rowDirty = true;
+            uint32_t colEnd = std::min((bx + 1) * BlockSize, m_TextureWidth);
+            for (uint32_t ty = rowFirst; ty < rowEnd; ty++) {
+                for (uint32_t tx = bx * BlockSize; tx < colEnd; tx++)
+                    ResolveTexel(tx, ty);
+            }
+            m_Stats.texelsUpdated += (colEnd - bx * BlockSize) * (rowEnd - rowFirst);
+        }
+
+        if (rowDirty) {
+            m_Texture->SetSubData(0, rowFirst, m_TextureWidth, rowEnd - rowFirst,
+                                  &m_Pixels[static_cast<size_t>(rowFirst) * m_TextureWidth]);
+            m_Stats.rowsUploaded += rowEnd - rowFirst;
+        }
+    }
+
+    m_AnyDirty = false;
+}
+
+bool Minimap::TickUnitRefresh(float deltaTime) {
+    m_UnitTimer -= deltaTime;
+    if (m_UnitTimer > 0.0f)
+        return false;
+
+    // Sin acumular retraso: tras un frame largo no se encadenan refrescos
+    float interval = m_Desc.unitRefreshHz > 0.0f ? 1.0f / m_Desc.unitRefreshHz : 0.0f;
+    m_UnitTimer = std::max(m_UnitTimer + interval, 0.0f);
+    return true;
+}
+
+void Minimap::SetUnits(const float* positionX, const float* positionY, const uint8_t* owners, uint32_t count) {
+    glm::vec2 worldSize = glm::vec2(static_cast<float>(m_Desc.mapWidth), static_cast<float>(m_Desc.mapHeight)) * m_Desc.tileSize;
+    float invWidth = 1.0f / worldSize.x;
+    float invHeight = 1.0f / worldSize.y;
+
+    m_MarkerU.resize(count);
+    m_MarkerV.resize(count);
+    m_MarkerColors.resize(static_cast<size_t>(count) * 4);
+
+    for (uint32_t i = 0; i < count; i++) {
+        m_MarkerU[i] = std::clamp((positionX[i] - m_Desc.worldOrigin.x) * invWidth, 0.0f, 1.0f);
+        m_MarkerV[i] = std::clamp((positionY[i] - m_Desc.worldOrigin.y) * invHeight, 0.0f, 1.0f);
+
+        const glm::vec4& color = m_PlayerColors[owners[i] & 7];
+        float* c = &m_MarkerColors[static_cast<size_t>(i) * 4];
+        c[0] = color.x;
+        c[1] = color.y;
+        c[2] = color.z;
+        c[3] = color.w;
+    }
+
+    m_MarkersChanged = true;
+}
+
+void Minimap::Submit(Renderer& renderer, const glm::vec2& position, const glm::vec2& size) {
+    auto start = std::chrono::high_resolution_clock::now();
+    bool unitsRefreshed = m_MarkersChanged;
+    m_Stats = {};
+
+    UploadDirtyBlocks();
+
+    QuadBatchInput background;
+    background.positionX = &position.x;
+    background.positionY = &position.y;
+    background.sizeX = &size.x;
+    background.sizeY = &size.y;
+    renderer.DrawQuads(background, 1, m_Texture);
+
+    if (m_Fog) {
+        QuadBatchInput fog = background;
+        fog.color = m_Fog->GetColor();
+        renderer.DrawQuads(fog, 1, m_Fog->GetTexture());
+    }
+
+    // Pasar los marcadores a pantalla sólo si cambiaron ellos o el rectángulo
+    glm::vec4 rect(position.x, position.y, size.x, size.y);
+    bool rectChanged = rect.x != m_MarkerRect.x || rect.y != m_MarkerRect.y ||
+                       rect.z != m_MarkerRect.z || rect.w != m_MarkerRect.w;
+    uint32_t markerCount = static_cast<uint32_t>(m_MarkerU.size());
+    if (m_MarkersChanged || rectChanged) {
+        m_MarkerX.resize(markerCount);
+        m_MarkerY.resize(markerCount);
+        m_MarkerSizeX.assign(markerCount, m_Desc.markerSize);
+        m_MarkerSizeY.assign(markerCount, m_Desc.markerSize);
+        // Los quads se colocan por la esquina inferior izquierda; el marcador va centrado en la unidad
+        glm::vec2 corner = position - glm::vec2(m_Desc.markerSize * 0.5f);
+        for (uint32_t i = 0; i < markerCount; i++) {
+            m_MarkerX[i] = corner.x + m_MarkerU[i] * size.x;
+            m_MarkerY[i] = corner.y + m_MarkerV[i] * size.y;
+        }
+        m_MarkerRect = rect;
+        m_MarkersChanged = false;
+    }
+
+    if (markerCount > 0) {
+        QuadBatchInput markers;
+        markers.positionX = m_MarkerX.data();
+        markers.positionY = m_MarkerY.data();
+        markers.sizeX = m_MarkerSizeX.data();
+        markers.sizeY = m_MarkerSizeY.data();
+        markers.colors = m_MarkerColors.data();
+        renderer.DrawQuads(markers, markerCount, nullptr);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.cpuMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.markerCount = markerCount;
+    m_Stats.unitsRefreshed = unitsRefreshed;
+    renderer.RecordMinimapStats(m_Stats.cpuMs, m_Stats.texelsUpdated);
+}
+
+} // namespace Destiny
\ No newline at end of file
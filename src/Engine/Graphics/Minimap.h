@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class FogOfWarOverlay;
+class Renderer;
+class Texture;
+
+struct MinimapDesc {
+    uint32_t mapWidth = 0;                 // Tiles
+    uint32_t mapHeight = 0;
+    float tileSize = 1.0f;                 // Unidades de mundo por tile
+    glm::vec2 worldOrigin = glm::vec2(0.0f);
+
+    uint32_t textureWidth = 256;           // Máximo; nunca más texels que tiles
+    uint32_t textureHeight = 256;
+
+    float unitRefreshHz = 10.0f;
+    float markerSize = 3.0f;               // Lado de cada marcador en unidades de la escena (píxeles en UI)
+};
+
+// Minimapa incremental. El terreno vive en una textura reducida (cada texel es
+// la media de los tiles que cubre) y sólo se recalculan y suben las franjas de
+// bloques marcadas por SetTile. Los marcadores de unidades se reconstruyen a
+// unitRefreshHz y en los frames intermedios se reutilizan tal cual; todo (terreno,
+// niebla y marcadores) sale en el mismo batch con tres llamadas a DrawQuads.
+class Minimap {
+public:
+    explicit Minimap(const MinimapDesc& desc);
+    ~Minimap() = default;
+
+    // No permitir copia
+    Minimap(const Minimap&) = delete;
+    Minimap& operator=(const Minimap&) = delete;
+
+    // Terreno: color RGBA8 empaquetado (r en el byte bajo) por tile, fila 0 abajo
+    void SetTile(uint32_t x, uint32_t y, uint32_t rgba);
+    void SetTiles(const uint32_t* rgba);
+
+    // Niebla del jugador local; su rejilla debe cubrir la misma zona que el mapa
+    void SetFogOfWar(const FogOfWarOverlay* fog) { m_Fog = fog; }
+
+    // Avanzar el reloj de los marcadores; true cuando toca llamar a SetUnits
+    bool TickUnitRefresh(float deltaTime);
+
+    // Posiciones en mundo y dueño de cada unidad (índice de SetPlayerColor)
+    void SetUnits(const float* positionX, const float* positionY, const uint8_t* owners, uint32_t count);
+    void SetPlayerColor(uint8_t player, const glm::vec4& color) { m_PlayerColors[player] = color; }
+
+    // position: esquina inferior izquierda en las coordenadas de la escena actual (cámara de UI)
+    void Submit(Renderer& renderer, const glm::vec2& position, const glm::vec2& size);
+
+    const std::shared_ptr<Texture>& GetTexture() const { return m_Texture; }
+
+    // Lado de los bloques de texels que se marcan sucios
+    static constexpr uint32_t BlockSize = 16;
+
+    // Estadísticas del último Submit
+    struct Stats {
+        float cpuMs = 0.0f;
+        uint32_t texelsUpdated = 0;
+        uint32_t rowsUploaded = 0;
+        uint32_t markerCount = 0;
+        bool unitsRefreshed = false;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    void MarkTileDirty(uint32_t x, uint32_t y);
+    void UploadDirtyBlocks();
+    void ResolveTexel(uint32_t tx, uint32_t ty);
+
+    MinimapDesc m_Desc;
+    uint32_t m_TextureWidth;
+    uint32_t m_TextureHeight;
+
+    std::vector<uint32_t> m_Tiles;
+    std::vector<uint32_t> m_Pixels;
+    std::shared_ptr<Texture> m_Texture;
+
+    uint32_t m_BlocksX;
+    uint32_t m_BlocksY;
+    std::vector<uint8_t> m_DirtyBlocks;
+    bool m_AnyDirty = true;
+
+    const FogOfWarOverlay* m_Fog = nullptr;
+
+    // Marcadores normalizados a [0, 1] en el último refresco
+    std::vector<float> m_MarkerU, m_MarkerV;
+    std::vector<float> m_MarkerColors;
+    // Los mismos en coordenadas de pantalla, válidos mientras no cambien rect ni marcadores
+    std::vector<float> m_MarkerX, m_MarkerY;
+    std::vector<float> m_MarkerSizeX, m_MarkerSizeY;
+    glm::vec4 m_MarkerRect = glm::vec4(-1.0f);
+    bool m_MarkersChanged = false;
+
+    std::array<glm::vec4, 8> m_PlayerColors;
+    float m_UnitTimer = 0.0f;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,310 @@
+#include "ParticleSystem.h"
+#include "Renderer.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace Destiny {
+
+// Integración de un rango de partículas: velocidad, rozamiento, posición y vida.
+// La versión SSE2 hace exactamente las mismas operaciones por carril.
+static void IntegrateParticles(float* positionX, float* positionY, float* velocityX, float* velocityY,
+                               float* life, uint32_t count, float deltaTime,
+                               const glm::vec2& acceleration, float damping) {
+    uint32_t i = 0;
+
+#ifdef DESTINY_SIMD_X86
+    __m128 dt = _mm_set1_ps(deltaTime);
+    __m128 accX = _mm_set1_ps(acceleration.x * deltaTime);
+    __m128 accY = _mm_set1_ps(acceleration.y * deltaTime);
+    __m128 damp = _mm_set1_ps(damping);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 vx = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityX + i), accX), damp);
+        __m128 vy = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocityY + i), accY), damp);
+        _mm_storeu_ps(velocityX + i, vx);
+        _mm_storeu_ps(velocityY + i, vy);
+        _mm_storeu_ps(positionX + i, _mm_add_ps(_mm_loadu_ps(positionX + i), _mm_mul_ps(vx, dt)));
+        _mm_storeu_ps(positionY + i, _mm_add_ps(_mm_loadu_ps(positionY + i), _mm_mul_ps(vy, dt)));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), dt));
+    }
+#endif
+
+    float accX1 = acceleration.x * deltaTime;
+    float accY1 = acceleration.y * deltaTime;
+    for (; i < count; i++) {
+        velocityX[i] = (velocityX[i] + accX1) * damping;
+        velocityY[i] = (velocityY[i] + accY1) * damping;
+        positionX[i] = positionX[i] + velocityX[i] * deltaTime;
+        positionY[i] = positionY[i] + velocityY[i] * deltaTime;
+        life[i] = life[i] - deltaTime;
+    }
+}
+
+// xorshift32 -> [0, 1)
+static inline float NextRandom(uint32_t& state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return static_cast<float>(state >> 8) * (1.0f / 16777216.0f);
+}
+
+ParticleSystem::ParticleSystem(uint32_t particleBudget, JobSystem* jobSystem)
+    : m_JobSystem(jobSystem), m_Budget(particleBudget) {
+}
+
+uint32_t ParticleSystem::CreateEmitter(const ParticleEmitterDesc& desc) {
+    if (desc.maxParticles == 0) {
+        DESTINY_CORE_WARN("Emisor de partículas sin capacidad");
+        return InvalidEmitter;
+    }
+
+    uint32_t index;
+    if (!m_FreeEmitters.empty()) {
+        index = m_FreeEmitters.back();
+        m_FreeEmitters.pop_back();
+        m_Emitters[index] = Emitter();
+    }
+    else {
+        index = static_cast<uint32_t>(m_Emitters.size());
+        m_Emitters.emplace_back();
+    }
+
+    // Pools reservados de una vez: Update no asigna memoria
+    Emitter& emitter = m_Emitters[index];
+    emitter.desc = desc;
+    emitter.active = true;
+    emitter.rngState = 0x9E3779B9u * (index + 1);
+
+    uint32_t capacity = desc.maxParticles;
+    emitter.positionX.resize(capacity);
+    emitter.positionY.resize(capacity);
+    emitter.velocityX.resize(capacity);
+    emitter.velocityY.resize(capacity);
+    emitter.life.resize(capacity);
+    emitter.invLifetime.resize(capacity);
+    emitter.drawX.resize(capacity);
+    emitter.drawY.resize(capacity);
+    emitter.drawSize.resize(capacity);
+    emitter.drawColor.resize(static_cast<size_t>(capacity) * 4);
+
+    return index;
+}
+
+void ParticleSystem::DestroyEmitter(uint32_t emitter) {
+    if (emitter >= m_Emitters.size() || !m_Emitters[emitter].active)
+        return;
+
+    m_Emitters[emitter] = Emitter();
+    m_FreeEmitters.push_back(emitter);
+}
+
+void ParticleSystem::SetEmitterPosition(uint32_t emitter, const glm::vec2& position) {
+    m_Emitters[emitter].desc.position = position;
+}
+
+void ParticleSystem::SetEmitterRate(uint32_t emitter, float rate) {
+    m_Emitters[emitter].desc.rate = rate;
+}
+
+void ParticleSystem::Burst(uint32_t emitter, uint32_t count) {
+    m_Emitters[emitter].pendingBurst += count;
+}
+
+void ParticleSystem::Update(float deltaTime) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    m_Stats.spawnedCount = 0;
+    m_Stats.droppedCount = 0;
+
+    // 1. Repartir el presupuesto entre los emisores (en orden, sobre las vivas del Update anterior)
+    uint32_t alive = 0;
+    for (const Emitter& emitter : m_Emitters)
+        alive += emitter.count;
+    uint32_t available = m_Budget > alive ? m_Budget - alive : 0;
+
+    for (Emitter& emitter : m_Emitters) {
+        if (!emitter.active)
+            continue;
+
+        emitter.spawnAccumulator += emitter.desc.rate * deltaTime;
+        uint32_t wanted = static_cast<uint32_t>(emitter.spawnAccumulator);
+        emitter.spawnAccumulator -= static_cast<float>(wanted);
+        wanted += emitter.pendingBurst;
+        emitter.pendingBurst = 0;
+
+        uint32_t room = emitter.desc.maxParticles - emitter.count;
+        uint32_t granted = std::min({ wanted, room, available });
+        available -= granted;
+        emitter.spawnCount = granted;
+
+        m_Stats.spawnedCount += granted;
+        m_Stats.droppedCount += wanted - granted;
+    }
+
+    // 2. Simular cada emisor de forma independiente
+    uint32_t emitterCount = static_cast<uint32_t>(m_Emitters.size());
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(emitterCount, 1, [this, deltaTime](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; i++)
+                UpdateEmitter(m_Emitters[i], deltaTime);
+        });
+    }
+    else {
+        for (Emitter& emitter : m_Emitters)
+            UpdateEmitter(emitter, deltaTime);
+    }
+
+    m_Stats.emitterCount = emitterCount - static_cast<uint32_t>(m_FreeEmitters.size());
+    m_Stats.aliveCount = 0;
+    for (const Emitter& emitter : m_Emitters)
+        m_Stats.aliveCount += emitter.count;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.updateMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void ParticleSystem::UpdateEmitter(Emitter& emitter, float deltaTime) const {
+    if (!emitter.active)
+        return;
+
+    const ParticleEmitterDesc& desc = emitter.desc;
+    float damping = std::max(0.0f, 1.0f - desc.drag * deltaTime);
+    IntegrateParticles(emitter.positionX.data(), emitter.positionY.data(),
+                       emitter.velocityX.data(), emitter.velocityY.data(),
+                       emitter.life.data(), emitter.count, deltaTime, desc.acceleration, damping);
+
+    // Compactar: se copia siempre y sólo avanza el destino si la partícula vive
+    float* positionX = emitter.positionX.data();
+    float* positionY = emitter.positionY.data();
+    float* velocityX = emitter.velocityX.data();
+    float* velocityY = emitter.velocityY.data();
+    float* life = emitter.life.data();
+    float* invLifetime = emitter.invLifetime.data();
+
+    uint32_t write = 0;
+    for (uint32_t i = 0; i < emitter.count; i++) {
+        uint32_t alive = life[i] > 0.0f;
+        positionX[write] = positionX[i];
+        positionY[write] = positionY[i];
+        velocityX[write] = velocityX[i];
+        velocityY[write] = velocityY[i];
+        life[write] = life[i];
+        invLifetime[write] = invLifetime[i];
+        write += alive;
+    }
+    emitter.count = write;
+
+    SpawnParticles(emitter);
+    PrepareDrawData(emitter);
+}
+
+void ParticleSystem::SpawnParticles(Emitter& emitter) const {
+    const ParticleEmitterDesc& desc = emitter.desc;
+    uint32_t first = emitter.count;
+    uint32_t last = first + emitter.spawnCount;
+
+    for (uint32_t i = first; i < last; i++) {
+        float angle = glm::radians(desc.direction + (NextRandom(emitter.rngState) - 0.5f) * desc.spread);
+        float speed = desc.speedMin + (desc.speedMax - desc.speedMin) * NextRandom(emitter.rngState);
+        float lifetime = desc.lifeMin + (desc.lifeMax - desc.lifeMin) * NextRandom(emitter.rngState);
+        lifetime = std::max(lifetime, 1.0e-3f);
+
+        emitter.positionX[i] = desc.position.x;
+        emitter.positionY[i] = desc.position.y;
+        emitter.velocityX[i] = std::cos(angle) * speed;
+        emitter.velocityY[i] = std::sin(angle) * speed;
+        emitter.life[i] = lifetime;
+        emitter.invLifetime[i] = 1.0f / lifetime;
+    }
+
+    emitter.count = last;
+    emitter.spawnCount = 0;
+}
+
+void ParticleSystem::PrepareDrawData(Emitter& emitter) const {
+    const ParticleEmitterDesc& desc = emitter.desc;
+
+    // Interpolación por edad normalizada. La versión SSE2 hace las mismas
+    // operaciones por carril; el color de cada partícula es un registro entero
+    const float sizeStart = desc.sizeStart;
+    const float sizeDelta = desc.sizeEnd - desc.sizeStart;
+    const glm::vec4 colorStart = desc.colorStart;
+    const glm::vec4 colorDelta = desc.colorEnd - desc.colorStart;
+
+    const uint32_t count = emitter.count;
+    const float* life = emitter.life.data();
+    const float* invLifetime = emitter.invLifetime.data();
+    const float* positionX = emitter.positionX.data();
+    const float* positionY = emitter.positionY.data();
+    float* drawSize = emitter.drawSize.data();
+    float* drawX = emitter.drawX.data();
+    float* drawY = emitter.drawY.data();
+    float* drawColor = emitter.drawColor.data();
+    uint32_t i = 0;
+
+#ifdef DESTINY_SIMD_X86
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128 start = _mm_set1_ps(sizeStart);
+    __m128 delta = _mm_set1_ps(sizeDelta);
+    __m128 colorBase = _mm_setr_ps(colorStart.x, colorStart.y, colorStart.z, colorStart.w);
+    __m128 colorStep = _mm_setr_ps(colorDelta.x, colorDelta.y, colorDelta.z, colorDelta.w);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 t = _mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(life + i), _mm_loadu_ps(invLifetime + i)));
+        __m128 size = _mm_add_ps(start, _mm_mul_ps(delta, t));
+        __m128 offset = _mm_mul_ps(size, half);
+
+        _mm_storeu_ps(drawSize + i, size);
+        _mm_storeu_ps(drawX + i, _mm_sub_ps(_mm_loadu_ps(positionX + i), offset));
+        _mm_storeu_ps(drawY + i, _mm_sub_ps(_mm_loadu_ps(positionY + i), offset));
+
+        float* color = &drawColor[static_cast<size_t>(i) * 4];
+        _mm_storeu_ps(color + 0,  _mm_add_ps(colorBase, _mm_mul_ps(colorStep, _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)))));
+        _mm_storeu_ps(color + 4,  _mm_add_ps(colorBase, _mm_mul_ps(colorStep, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)))));
+        _mm_storeu_ps(color + 8,  _mm_add_ps(colorBase, _mm_mul_ps(colorStep, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)))));
+        _mm_storeu_ps(color + 12, _mm_add_ps(colorBase, _mm_mul_ps(colorStep, _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 3, 3)))));
+    }
+#endif
+
+    for (; i < count; i++) {
+        float t = 1.0f - life[i] * invLifetime[i];
+        float size = sizeStart + sizeDelta * t;
+
+        drawSize[i] = size;
+        drawX[i] = positionX[i] - size * 0.5f;
+        drawY[i] = positionY[i] - size * 0.5f;
+
+        float* color = &drawColor[static_cast<size_t>(i) * 4];
+        color[0] = colorStart.x + colorDelta.x * t;
+        color[1] = colorStart.y + colorDelta.y * t;
+        color[2] = colorStart.z + colorDelta.z * t;
+        color[3] = colorStart.w + colorDelta.w * t;
+    }
+}
+
+void ParticleSystem::Submit(Renderer& renderer) const {
+    for (const Emitter& emitter : m_Emitters) {
+        if (!emitter.active || emitter.count == 0)
+            continue;
+
+        QuadBatchInput input;
+        input.positionX = emitter.drawX.data();
+        input.positionY = emitter.drawY.data();
+        input.sizeX = emitter.drawSize.data();
+        input.sizeY = emitter.drawSize.data();
+        input.colors = emitter.drawColor.data();
+        renderer.DrawQuads(input, emitter.count, emitter.desc.texture);
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class JobSystem;
+class Renderer;
+class Texture;
+
+// Parámetros de un emisor; los rangos [min, max] se muestrean por partícula
+struct ParticleEmitterDesc {
+    glm::vec2 position = glm::vec2(0.0f);
+    float rate = 0.0f;                   // Partículas por segundo (0 = sólo ráfagas)
+    uint32_t maxParticles = 1024;
+
+    float lifeMin = 1.0f, lifeMax = 1.0f;              // Segundos
+    float direction = 90.0f, spread = 360.0f;          // Grados
+    float speedMin = 0.0f, speedMax = 1.0f;
+    glm::vec2 acceleration = glm::vec2(0.0f);          // Gravedad, viento...
+    float drag = 0.0f;                                 // Fracción de velocidad perdida por segundo
+
+    float sizeStart = 1.0f, sizeEnd = 1.0f;
+    glm::vec4 colorStart = glm::vec4(1.0f);
+    glm::vec4 colorEnd = glm::vec4(1.0f, 1.0f, 1.0f, 0.0f);
+
+    std::shared_ptr<Texture> texture;  // nullptr = quads de color
+};
+
+// Partículas en CPU para efectos (explosiones, humo, proyectiles).
+// Cada emisor tiene su propio pool en columnas SoA; Update reparte los emisores
+// entre hilos y en cada uno integra con SIMD, compacta las partículas muertas
+// sin saltos (cada partícula se escribe siempre y el índice de escritura avanza
+// sólo si sigue viva) y prepara las columnas que Submit pasa a Renderer::DrawQuads.
+// El presupuesto limita las partículas vivas de todos los emisores a la vez.
+class ParticleSystem {
+public:
+    ParticleSystem(uint32_t particleBudget = 100000, JobSystem* jobSystem = nullptr);
+
+    // No permitir copia
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    // Emisores
+    uint32_t CreateEmitter(const ParticleEmitterDesc& desc);
+    void DestroyEmitter(uint32_t emitter);
+    void SetEmitterPosition(uint32_t emitter, const glm::vec2& position);
+    void SetEmitterRate(uint32_t emitter, float rate);
+    void Burst(uint32_t emitter, uint32_t count);   // Se emiten en el próximo Update
+    static constexpr uint32_t InvalidEmitter = 0xffffffff;
+
+    void SetParticleBudget(uint32_t budget) { m_Budget = budget; }
+    uint32_t GetParticleBudget() const { return m_Budget; }
+
+    // Avanzar la simulación
+    void Update(float deltaTime);
+
+    // Enviar las partículas vivas al batch del renderer (entre BeginScene y EndScene)
+    void Submit(Renderer& renderer) const;
+
+    // Estadísticas del último Update
+    struct Stats {
+        float updateMs = 0.0f;
+        uint32_t emitterCount = 0;
+        uint32_t aliveCount = 0;
+        uint32_t spawnedCount = 0;
+        uint32_t droppedCount = 0;   // Emisiones descartadas por el presupuesto
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct Emitter {
+        ParticleEmitterDesc desc;
+        bool active = false;
+        float spawnAccumulator = 0.0f;
+        uint32_t pendingBurst = 0;
+        uint32_t spawnCount = 0;     // Concedido por el presupuesto para este Update
+        uint32_t rngState = 1;
+        uint32_t count = 0;
+
+        // Simulación
+        std::vector<float> positionX, positionY;
+        std::vector<float> velocityX, velocityY;
+        std::vector<float> life;          // Segundos restantes
+        std::vector<float> invLifetime;
+
+        // Salida para el renderer (esquina inferior izquierda, tamaño y RGBA)
+        std::vector<float> drawX, drawY;
+        std::vector<float> drawSize;
+        std::vector<float> drawColor;
+    };
+
+    void UpdateEmitter(Emitter& emitter, float deltaTime) const;
+    void SpawnParticles(Emitter& emitter) const;
+    void PrepareDrawData(Emitter& emitter) const;
+
+    JobSystem* m_JobSystem;
+    uint32_t m_Budget;
+
+    std::vector<Emitter> m_Emitters;
+    std::vector<uint32_t> m_FreeEmitters;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,261 @@
+#include "RenderTargetPool.h"
+#include "../Core/Log.h"
+#include "../Events/ApplicationEvent.h"
+
+#include <GL/glew.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Destiny {
+
+namespace {
+
+struct FormatInfo {
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+    uint32_t bytesPerPixel;
+};
+
+constexpr FormatInfo s_Formats[] = {
+    { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4 },
+    { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 8 },
+    { GL_RGBA32F, GL_RGBA, GL_FLOAT, 16 },
+    { GL_R8, GL_RED, GL_UNSIGNED_BYTE, 1 },
+    { GL_R16F, GL_RED, GL_HALF_FLOAT, 2 },
+    { GL_RG16F, GL_RG, GL_HALF_FLOAT, 4 },
+};
+static_assert(sizeof(s_Formats) / sizeof(s_Formats[0]) == static_cast<size_t>(RenderTargetFormat::Count),
+              "Falta un formato en s_Formats");
+
+const FormatInfo& GetFormatInfo(RenderTargetFormat format) {
+    return s_Formats[static_cast<size_t>(format)];
+}
+
+} // namespace
+
+void RenderTarget::Bind() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+}
+
+RenderTargetPool::RenderTargetPool(uint32_t width, uint32_t height)
+    : m_Width(std::max(width, 1u)), m_Height(std::max(height, 1u)) {
+    GLint maxSamples = 1;
+    glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+    m_MaxSamples = static_cast<uint32_t>(std::max(maxSamples, 1));
+}
+
+RenderTargetPool::~RenderTargetPool() {
+    for (Entry& entry : m_Entries)
+        DestroyTarget(entry);
+}
+
+RenderTarget* RenderTargetPool::Acquire(const RenderTargetDesc& desc) {
+    bool relative = desc.width == 0 || desc.height == 0;
+    uint32_t width = desc.width, height = desc.height;
+    if (relative) {
+        width = std::max(1u, static_cast<uint32_t>(std::ceil(m_Width * desc.scale)));
+        height = std::max(1u, static_cast<uint32_t>(std::ceil(m_Height * desc.scale)));
+    }
+    uint32_t samples = std::min(std::max(desc.samples, 1u), m_MaxSamples);
+
+    m_FrameAcquires++;
+
+    // Un target libre idéntico: de un frame anterior o de una pasada ya terminada
+    Entry* found = nullptr;
+    for (Entry& entry : m_Entries) {
+        const RenderTarget& target = *entry.target;
+        if (!entry.inUse && !entry.stale && target.width == width && target.height == height &&
+            target.format == desc.format && target.depth == desc.depth && target.samples == samples) {
+            found = &entry;
+            break;
+        }
+    }
+
+    if (found) {
+        m_FrameReused++;
+    }
+    else {
+        auto target = std::make_unique<RenderTarget>();
+        target->width = width;
+        target->height = height;
+        target->format = desc.format;
+        target->depth = desc.depth;
+        target->samples = samples;
+        if (!CreateTarget(*target))
+            return nullptr;
+
+        Entry entry;
+        entry.target = std::move(target);
+        entry.relative = relative;
+        entry.bytes = GetTargetBytes(width, height, desc.format, desc.depth, samples);
+        m_Entries.push_back(std::move(entry));
+        found = &m_Entries.back();
+
+        m_FrameCreated++;
+        m_Stats.targetCount++;
+        m_Stats.vramBytes += found->bytes;
+        m_Stats.peakVramBytes = std::max(m_Stats.peakVramBytes, m_Stats.vramBytes);
+    }
+
+    found->inUse = true;
+    found->lastUsedFrame = m_Frame;
+    m_Stats.inUse++;
+    m_Stats.peakInUse = std::max(m_Stats.peakInUse, m_Stats.inUse);
+    return found->target.get();
+}
+
+void RenderTargetPool::Release(RenderTarget* target) {
+    auto it = std::find_if(m_Entries.begin(), m_Entries.end(),
+                           [target](const Entry& entry) { return entry.target.get() == target; });
+    if (it == m_Entries.end() || !it->inUse) {
+        DESTINY_CORE_WARN("Render target devuelto que no estaba adquirido en el pool");
+        return;
+    }
+
+    it->inUse = false;
+    m_Stats.inUse--;
+
+    // Su tamaño ya no corresponde a la ventana
+    if (it->stale) {
+        DestroyTarget(*it);
+        RemoveDestroyed();
+    }
+}
+
+void RenderTargetPool::NewFrame() {
+    for (Entry& entry : m_Entries) {
+        if (!entry.inUse && m_Frame - entry.lastUsedFrame >= MaxUnusedFrames)
+            DestroyTarget(entry);
+    }
+    RemoveDestroyed();
+
+    m_Stats.acquires = m_FrameAcquires;
+    m_Stats.reused = m_FrameReused;
+    m_Stats.created = m_FrameCreated;
+    m_Stats.released = m_FrameReleased;
+    m_FrameAcquires = 0;
+    m_FrameReused = 0;
+    m_FrameCreated = 0;
+    m_FrameReleased = 0;
+    m_Frame++;
+}
+
+void RenderTargetPool::Resize(uint32_t width, uint32_t height) {
+    if (width == 0 || height == 0 || (width == m_Width && height == m_Height))
+        return;
+
+    m_Width = width;
+    m_Height = height;
+
+    // Los relativos se recrean con el tamaño nuevo cuando se vuelvan a pedir
+    for (Entry& entry : m_Entries) {
+        if (!entry.relative)
+            continue;
+        if (entry.inUse)
+            entry.stale = true;
+        else
+            DestroyTarget(entry);
+    }
+    RemoveDestroyed();
+}
+
+bool RenderTargetPool::OnWindowResize(WindowResizeEvent& event) {
+    if (!event.IsMinimized())
+        Resize(static_cast<uint32_t>(event.GetWidth()), static_cast<uint32_t>(event.GetHeight()));
+
+    // Otros sistemas también necesitan el evento
+    return false;
+}
+
+void RenderTargetPool::Trim() {
+    for (Entry& entry : m_Entries) {
+        if (!entry.inUse)
+            DestroyTarget(entry);
+    }
+    RemoveDestroyed();
+}
+
+void RenderTargetPool::LogStats() const {
+    DESTINY_CORE_INFO("Render targets: {0} vivos, {1} KB de VRAM, pico {2} KB, máximo {3} a la vez",
+                      m_Stats.targetCount, m_Stats.vramBytes / 1024, m_Stats.peakVramBytes / 1024, m_Stats.peakInUse);
+}
+
+size_t RenderTargetPool::GetTargetBytes(uint32_t width, uint32_t height, RenderTargetFormat format, bool depth,
+                                        uint32_t samples) {
+    size_t pixels = static_cast<size_t>(width) * height * samples;
+    return pixels * (GetFormatInfo(format).bytesPerPixel + (depth ? 4 : 0));
+}
+
+bool RenderTargetPool::CreateTarget(RenderTarget& target) {
+    const FormatInfo& info = GetFormatInfo(target.format);
+    bool multisample = target.samples > 1;
+    GLenum textureTarget = multisample ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
+
+    glGenTextures(1, &target.colorTexture);
+    glBindTexture(textureTarget, target.colorTexture);
+    if (multisample) {
+        glTexImage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, target.samples, info.internalFormat, target.width,
+                                target.height, GL_TRUE);
+    }
+    else {
+        glTexImage2D(GL_TEXTURE_2D, 0, info.internalFormat, target.width, target.height, 0, info.format, info.type,
+                     nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture(textureTarget, 0);
+
+    if (target.depth) {
+        glGenRenderbuffers(1, &target.depthBuffer);
+        glBindRenderbuffer(GL_RENDERBUFFER, target.depthBuffer);
+        if (multisample)
+            glRenderbufferStorageMultisample(GL_RENDERBUFFER, target.samples, GL_DEPTH24_STENCIL8, target.width,
+                                             target.height);
+        else
+            glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, target.width, target.height);
+        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    }
+
+    glGenFramebuffers(1, &target.framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, textureTarget, target.colorTexture, 0);
+    if (target.depth)
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, target.depthBuffer);
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        DESTINY_CORE_ERROR("Render target {0}x{1} incompleto: {2}", target.width, target.height, status);
+        glDeleteFramebuffers(1, &target.framebuffer);
+        glDeleteRenderbuffers(1, &target.depthBuffer);
+        glDeleteTextures(1, &target.colorTexture);
+        return false;
+    }
+    return true;
+}
+
+void RenderTargetPool::DestroyTarget(Entry& entry) {
+    if (!entry.target)
+        return;
+
+    RenderTarget& target = *entry.target;
+    glDeleteFramebuffers(1, &target.framebuffer);
+    glDeleteRenderbuffers(1, &target.depthBuffer);
+    glDeleteTextures(1, &target.colorTexture);
+
+    m_Stats.vramBytes -= entry.bytes;
+    m_Stats.targetCount--;
+    m_FrameReleased++;
+    entry.target.reset();
+}
+
+void RenderTargetPool::RemoveDestroyed() {
+    m_Entries.erase(std::remove_if(m_Entries.begin(), m_Entries.end(), [](const Entry& entry) { return !entry.target; }),
+                    m_Entries.end());
+}
+
+} // namespace Destiny
\ No newline at end of file
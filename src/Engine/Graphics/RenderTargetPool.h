@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Destiny {
+
+class WindowResizeEvent;
+
+enum class RenderTargetFormat : uint8_t {
+    RGBA8 = 0,
+    RGBA16F,
+    RGBA32F,
+    R8,
+    R16F,
+    RG16F,
+    Count
+};
+
+struct RenderTargetDesc {
+    // 0 = relativo a la ventana: scale * su tamaño, y se rehace al redimensionarla
+    uint32_t width = 0;
+    uint32_t height = 0;
+    float scale = 1.0f;
+    RenderTargetFormat format = RenderTargetFormat::RGBA8;
+    bool depth = false;             // Renderbuffer depth24/stencil8
+    uint32_t samples = 1;           // > 1: textura multisample (se resuelve con glBlitFramebuffer)
+};
+
+// FBO del pool con su textura de color. Lo que devuelve Acquire sigue siendo
+// del pool: no se borra, y hasta que se devuelve no lo recibe ninguna otra pasada.
+struct RenderTarget {
+    uint32_t framebuffer = 0;
+    uint32_t colorTexture = 0;      // GL_TEXTURE_2D o GL_TEXTURE_2D_MULTISAMPLE
+    uint32_t depthBuffer = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    RenderTargetFormat format = RenderTargetFormat::RGBA8;
+    bool depth = false;
+    uint32_t samples = 1;
+
+    // Framebuffer y viewport
+    void Bind() const;
+};
+
+// Pool de render targets temporales para las pasadas del frame (post-proceso,
+// minimapa, niebla, iluminación). Cada pasada pide un target por descripción y lo
+// devuelve en cuanto otra pasada ya no lo va a leer; un target devuelto sirve a la
+// siguiente petición compatible del mismo frame, así que pasadas que no se solapan
+// comparten memoria. OpenGL no permite solapar la memoria de texturas distintas:
+// el aliasing es a nivel de target completo (mismo tamaño, formato y muestras).
+//
+// Los targets se conservan entre frames y se liberan tras MaxUnusedFrames sin
+// usarse. Los relativos a la ventana se rehacen en OnWindowResize; los que estén
+// adquiridos en ese momento se liberan al devolverlos.
+class RenderTargetPool {
+public:
+    RenderTargetPool(uint32_t width, uint32_t height);
+    ~RenderTargetPool();
+
+    // No permitir copia
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+    // nullptr si el driver no puede crear el framebuffer
+    RenderTarget* Acquire(const RenderTargetDesc& desc);
+    void Release(RenderTarget* target);
+
+    // Inicio de frame: libera los targets que llevan MaxUnusedFrames sin usarse
+    void NewFrame();
+
+    // Tamaño del framebuffer de la ventana
+    void Resize(uint32_t width, uint32_t height);
+    bool OnWindowResize(WindowResizeEvent& event);
+
+    // Liberar todos los targets libres (p. ej. al cambiar de escena)
+    void Trim();
+
+    static constexpr uint32_t MaxUnusedFrames = 3;
+
+    struct Stats {
+        size_t vramBytes = 0;           // Todos los targets vivos
+        size_t peakVramBytes = 0;       // Máximo desde el inicio
+        uint32_t targetCount = 0;
+        uint32_t inUse = 0;
+        uint32_t peakInUse = 0;         // Máximo adquirido a la vez desde el inicio
+
+        // Frame anterior
+        uint32_t acquires = 0;
+        uint32_t reused = 0;            // Servidas con un target existente
+        uint32_t created = 0;
+        uint32_t released = 0;          // Liberados por falta de uso o por resize
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+    void LogStats() const;
+
+    // Bytes de un target con esa descripción ya resuelta
+    static size_t GetTargetBytes(uint32_t width, uint32_t height, RenderTargetFormat format, bool depth, uint32_t samples);
+
+private:
+    struct Entry {
+        std::unique_ptr<RenderTarget> target;
+        bool relative = false;
+        bool inUse = false;
+        bool stale = false;         // Tamaño de antes de un resize; se libera al devolverlo
+        uint64_t lastUsedFrame = 0;
+        size_t bytes = 0;
+    };
+
+    bool CreateTarget(RenderTarget& target);
+    void DestroyTarget(Entry& entry);
+    void RemoveDestroyed();
+
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_MaxSamples = 1;
+    std::vector<Entry> m_Entries;
+    uint64_t m_Frame = 0;
+
+    // Contadores del frame en curso
+    uint32_t m_FrameAcquires = 0;
+    uint32_t m_FrameReused = 0;
+    uint32_t m_FrameCreated = 0;
+    uint32_t m_FrameReleased = 0;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -1,15 +1,36 @@
 #include "Renderer.h"
+#include "DebugDraw.h"
+#include "Lighting2D.h"
+#include "Shader.h"
+#include "Sprite.h"
+#include "Texture.h"
+#include "../Core/JobSystem.h"
 #include "../Core/Log.h"
+#include "../Math/QuadTransform.h"
 #include <GL/glew.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+
 namespace Destiny {
 
-Renderer::Renderer() {
-    // Constructor vacío o inicialización si es necesario
+Renderer::Renderer(JobSystem* jobSystem)
+    : m_JobSystem(jobSystem) {
 }
 
 Renderer::~Renderer() {
-    // Liberar recursos si es necesario
+    glDeleteBuffers(1, &m_QuadVBO);
+    glDeleteBuffers(1, &m_QuadIBO);
+    glDeleteVertexArrays(1, &m_QuadVAO);
+
+    if (m_IndirectReady) {
+        uint32_t buffers[] = { m_InstanceBuffer, m_CommandBuffer, m_RangeBuffer, m_VisibleBuffer };
+        glDeleteBuffers(4, buffers);
+        glDeleteVertexArrays(1, &m_IndirectVAO);
+    }
 }
 
 bool Renderer::Initialize() {
@@ -24,19 +45,147 @@ bool Renderer::Initialize() {
     DESTINY_CORE_INFO("  Versión: " + std::string(reinterpret_cast<const char*>(version)));
     DESTINY_CORE_INFO("  Renderer: " + std::string(reinterpret_cast<const char*>(renderer)));
     DESTINY_CORE_INFO("  Vendor: " + std::string(reinterpret_cast<const char*>(vendor)));
+    DESTINY_CORE_INFO("  Kernel de quads: {0}", QuadTransform::GetSimdLevelName(QuadTransform::GetSimdLevel()));
 
     // Configuración de OpenGL
     glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);  // Los quads 2D comparten profundidad: gana el último enviado
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
+    // Shader del batch
+    try {
+        m_QuadShader = std::make_unique<Shader>("shaders/Quad.vert", "shaders/Quad.frag");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_ERROR("No se pudo crear el shader de quads: {0}", e.what());
+        return false;
+    }
+
+    // Si falta Quad.vert/Quad.frag el constructor no lanza: el programa queda a 0
+    if (m_QuadShader->GetRendererID() == 0) {
+        DESTINY_CORE_ERROR("Shader de quads no disponible");
+        m_QuadShader.reset();
+        return false;
+    }
+
+    int samplers[MaxTextureSlots];
+    for (uint32_t i = 0; i < MaxTextureSlots; i++)
+        samplers[i] = static_cast<int>(i);
+
+    m_QuadShader->Bind();
+    m_QuadShader->SetIntArray("u_Textures", samplers, MaxTextureSlots);
+    m_QuadShader->Unbind();
+
+    // Textura blanca para quads de color (slot 0)
+    m_WhiteTexture = std::make_shared<Texture>(1, 1);
+    uint32_t white = 0xffffffff;
+    m_WhiteTexture->SetData(&white, sizeof(white));
+
+    // VAO/VBO del batch; el VBO crece según los quads de la escena
+    glGenVertexArrays(1, &m_QuadVAO);
+    glBindVertexArray(m_QuadVAO);
+
+    glGenBuffers(1, &m_QuadVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_QuadVBO);
+    ReserveVertexBuffer(MaxQuadsPerDraw);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, color));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, texCoord));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, texIndex));
+
+    // Índices fijos: cada draw usa un vértice base distinto sobre el mismo patrón
+    std::vector<uint32_t> indices(MaxQuadsPerDraw * 6);
+    for (uint32_t quad = 0, offset = 0; quad < MaxQuadsPerDraw; quad++, offset += 4) {
+        uint32_t* i = &indices[quad * 6];
+        i[0] = offset + 0; i[1] = offset + 1; i[2] = offset + 2;
+        i[3] = offset + 2; i[4] = offset + 3; i[5] = offset + 0;
+    }
+
+    glGenBuffers(1, &m_QuadIBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_QuadIBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Camino GPU si el contexto lo permite; si falla se queda el batch de vértices
+    if (GLEW_VERSION_4_3) {
+        m_IndirectReady = InitializeIndirect();
+        m_UseIndirect = m_IndirectReady;
+    }
+    DESTINY_CORE_INFO("  Camino de quads: {0}", m_UseIndirect ? "GPU (multi-draw indirect)" : "batch de vértices");
+
+    StartBatch();
+    return true;
+}
+
+bool Renderer::InitializeIndirect() {
+    try {
+        m_IndirectShader = std::make_unique<Shader>("shaders/QuadIndirect.vert", "shaders/Quad.frag");
+        m_CullShader = std::make_unique<Shader>("shaders/QuadCull.comp");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_WARN("No se pudieron crear los shaders del camino GPU: {0}", e.what());
+        m_IndirectShader.reset();
+        m_CullShader.reset();
+        return false;
+    }
+
+    if (m_IndirectShader->GetRendererID() == 0 || m_CullShader->GetRendererID() == 0) {
+        DESTINY_CORE_WARN("Shaders del camino GPU no disponibles");
+        m_IndirectShader.reset();
+        m_CullShader.reset();
+        return false;
+    }
+
+    int samplers[MaxTextureSlots];
+    for (uint32_t i = 0; i < MaxTextureSlots; i++)
+        samplers[i] = static_cast<int>(i);
+
+    m_IndirectShader->Bind();
+    m_IndirectShader->SetIntArray("u_Textures", samplers, MaxTextureSlots);
+    m_IndirectShader->Unbind();
+
+    uint32_t buffers[4];
+    glGenBuffers(4, buffers);
+    m_InstanceBuffer = buffers[0];
+    m_CommandBuffer = buffers[1];
+    m_RangeBuffer = buffers[2];
+    m_VisibleBuffer = buffers[3];
+
+    // Sin vértices: el vertex shader usa gl_VertexID sobre los 6 primeros índices del
+    // IBO compartido y lee el índice de instancia visible (el baseInstance de cada
+    // comando desplaza la lectura a su rango)
+    glGenVertexArrays(1, &m_IndirectVAO);
+    glBindVertexArray(m_IndirectVAO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_QuadIBO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_VisibleBuffer);
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(0, 1, GL_UNSIGNED_INT, sizeof(uint32_t), nullptr);
+    glVertexAttribDivisor(0, 1);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
     return true;
 }
 
+void Renderer::SetGpuDriven(bool enabled) {
+    if (enabled && !m_IndirectReady)
+        DESTINY_CORE_WARN("El camino GPU necesita OpenGL 4.3; se mantiene el batch de vértices");
+
+    m_UseIndirect = enabled && m_IndirectReady;
+}
+
 void Renderer::Clear(const Color& color) {
     glClearColor(color.r, color.g, color.b, color.a);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    
+
     // Resetear estadísticas
     m_Stats = {};
 }
@@ -44,32 +193,494 @@ void Renderer::Clear(const Color& color) {
 void Renderer::BeginScene(const glm::mat4& projection, const glm::mat4& view) {
     m_ProjectionMatrix = projection;
     m_ViewMatrix = view;
+
+    ClearQuads();
+    m_Batches.clear();
+    StartBatch();
 }
 
 void Renderer::EndScene() {
-    // Procesar final de la escena si es necesario
+#if DESTINY_DEBUG_DRAW
+    // El texto de depuración entra en el batch; las líneas van encima de todo
+    DebugDraw::SubmitText(*this);
+    FlushScene();
+    DebugDraw::Render(m_ProjectionMatrix * m_ViewMatrix);
+#else
+    FlushScene();
+#endif
 }
 
-void Renderer::DrawSprite(const std::shared_ptr<Sprite>& sprite, const glm::vec2& position, 
+void Renderer::DrawSprite(const std::shared_ptr<Sprite>& sprite, const glm::vec2& position,
                           const glm::vec2& size, float rotation) {
-    // Implementación para renderizar un sprite
-    m_Stats.drawCalls++;
+    SubmitQuad(position, size, rotation, sprite->GetColor(), sprite->GetTexture(),
+               sprite->GetTexCoordMin(), sprite->GetTexCoordMax());
 }
 
-void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size, 
+void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size,
                         const Color& color, float rotation) {
-    // Implementación para renderizar un quad con color
-    m_Stats.drawCalls++;
+    SubmitQuad(position, size, rotation, { color.r, color.g, color.b, color.a }, nullptr,
+               { 0.0f, 0.0f }, { 1.0f, 1.0f });
 }
 
-void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size, 
+void Renderer::DrawQuad(const glm::vec2& position, const glm::vec2& size,
                         const std::shared_ptr<Texture>& texture, float rotation) {
-    // Implementación para renderizar un quad con textura
-    m_Stats.drawCalls++;
+    SubmitQuad(position, size, rotation, { 1.0f, 1.0f, 1.0f, 1.0f }, texture,
+               { 0.0f, 0.0f }, { 1.0f, 1.0f });
+}
+
+void Renderer::DrawQuads(const QuadBatchInput& input, uint32_t count, const std::shared_ptr<Texture>& texture) {
+    for (uint32_t offset = 0; offset < count;) {
+        if (m_Batches.back().quadCount >= MaxQuadsPerDraw)
+            StartBatch();
+
+        // Una sola búsqueda de slot por tramo; el tramo no pasa del límite del batch.
+        // Los campos de distancia usan índices desde MaxTextureSlots (ver Quad.frag)
+        float texIndex = AcquireTextureSlot(texture);
+        if (input.distanceField)
+            texIndex += static_cast<float>(MaxTextureSlots);
+        uint32_t n = std::min(count - offset, MaxQuadsPerDraw - m_Batches.back().quadCount);
+
+        m_QuadPositionX.insert(m_QuadPositionX.end(), input.positionX + offset, input.positionX + offset + n);
+        m_QuadPositionY.insert(m_QuadPositionY.end(), input.positionY + offset, input.positionY + offset + n);
+        m_QuadSizeX.insert(m_QuadSizeX.end(), input.sizeX + offset, input.sizeX + offset + n);
+        m_QuadSizeY.insert(m_QuadSizeY.end(), input.sizeY + offset, input.sizeY + offset + n);
+        m_QuadPivotX.resize(m_QuadPivotX.size() + n, 0.5f);
+        m_QuadPivotY.resize(m_QuadPivotY.size() + n, 0.5f);
+
+        size_t first = m_QuadRotation.size();
+        m_QuadRotation.resize(first + n, 0.0f);
+        if (input.rotation) {
+            for (uint32_t i = 0; i < n; i++)
+                m_QuadRotation[first + i] = glm::radians(input.rotation[offset + i]);
+        }
+
+        for (uint32_t i = 0; i < n; i++) {
+            const float* rect = input.texRects ? &input.texRects[static_cast<size_t>(offset + i) * 4] : nullptr;
+            glm::vec2 uvMin = rect ? glm::vec2(rect[0], rect[1]) : glm::vec2(0.0f);
+            glm::vec2 uvMax = rect ? glm::vec2(rect[2], rect[3]) : glm::vec2(1.0f);
+            const float* c = input.colors ? &input.colors[static_cast<size_t>(offset + i) * 4] : nullptr;
+            glm::vec4 color = c ? glm::vec4(c[0], c[1], c[2], c[3]) : input.color;
+            m_QuadAttributes.push_back({ color, uvMin, uvMax, texIndex });
+        }
+
+        m_Batches.back().quadCount += n;
+        offset += n;
+    }
 }
 
 const Renderer::Stats& Renderer::GetStats() const {
     return m_Stats;
 }
 
-} // namespace Destiny
+void Renderer::RecordMinimapStats(float cpuMs, uint32_t texelsUpdated) {
+    m_Stats.minimapMs += cpuMs;
+    m_Stats.minimapTexelsUpdated += texelsUpdated;
+}
+
+void Renderer::SubmitQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                          const glm::vec4& color, const std::shared_ptr<Texture>& texture,
+                          const glm::vec2& texCoordMin, const glm::vec2& texCoordMax) {
+    if (m_Batches.back().quadCount >= MaxQuadsPerDraw)
+        StartBatch();
+
+    float texIndex = AcquireTextureSlot(texture);
+
+    // Pivote en el centro, como Sprite::Draw
+    m_QuadPositionX.push_back(position.x);
+    m_QuadPositionY.push_back(position.y);
+    m_QuadSizeX.push_back(size.x);
+    m_QuadSizeY.push_back(size.y);
+    m_QuadRotation.push_back(glm::radians(rotation));
+    m_QuadPivotX.push_back(0.5f);
+    m_QuadPivotY.push_back(0.5f);
+    m_QuadAttributes.push_back({ color, texCoordMin, texCoordMax, texIndex });
+    m_Batches.back().quadCount++;
+}
+
+float Renderer::AcquireTextureSlot(const std::shared_ptr<Texture>& texture) {
+    if (!texture)
+        return 0.0f;
+
+    DrawBatch* batch = &m_Batches.back();
+    for (uint32_t slot = 1; slot < batch->textureCount; slot++) {
+        if (batch->textures[slot] == texture)
+            return static_cast<float>(slot);
+    }
+
+    // Sin slots libres: las texturas nuevas abren otro batch. Con iluminación
+    // el último slot queda para el buffer de luces
+    uint32_t slotCount = m_Lighting ? LitTextureSlots : MaxTextureSlots;
+    if (batch->textureCount >= slotCount) {
+        StartBatch();
+        batch = &m_Batches.back();
+    }
+
+    uint32_t slot = batch->textureCount++;
+    batch->textures[slot] = texture;
+    return static_cast<float>(slot);
+}
+
+void Renderer::StartBatch() {
+    DrawBatch batch;
+    batch.firstQuad = static_cast<uint32_t>(m_QuadAttributes.size());
+    batch.textures[0] = m_WhiteTexture;
+    batch.textureCount = 1;
+    m_Batches.push_back(std::move(batch));
+}
+
+void Renderer::ClearQuads() {
+    m_QuadPositionX.clear();
+    m_QuadPositionY.clear();
+    m_QuadSizeX.clear();
+    m_QuadSizeY.clear();
+    m_QuadRotation.clear();
+    m_QuadPivotX.clear();
+    m_QuadPivotY.clear();
+    m_QuadAttributes.clear();
+}
+
+void Renderer::ReserveVertexBuffer(uint32_t quadCount) {
+    if (quadCount <= m_VertexBufferQuads)
+        return;
+
+    // Crecer de forma geométrica para no reasignar cada frame
+    m_VertexBufferQuads = std::max(quadCount, m_VertexBufferQuads * 2);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_VertexBufferQuads) * 4 * sizeof(QuadVertex),
+                 nullptr, GL_DYNAMIC_DRAW);
+}
+
+void Renderer::SetLighting(Lighting2D* lighting) {
+    if (lighting && !m_LitQuadShader && !InitializeLighting())
+        lighting = nullptr;
+
+    m_Lighting = lighting;
+}
+
+bool Renderer::InitializeLighting() {
+    // 15 slots de textura más el buffer de luces: cabe en las 16 unidades que
+    // garantiza OpenGL 3.3
+    GLint textureUnits = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &textureUnits);
+    if (textureUnits < static_cast<GLint>(LitTextureSlots + 1)) {
+        DESTINY_CORE_WARN("Iluminación 2D no disponible: sólo hay {0} unidades de textura", textureUnits);
+        return false;
+    }
+
+    try {
+        m_LitQuadShader = std::make_unique<Shader>("shaders/Quad.vert", "shaders/QuadLit.frag");
+        if (m_IndirectReady)
+            m_LitIndirectShader = std::make_unique<Shader>("shaders/QuadIndirect.vert", "shaders/QuadLit.frag");
+    }
+    catch (const std::exception& e) {
+        DESTINY_CORE_WARN("No se pudieron crear los shaders iluminados: {0}", e.what());
+        m_LitQuadShader.reset();
+        m_LitIndirectShader.reset();
+        return false;
+    }
+
+    if (m_LitQuadShader->GetRendererID() == 0 || (m_LitIndirectShader && m_LitIndirectShader->GetRendererID() == 0)) {
+        DESTINY_CORE_WARN("Shaders iluminados no disponibles");
+        m_LitQuadShader.reset();
+        m_LitIndirectShader.reset();
+        return false;
+    }
+
+    int samplers[LitTextureSlots];
+    for (uint32_t i = 0; i < LitTextureSlots; i++)
+        samplers[i] = static_cast<int>(i);
+
+    for (Shader* shader : { m_LitQuadShader.get(), m_LitIndirectShader.get() }) {
+        if (!shader)
+            continue;
+
+        shader->Bind();
+        shader->SetIntArray("u_Textures", samplers, LitTextureSlots);
+        shader->Unbind();
+    }
+    return true;
+}
+
+void Renderer::FlushScene() {
+    uint32_t quadCount = static_cast<uint32_t>(m_QuadAttributes.size());
+    if (quadCount == 0 || !m_QuadShader)
+        return;
+
+    // Si la iluminación se puso a mitad de escena algún batch puede usar el slot
+    // de las luces; esa escena se dibuja sin iluminar
+    bool lit = m_Lighting && std::all_of(m_Batches.begin(), m_Batches.end(), [](const DrawBatch& batch) {
+        return batch.textureCount <= LitTextureSlots;
+    });
+
+    // Las luces se reparten con la cámara y el viewport con los que se va a dibujar
+    if (lit) {
+        GLint viewport[4];
+        glGetIntegerv(GL_VIEWPORT, viewport);
+        m_Lighting->Build(m_ProjectionMatrix * m_ViewMatrix,
+                          glm::ivec4(viewport[0], viewport[1], viewport[2], viewport[3]));
+    }
+
+    if (m_UseIndirect)
+        FlushSceneIndirect(quadCount, lit);
+    else
+        FlushSceneVertices(quadCount, lit);
+
+    ClearQuads();
+    m_Batches.clear();
+    StartBatch();
+}
+
+void Renderer::FlushSceneVertices(uint32_t quadCount, bool lit) {
+    glBindVertexArray(m_QuadVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, m_QuadVBO);
+    ReserveVertexBuffer(quadCount);
+
+    // Generación de geometría: cada hilo escribe un rango disjunto del buffer mapeado
+    auto start = std::chrono::high_resolution_clock::now();
+
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(quadCount) * 4 * sizeof(QuadVertex);
+    auto* mapped = static_cast<QuadVertex*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, bytes,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+
+    QuadVertex* vertices = mapped;
+    if (!vertices) {
+        DESTINY_CORE_WARN("No se pudo mapear el buffer de vértices, usando copia");
+        m_FallbackVertices.resize(static_cast<size_t>(quadCount) * 4);
+        vertices = m_FallbackVertices.data();
+    }
+
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(quadCount, MinQuadsPerJob, [this, vertices](uint32_t begin, uint32_t end) {
+            GenerateQuadVertices(begin, end, vertices);
+        });
+    }
+    else {
+        GenerateQuadVertices(0, quadCount, vertices);
+    }
+
+    if (mapped)
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    else
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, vertices);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.geometryTimeMs += std::chrono::duration<float, std::milli>(end - start).count();
+
+    // Emitir los draws en el orden original de envío
+    Shader& shader = lit ? *m_LitQuadShader : *m_QuadShader;
+    shader.Bind();
+    shader.SetMat4("u_ViewProjection", m_ProjectionMatrix * m_ViewMatrix);
+    if (lit)
+        m_Lighting->Bind(shader, LitTextureSlots);
+
+    for (const DrawBatch& batch : m_Batches) {
+        if (batch.quadCount == 0)
+            continue;
+
+        for (uint32_t slot = 0; slot < batch.textureCount; slot++)
+            batch.textures[slot]->Bind(slot);
+
+        glDrawElementsBaseVertex(GL_TRIANGLES, batch.quadCount * 6, GL_UNSIGNED_INT, nullptr,
+                                 batch.firstQuad * 4);
+
+        m_Stats.drawCalls++;
+        m_Stats.triangleCount += batch.quadCount * 2;
+    }
+    m_Stats.quadCount += quadCount;
+
+    glBindVertexArray(0);
+    shader.Unbind();
+}
+
+void Renderer::FlushSceneIndirect(uint32_t quadCount, bool lit) {
+    // 1. Instancias: 64 bytes por quad en lugar de 4 vértices transformados en CPU
+    auto start = std::chrono::high_resolution_clock::now();
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_InstanceBuffer);
+    if (quadCount > m_InstanceBufferQuads) {
+        m_InstanceBufferQuads = std::max(quadCount, m_InstanceBufferQuads * 2);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(m_InstanceBufferQuads) * sizeof(QuadInstance),
+                     nullptr, GL_DYNAMIC_DRAW);
+
+        glBindBuffer(GL_ARRAY_BUFFER, m_VisibleBuffer);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_InstanceBufferQuads) * sizeof(uint32_t),
+                     nullptr, GL_DYNAMIC_COPY);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GLsizeiptr bytes = static_cast<GLsizeiptr>(quadCount) * sizeof(QuadInstance);
+    auto* mapped = static_cast<QuadInstance*>(glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, bytes,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+
+    QuadInstance* instances = mapped;
+    if (!instances) {
+        DESTINY_CORE_WARN("No se pudo mapear el buffer de instancias, usando copia");
+        m_FallbackInstances.resize(quadCount);
+        instances = m_FallbackInstances.data();
+    }
+
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(quadCount, MinQuadsPerJob, [this, instances](uint32_t begin, uint32_t end) {
+            GenerateQuadInstances(begin, end, instances);
+        });
+    }
+    else {
+        GenerateQuadInstances(0, quadCount, instances);
+    }
+
+    if (mapped)
+        glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    else
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, bytes, instances);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.geometryTimeMs += std::chrono::duration<float, std::milli>(end - start).count();
+
+    // 2. Un comando por batch, con instanceCount a 0 para que lo rellene el culling
+    m_IndirectCommands.clear();
+    m_IndirectRanges.clear();
+    for (const DrawBatch& batch : m_Batches) {
+        if (batch.quadCount == 0)
+            continue;
+
+        m_IndirectCommands.push_back({ 6, 0, 0, 0, batch.firstQuad });
+        m_IndirectRanges.push_back(batch.firstQuad);
+        m_IndirectRanges.push_back(batch.quadCount);
+    }
+    uint32_t commandCount = static_cast<uint32_t>(m_IndirectCommands.size());
+
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_CommandBuffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, commandCount * sizeof(DrawIndirectCommand),
+                 m_IndirectCommands.data(), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_RangeBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, m_IndirectRanges.size() * sizeof(uint32_t),
+                 m_IndirectRanges.data(), GL_DYNAMIC_DRAW);
+
+    // 3. Culling contra el rectángulo de mundo que cubre la vista; un grupo por comando
+    //    compacta las visibles sin cambiar su orden
+    glm::mat4 viewProjection = m_ProjectionMatrix * m_ViewMatrix;
+    glm::mat4 inverse = glm::inverse(viewProjection);
+    glm::vec2 viewMin(std::numeric_limits<float>::max());
+    glm::vec2 viewMax(-std::numeric_limits<float>::max());
+    const glm::vec2 ndcCorners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+    for (const glm::vec2& ndc : ndcCorners) {
+        glm::vec4 world = inverse * glm::vec4(ndc.x, ndc.y, 0.0f, 1.0f);
+        glm::vec2 point = glm::vec2(world.x, world.y) / world.w;
+        viewMin = glm::min(viewMin, point);
+        viewMax = glm::max(viewMax, point);
+    }
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_InstanceBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_CommandBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, m_RangeBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, m_VisibleBuffer);
+
+    m_CullShader->Bind();
+    m_CullShader->SetFloat2("u_ViewMin", viewMin);
+    m_CullShader->SetFloat2("u_ViewMax", viewMax);
+    glDispatchCompute(1, commandCount, 1);
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+
+    // 4. Un multi-draw por tramo de batches con texturas compatibles (mismos slots en común)
+    glBindVertexArray(m_IndirectVAO);
+    Shader& shader = lit && m_LitIndirectShader ? *m_LitIndirectShader : *m_IndirectShader;
+    shader.Bind();
+    shader.SetMat4("u_ViewProjection", viewProjection);
+    if (lit && m_LitIndirectShader)
+        m_Lighting->Bind(shader, LitTextureSlots);
+
+    uint32_t command = 0;
+    for (size_t first = 0; first < m_Batches.size();) {
+        const DrawBatch* textures = &m_Batches[first];
+        size_t last = first;
+        uint32_t commands = 0;
+
+        for (; last < m_Batches.size(); last++) {
+            const DrawBatch& batch = m_Batches[last];
+            uint32_t shared = std::min(batch.textureCount, textures->textureCount);
+            bool compatible = std::equal(batch.textures.begin(), batch.textures.begin() + shared,
+                                         textures->textures.begin());
+            if (!compatible)
+                break;
+
+            if (batch.textureCount > textures->textureCount)
+                textures = &batch;
+            commands += batch.quadCount > 0 ? 1 : 0;
+        }
+
+        if (commands > 0) {
+            for (uint32_t slot = 0; slot < textures->textureCount; slot++)
+                textures->textures[slot]->Bind(slot);
+
+            glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                        reinterpret_cast<const void*>(static_cast<uintptr_t>(command) * sizeof(DrawIndirectCommand)),
+                                        commands, 0);
+            m_Stats.drawCalls++;
+        }
+
+        command += commands;
+        first = last;
+    }
+
+    // El culling ocurre en la GPU: triángulos enviados, no dibujados
+    m_Stats.triangleCount += quadCount * 2;
+    m_Stats.quadCount += quadCount;
+    m_Stats.indirectCommands += commandCount;
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    shader.Unbind();
+}
+
+void Renderer::GenerateQuadVertices(uint32_t begin, uint32_t end, QuadVertex* out) const {
+    // Bloques pequeños para que las esquinas queden en la pila y en caché
+    constexpr uint32_t ChunkSize = 256;
+    float corners[ChunkSize * 8];
+
+    for (uint32_t chunk = begin; chunk < end; chunk += ChunkSize) {
+        uint32_t count = std::min(ChunkSize, end - chunk);
+
+        QuadTransformInput input = {
+            m_QuadPositionX.data() + chunk, m_QuadPositionY.data() + chunk,
+            m_QuadSizeX.data() + chunk, m_QuadSizeY.data() + chunk,
+            m_QuadRotation.data() + chunk,
+            m_QuadPivotX.data() + chunk, m_QuadPivotY.data() + chunk
+        };
+        QuadTransform::Compute(input, count, corners);
+
+        for (uint32_t i = 0; i < count; i++) {
+            const QuadAttributes& attributes = m_QuadAttributes[chunk + i];
+            const float* corner = &corners[i * 8];
+            QuadVertex* vertex = &out[static_cast<size_t>(chunk + i) * 4];
+
+            // Esquinas (0,0) (1,0) (1,1) (0,1), igual que el patrón de índices
+            const glm::vec2& uvMin = attributes.texCoordMin;
+            const glm::vec2& uvMax = attributes.texCoordMax;
+            const glm::vec2 texCoords[4] = { uvMin, { uvMax.x, uvMin.y }, uvMax, { uvMin.x, uvMax.y } };
+
+            for (int v = 0; v < 4; v++) {
+                vertex[v].position = { corner[v * 2], corner[v * 2 + 1], 0.0f };
+                vertex[v].color = attributes.color;
+                vertex[v].texCoord = texCoords[v];
+                vertex[v].texIndex = attributes.texIndex;
+            }
+        }
+    }
+}
+
+void Renderer::GenerateQuadInstances(uint32_t begin, uint32_t end, QuadInstance* out) const {
+    for (uint32_t i = begin; i < end; i++) {
+        const QuadAttributes& attributes = m_QuadAttributes[i];
+        QuadInstance& instance = out[i];
+
+        instance.position = { m_QuadPositionX[i], m_QuadPositionY[i] };
+        instance.size = { m_QuadSizeX[i], m_QuadSizeY[i] };
+        instance.pivot = { m_QuadPivotX[i], m_QuadPivotY[i] };
+        instance.rotation = m_QuadRotation[i];
+        instance.texIndex = attributes.texIndex;
+        instance.color = attributes.color;
+        instance.texRect = { attributes.texCoordMin.x, attributes.texCoordMin.y,
+                             attributes.texCoordMax.x, attributes.texCoordMax.y };
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -1,12 +1,16 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace Destiny {
 
 // Forward declarations
+class JobSystem;
+class Lighting2D;
 class Shader;
 class Sprite;
 class Texture;
@@ -16,41 +20,194 @@ struct Color {
     float r, g, b, a;
 };
 
+// Vértice del batch de quads
+struct QuadVertex {
+    glm::vec3 position;
+    glm::vec4 color;
+    glm::vec2 texCoord;
+    float texIndex;
+};
+
+// Quads en bloque (columnas SoA del juego)
+struct QuadBatchInput {
+    const float* positionX;
+    const float* positionY;
+    const float* sizeX;
+    const float* sizeY;
+    const float* rotation = nullptr;        // Grados; nullptr = sin rotación
+    const float* texRects = nullptr;        // minU, minV, maxU, maxV por quad; nullptr = textura completa
+    glm::vec4 color = glm::vec4(1.0f);
+    const float* colors = nullptr;          // r, g, b, a por quad; nullptr = color
+    bool distanceField = false;             // La textura guarda distancias en alfa (texto SDF)
+};
+
 class Renderer {
 public:
-    Renderer();
+    // Con un sistema de trabajos la generación de vértices se reparte entre hilos
+    Renderer(JobSystem* jobSystem = nullptr);
     ~Renderer();
-    
+
     // No permitir copia
     Renderer(const Renderer&) = delete;
     Renderer& operator=(const Renderer&) = delete;
-    
+
     // Inicialización
     bool Initialize();
-    
+
     // Comandos de renderizado básicos
     void Clear(const Color& color);
-    
+
     // Comenzar y finalizar una escena
     void BeginScene(const glm::mat4& projection, const glm::mat4& view);
     void EndScene();
-    
+
     // Métodos de renderizado
-    void DrawSprite(const std::shared_ptr<Sprite>& sprite, const glm::vec2& position, 
+    void DrawSprite(const std::shared_ptr<Sprite>& sprite, const glm::vec2& position,
                    const glm::vec2& size = glm::vec2(1.0f), float rotation = 0.0f);
-    
-    void DrawQuad(const glm::vec2& position, const glm::vec2& size, 
+
+    void DrawQuad(const glm::vec2& position, const glm::vec2& size,
                  const Color& color, float rotation = 0.0f);
-    
-    void DrawQuad(const glm::vec2& position, const glm::vec2& size, 
+
+    void DrawQuad(const glm::vec2& position, const glm::vec2& size,
                  const std::shared_ptr<Texture>& texture, float rotation = 0.0f);
-    
+
+    // Añadir count quads con la misma textura copiando columnas enteras
+    void DrawQuads(const QuadBatchInput& input, uint32_t count, const std::shared_ptr<Texture>& texture);
+
+    // Camino GPU (OpenGL 4.3+): un compute descarta los quads fuera de la vista y
+    // escribe los argumentos de glMultiDrawElementsIndirect, así que la escena sale
+    // en unas pocas llamadas. Sin soporte se sigue usando el batch de vértices.
+    void SetGpuDriven(bool enabled);
+    bool IsGpuDriven() const { return m_UseIndirect; }
+    bool IsGpuDrivenSupported() const { return m_IndirectReady; }
+
+    // Con iluminación activa la escena se dibuja con la variante iluminada del shader
+    // de quads, que suma las luces del tile de cada fragmento, y cada batch usa como
+    // mucho LitTextureSlots texturas. Debe ponerse antes de BeginScene. nullptr la desactiva.
+    // El renderer no toma posesión: la escena debe mantenerla viva mientras esté puesta.
+    void SetLighting(Lighting2D* lighting);
+    Lighting2D* GetLighting() const { return m_Lighting; }
+
+    // Límites del batch
+    static constexpr uint32_t MaxQuadsPerDraw = 10000;
+    static constexpr uint32_t MaxTextureSlots = 16;
+    static constexpr uint32_t LitTextureSlots = MaxTextureSlots - 1;   // El último slot es el buffer de luces
+    static constexpr uint32_t MinQuadsPerJob = 1024;
+
     // Estadísticas
     struct Stats {
         unsigned int drawCalls = 0;
         unsigned int triangleCount = 0;
+        unsigned int quadCount = 0;
+        float geometryTimeMs = 0.0f;   // Generación de vértices o instancias (todos los hilos)
+        unsigned int indirectCommands = 0;   // Comandos del camino GPU (antes del culling)
+        float minimapMs = 0.0f;              // CPU del minimapa: texels recalculados, subidas y marcadores
+        unsigned int minimapTexelsUpdated = 0;
+    };
+
+    const Stats& GetStats() const;
+
+    // Lo llama Minimap::Submit para que su coste aparezca con el resto del frame
+    void RecordMinimapStats(float cpuMs, uint32_t texelsUpdated);
+
+private:
+    // Atributos por quad que no intervienen en la transformación
+    struct QuadAttributes {
+        glm::vec4 color;
+        glm::vec2 texCoordMin;
+        glm::vec2 texCoordMax;
+        float texIndex;
     };
-    
-    const Stats& GetStats
+
+    // Rango contiguo de quads que comparte el mismo juego de texturas
+    struct DrawBatch {
+        uint32_t firstQuad = 0;
+        uint32_t quadCount = 0;
+        std::array<std::shared_ptr<Texture>, MaxTextureSlots> textures;
+        uint32_t textureCount = 0;
+    };
+
+    // Instancia del camino GPU; mismo layout std430 que QuadIndirect.vert y QuadCull.comp
+    struct QuadInstance {
+        glm::vec2 position;
+        glm::vec2 size;
+        glm::vec2 pivot;
+        float rotation;
+        float texIndex;
+        glm::vec4 color;
+        glm::vec4 texRect;
+    };
+    static_assert(sizeof(QuadInstance) == 64, "QuadInstance debe coincidir con el layout std430");
+
+    // Mismo layout que DrawElementsIndirectCommand
+    struct DrawIndirectCommand {
+        uint32_t count;
+        uint32_t instanceCount;     // Lo escribe el compute
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t baseInstance;
+    };
+
+    void SubmitQuad(const glm::vec2& position, const glm::vec2& size, float rotation,
+                    const glm::vec4& color, const std::shared_ptr<Texture>& texture,
+                    const glm::vec2& texCoordMin, const glm::vec2& texCoordMax);
+    float AcquireTextureSlot(const std::shared_ptr<Texture>& texture);
+    void StartBatch();
+    void ClearQuads();
+    void FlushScene();
+    void FlushSceneVertices(uint32_t quadCount, bool lit);
+    void FlushSceneIndirect(uint32_t quadCount, bool lit);
+    void ReserveVertexBuffer(uint32_t quadCount);
+    bool InitializeIndirect();
+    bool InitializeLighting();
+
+    // Escribe 4 vértices por quad del rango [begin, end) en out; no toca estado compartido
+    void GenerateQuadVertices(uint32_t begin, uint32_t end, QuadVertex* out) const;
+    void GenerateQuadInstances(uint32_t begin, uint32_t end, QuadInstance* out) const;
+
+    glm::mat4 m_ProjectionMatrix = glm::mat4(1.0f);
+    glm::mat4 m_ViewMatrix = glm::mat4(1.0f);
+
+    JobSystem* m_JobSystem = nullptr;
+    std::unique_ptr<Shader> m_QuadShader;
+    std::shared_ptr<Texture> m_WhiteTexture;
+
+    // Recursos de OpenGL del batch
+    uint32_t m_QuadVAO = 0;
+    uint32_t m_QuadVBO = 0;
+    uint32_t m_QuadIBO = 0;
+    uint32_t m_VertexBufferQuads = 0;
+
+    // Recursos del camino GPU
+    std::unique_ptr<Shader> m_IndirectShader;
+    std::unique_ptr<Shader> m_CullShader;
+    uint32_t m_IndirectVAO = 0;
+    uint32_t m_InstanceBuffer = 0;
+    uint32_t m_CommandBuffer = 0;
+    uint32_t m_RangeBuffer = 0;
+    uint32_t m_VisibleBuffer = 0;
+    uint32_t m_InstanceBufferQuads = 0;
+    bool m_IndirectReady = false;
+    bool m_UseIndirect = false;
+
+    // Iluminación por tiles: las luces van en la unidad siguiente a los slots de textura
+    Lighting2D* m_Lighting = nullptr;
+    std::unique_ptr<Shader> m_LitQuadShader;
+    std::unique_ptr<Shader> m_LitIndirectShader;
+
+    // Cola de la escena actual: columnas SoA para QuadTransform y atributos aparte
+    std::vector<float> m_QuadPositionX, m_QuadPositionY;
+    std::vector<float> m_QuadSizeX, m_QuadSizeY;
+    std::vector<float> m_QuadRotation;
+    std::vector<float> m_QuadPivotX, m_QuadPivotY;
+    std::vector<QuadAttributes> m_QuadAttributes;
+    std::vector<DrawBatch> m_Batches;
+    std::vector<QuadVertex> m_FallbackVertices;
+    std::vector<QuadInstance> m_FallbackInstances;
+    std::vector<DrawIndirectCommand> m_IndirectCommands;
+    std::vector<uint32_t> m_IndirectRanges;       // Primer quad y número de quads por comando
+
+    Stats m_Stats;
+};
 
 } // namespace Destiny
\ No newline at end of file
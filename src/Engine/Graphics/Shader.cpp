@@ -1,9 +1,9 @@
 #include "Graphics/Shader.h"
 #include "Core/Log.h"
+#include "Assets/FileSystem.h"
 
 #include <GL/glew.h>
 #include <glm/gtc/type_ptr.hpp>
-#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -12,7 +12,8 @@ namespace Destiny {
 Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
     : m_VertPath(vertexPath), m_FragPath(fragmentPath) {
     
-    std::string vertexSrc, fragmentSrc;
+    // Los bytes vienen directamente del paquete proyectado (o del archivo suelto)
+    AssetData vertexSrc, fragmentSrc;
     
     try {
         vertexSrc = ReadFile(vertexPath);
@@ -23,31 +24,44 @@ Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
         return;
     }
     
-    std::unordered_map<GLenum, std::string> sources;
-    sources[GL_VERTEX_SHADER] = vertexSrc;
-    sources[GL_FRAGMENT_SHADER] = fragmentSrc;
+    std::unordered_map<GLenum, std::string_view> sources;
+    sources[GL_VERTEX_SHADER] = vertexSrc.AsString();
+    sources[GL_FRAGMENT_SHADER] = fragmentSrc.AsString();
     
     Compile(sources);
     
     DESTINY_INFO("Shader creado: Vertex={0}, Fragment={1}", vertexPath, fragmentPath);
 }
 
+Shader::Shader(const std::string& computePath)
+    : m_VertPath(computePath) {
+    
+    AssetData computeSrc;
+    
+    try {
+        computeSrc = ReadFile(computePath);
+    }
+    catch (const std::exception& e) {
+        DESTINY_ERROR("Error al cargar shader: {0}", e.what());
+        return;
+    }
+    
+    std::unordered_map<GLenum, std::string_view> sources;
+    sources[GL_COMPUTE_SHADER] = computeSrc.AsString();
+    
+    Compile(sources);
+    
+    DESTINY_INFO("Shader creado: Compute={0}", computePath);
+}
+
 Shader::~Shader() {
     glDeleteProgram(m_RendererID);
 }
 
-std::string Shader::ReadFile(const std::string& filepath) {
-    std::string result;
-    std::ifstream in(filepath, std::ios::in | std::ios::binary);
+AssetData Shader::ReadFile(const std::string& filepath) {
+    AssetData result = FileSystem::Read(filepath);
     
-    if (in) {
-        in.seekg(0, std::ios::end);
-        result.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&result[0], result.size());
-        in.close();
-    }
-    else {
+    if (!result.IsValid()) {
         DESTINY_ERROR("No se pudo abrir el archivo de shader: {0}", filepath);
         throw std::runtime_error("Failed to open file: " + filepath);
     }
@@ -64,7 +78,7 @@ std::unordered_map<GLenum, std::string> Shader::PreProcess(const std::string& so
     return shaderSources;
 }
 
-void Shader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources) {
+void Shader::Compile(const std::unordered_map<GLenum, std::string_view>& shaderSources) {
     // Crear programa
     GLuint program = glCreateProgram();
     
@@ -75,14 +89,15 @@ void Shader::Compile(const std::unordered_map<GLenum, std::string>& shaderSource
     // Compilar shaders
     for (auto& kv : shaderSources) {
         GLenum type = kv.first;
-        const std::string& source = kv.second;
+        std::string_view source = kv.second;
         
         // Crear shader
         GLuint shader = glCreateShader(type);
         
-        // Establecer fuente
-        const GLchar* sourceCStr = source.c_str();
-        glShaderSource(shader, 1, &sourceCStr, 0);
+        // Establecer fuente (con longitud explícita: no hace falta terminador nulo)
+        const GLchar* sourceData = source.data();
+        GLint sourceLength = static_cast<GLint>(source.size());
+        glShaderSource(shader, 1, &sourceData, &sourceLength);
         
         // Compilar shader
         glCompileShader(shader);
@@ -177,6 +192,10 @@ void Shader::SetInt(const std::string& name, int value) {
     glUniform1i(GetUniformLocation(name), value);
 }
 
+void Shader::SetUInt(const std::string& name, uint32_t value) {
+    glUniform1ui(GetUniformLocation(name), value);
+}
+
 void Shader::SetIntArray(const std::string& name, int* values, uint32_t count) {
     glUniform1iv(GetUniformLocation(name), count, values);
 }
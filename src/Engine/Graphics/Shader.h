@@ -1,14 +1,21 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <glm/glm.hpp>
+#include <GL/glew.h>
+#include "Assets/AssetData.h"
 
 namespace Destiny {
 
 class Shader {
 public:
     Shader(const std::string& vertexPath, const std::string& fragmentPath);
+    
+    // Programa de compute (requiere OpenGL 4.3)
+    explicit Shader(const std::string& computePath);
     ~Shader();
 
     // No permitir copia
@@ -21,6 +28,7 @@ public:
     
     // Establecer uniforms
     void SetInt(const std::string& name, int value);
+    void SetUInt(const std::string& name, uint32_t value);
     void SetIntArray(const std::string& name, int* values, uint32_t count);
     void SetFloat(const std::string& name, float value);
     void SetFloat2(const std::string& name, const glm::vec2& value);
@@ -33,9 +41,9 @@ public:
     uint32_t GetRendererID() const { return m_RendererID; }
 
 private:
-    std::string ReadFile(const std::string& filepath);
+    AssetData ReadFile(const std::string& filepath);
     std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
-    void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+    void Compile(const std::unordered_map<GLenum, std::string_view>& shaderSources);
     
     uint32_t m_RendererID = 0;
     std::string m_VertPath, m_FragPath;
@@ -0,0 +1,16 @@
+#version 330 core
+
+in vec3 v_Normal;
+in vec2 v_TexCoord;
+in vec4 v_Color;
+
+out vec4 FragColor;
+
+uniform vec3 u_LightDirection;
+uniform float u_Ambient;
+
+void main() {
+    float diffuse = max(dot(normalize(v_Normal), -u_LightDirection), 0.0);
+    float light = u_Ambient + (1.0 - u_Ambient) * diffuse;
+    FragColor = vec4(v_Color.rgb * light, v_Color.a);
+}
\ No newline at end of file
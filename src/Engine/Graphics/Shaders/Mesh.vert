@@ -0,0 +1,27 @@
+#version 330 core
+
+layout (location = 0) in vec3 a_Position;
+layout (location = 1) in vec3 a_Normal;
+layout (location = 2) in vec2 a_TexCoord;
+layout (location = 3) in vec4 a_Color;
+layout (location = 4) in mat4 a_Transform;      // Por instancia (4-7)
+layout (location = 8) in vec4 a_InstanceColor;
+
+uniform mat4 u_ViewProjection;
+
+out vec3 v_Normal;
+out vec2 v_TexCoord;
+out vec4 v_Color;
+
+void main() {
+    // Matriz de cofactores: inversa traspuesta salvo escala, sin invertir por vértice.
+    // Con determinante negativo (espejo) apunta hacia dentro: se corrige con su signo
+    mat3 model = mat3(a_Transform);
+    mat3 normalMatrix = mat3(cross(model[1], model[2]), cross(model[2], model[0]), cross(model[0], model[1]));
+    normalMatrix *= sign(determinant(model));
+
+    v_Normal = normalMatrix * a_Normal;
+    v_TexCoord = a_TexCoord;
+    v_Color = a_Color * a_InstanceColor;
+    gl_Position = u_ViewProjection * (a_Transform * vec4(a_Position, 1.0));
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#version 430 core
+
+// Debe coincidir con Renderer::QuadInstance (std430, 64 bytes)
+struct QuadInstance {
+    vec2 position;
+    vec2 size;
+    vec2 pivot;
+    float rotation;
+    float texIndex;
+    vec4 color;
+    vec4 texRect;
+};
+
+layout (std430, binding = 0) readonly buffer Instances {
+    QuadInstance u_Instances[];
+};
+
+// Índice de la instancia visible, escrito por QuadCull.comp (divisor 1)
+layout (location = 0) in uint a_InstanceIndex;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+flat out int v_TexIndex;
+
+// Esquinas (0,0) (1,0) (1,1) (0,1), igual que el patrón de índices
+const vec2 c_Corners[4] = vec2[4](vec2(0.0, 0.0), vec2(1.0, 0.0), vec2(1.0, 1.0), vec2(0.0, 1.0));
+
+void main() {
+    QuadInstance quad = u_Instances[a_InstanceIndex];
+    vec2 corner = c_Corners[gl_VertexID];
+
+    vec2 local = (corner - quad.pivot) * quad.size;
+    float s = sin(quad.rotation);
+    float c = cos(quad.rotation);
+    vec2 world = quad.position + quad.pivot * quad.size + vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+    v_Color = quad.color;
+    v_TexCoord = mix(quad.texRect.xy, quad.texRect.zw, corner);
+    v_TexIndex = int(quad.texIndex);
+    gl_Position = u_ViewProjection * vec4(world, 0.0, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#version 330 core
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+flat in int v_TexIndex;
+
+out vec4 FragColor;
+
+// 15 slots: la unidad 15 es u_Lights, así el shader no pasa de las 16 unidades
+// de textura que garantiza OpenGL 3.3 (Renderer::LitTextureSlots)
+uniform sampler2D u_Textures[15];
+
+// Luces por tile (Lighting2D): cabecera (inicio, número) por tile, dos texels por
+// luz (x, y, radio en píxeles, intensidad) y (r, g, b, 0) e índices de 4 en 4
+uniform samplerBuffer u_Lights;
+uniform int u_LightTilesX;
+uniform int u_LightTilesY;
+uniform int u_LightDataOffset;
+uniform int u_LightIndexOffset;
+uniform vec2 u_LightOrigin;
+uniform vec3 u_Ambient;
+
+const int LightTileSize = 32;
+
+vec3 ComputeLighting() {
+    vec2 pixel = gl_FragCoord.xy - u_LightOrigin;
+    ivec2 tile = clamp(ivec2(pixel) / LightTileSize, ivec2(0), ivec2(u_LightTilesX - 1, u_LightTilesY - 1));
+    vec4 header = texelFetch(u_Lights, tile.y * u_LightTilesX + tile.x);
+    int first = int(header.x);
+    int count = int(header.y);
+
+    vec3 light = u_Ambient;
+    for (int k = 0; k < count; k++) {
+        int entry = first + k;
+        int index = int(texelFetch(u_Lights, u_LightIndexOffset + (entry >> 2))[entry & 3]);
+        vec4 shape = texelFetch(u_Lights, u_LightDataOffset + index * 2);
+        vec3 color = texelFetch(u_Lights, u_LightDataOffset + index * 2 + 1).rgb;
+
+        // Caída suave hasta cero en el radio
+        vec2 delta = pixel - shape.xy;
+        float falloff = clamp(1.0 - dot(delta, delta) / (shape.z * shape.z), 0.0, 1.0);
+        light += color * shape.w * falloff * falloff;
+    }
+    return light;
+}
+
+void main() {
+    // GLSL 3.30 sólo permite indexar arrays de samplers con constantes.
+    // Los índices desde 16 son campos de distancia en el slot (índice - 16)
+    vec4 texColor;
+    switch (v_TexIndex & 15) {
+        case 0: texColor = texture(u_Textures[0], v_TexCoord); break;
+        case 1: texColor = texture(u_Textures[1], v_TexCoord); break;
+        case 2: texColor = texture(u_Textures[2], v_TexCoord); break;
+        case 3: texColor = texture(u_Textures[3], v_TexCoord); break;
+        case 4: texColor = texture(u_Textures[4], v_TexCoord); break;
+        case 5: texColor = texture(u_Textures[5], v_TexCoord); break;
+        case 6: texColor = texture(u_Textures[6], v_TexCoord); break;
+        case 7: texColor = texture(u_Textures[7], v_TexCoord); break;
+        case 8: texColor = texture(u_Textures[8], v_TexCoord); break;
+        case 9: texColor = texture(u_Textures[9], v_TexCoord); break;
+        case 10: texColor = texture(u_Textures[10], v_TexCoord); break;
+        case 11: texColor = texture(u_Textures[11], v_TexCoord); break;
+        case 12: texColor = texture(u_Textures[12], v_TexCoord); break;
+        case 13: texColor = texture(u_Textures[13], v_TexCoord); break;
+        case 14: texColor = texture(u_Textures[14], v_TexCoord); break;
+        default: texColor = vec4(1.0); break;
+    }
+
+    // Borde en 0.5; fwidth mantiene un antialias de un píxel con cualquier zoom
+    if (v_TexIndex >= 16) {
+        float distance = texColor.a;
+        float width = max(fwidth(distance), 1.0e-4);
+        texColor = vec4(1.0, 1.0, 1.0, smoothstep(0.5 - width, 0.5 + width, distance));
+    }
+
+    vec4 color = texColor * v_Color;
+    FragColor = vec4(color.rgb * ComputeLighting(), color.a);
+}
\ No newline at end of file
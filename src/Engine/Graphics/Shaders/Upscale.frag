@@ -0,0 +1,33 @@
+#version 330 core
+
+in vec2 v_TexCoord;
+
+out vec4 FragColor;
+
+uniform sampler2D u_Scene;
+uniform vec2 u_UVScale;     // Parte usada del render target (resolución actual / reservada)
+uniform vec2 u_UVMax;       // Centro del último texel usado: el bilineal no lee fuera
+uniform vec2 u_TexelSize;
+uniform float u_Sharpness;  // 0 = bilineal
+
+void main() {
+    vec2 uv = min(v_TexCoord * u_UVScale, u_UVMax);
+    vec4 center = texture(u_Scene, uv);
+
+    if (u_Sharpness <= 0.0) {
+        FragColor = center;
+        return;
+    }
+
+    // Máscara de enfoque en cruz, limitada al rango de los vecinos para no crear halos
+    vec4 north = texture(u_Scene, min(uv + vec2(0.0, u_TexelSize.y), u_UVMax));
+    vec4 south = texture(u_Scene, uv - vec2(0.0, u_TexelSize.y));
+    vec4 east = texture(u_Scene, min(uv + vec2(u_TexelSize.x, 0.0), u_UVMax));
+    vec4 west = texture(u_Scene, uv - vec2(u_TexelSize.x, 0.0));
+
+    vec4 minColor = min(center, min(min(north, south), min(east, west)));
+    vec4 maxColor = max(center, max(max(north, south), max(east, west)));
+    vec4 sharpened = center + (4.0 * center - north - south - east - west) * u_Sharpness;
+
+    FragColor = clamp(sharpened, minColor, maxColor);
+}
\ No newline at end of file
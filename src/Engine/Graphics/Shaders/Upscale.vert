@@ -0,0 +1,10 @@
+#version 330 core
+
+// Triángulo que cubre la pantalla, sin buffers: vértices (-1,-1) (3,-1) (-1,3)
+out vec2 v_TexCoord;
+
+void main() {
+    vec2 corner = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    v_TexCoord = corner;
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
\ No newline at end of file
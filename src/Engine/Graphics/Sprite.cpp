@@ -1,9 +1,9 @@
 #include "Graphics/Sprite.h"
 #include "Graphics/Shader.h"  // Necesitaremos esto para nuestro renderizado
 #include "Core/Log.h"
+#include "Math/QuadTransform.h"
 
 #include <GL/glew.h>
-#include <glm/gtc/matrix_transform.hpp>
 
 namespace Destiny {
 
@@ -13,11 +13,34 @@ Sprite::Sprite(const std::shared_ptr<Texture>& texture)
 }
 
 Sprite::Sprite(const std::string& texturePath)
-    : m_Texture(std::make_shared<Texture>(texturePath)) {
+    : m_TextureHandle(AssetRegistry::Get().AcquireTexture(texturePath)) {
     Init();
 }
 
+Sprite::~Sprite() {
+    glDeleteBuffers(1, &m_VBO);
+    glDeleteBuffers(1, &m_IBO);
+    glDeleteVertexArrays(1, &m_VAO);
+    
+    // Si el registro ya se destruyó, sus texturas y shaders ya se liberaron con él
+    if (!AssetRegistry::HasInstance())
+        return;
+
+    AssetRegistry::Get().Release(m_ShaderHandle);
+    if (m_TextureHandle.IsValid())
+        AssetRegistry::Get().Release(m_TextureHandle);
+}
+
+std::shared_ptr<Texture> Sprite::GetTexture() const {
+    if (m_TextureHandle.IsValid())
+        return AssetRegistry::Get().GetTexture(m_TextureHandle);
+    return m_Texture;
+}
+
 void Sprite::Init() {
+    // Shader compartido por todos los sprites
+    m_ShaderHandle = AssetRegistry::Get().AcquireShader("shaders/Sprite.vert", "shaders/Sprite.frag");
+    
     // Crear VAO
     glGenVertexArrays(1, &m_VAO);
     glBindVertexArray(m_VAO);
@@ -30,10 +53,10 @@ void Sprite::Init() {
     // Por ahora, solo reservamos espacio
     float vertices[] = {
         // Pos      // Tex
-        0.0f, 1.0f, 0.0f, 1.0f,
-        1.0f, 0.0f, 1.0f, 0.0f,
         0.0f, 0.0f, 0.0f, 0.0f,
-        1.0f, 1.0f, 1.0f, 1.0f
+        1.0f, 0.0f, 1.0f, 0.0f,
+        1.0f, 1.0f, 1.0f, 1.0f,
+        0.0f, 1.0f, 0.0f, 1.0f
     };
     
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_DYNAMIC_DRAW);
@@ -44,7 +67,7 @@ void Sprite::Init() {
     
     unsigned int indices[] = {
         0, 1, 2,  // Primer triángulo
-        0, 3, 1   // Segundo triángulo
+        2, 3, 0   // Segundo triángulo
     };
     
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
@@ -69,37 +92,27 @@ void Sprite::SetTextureRegion(const glm::vec2& min, const glm::vec2& max) {
 }
 
 void Sprite::Draw(const glm::vec2& position, const glm::vec2& size, float rotation) {
-    // Aquí asumimos que tenemos un shader para sprites
-    // En una implementación completa, necesitaríamos manejar esto adecuadamente
-    static Shader* spriteShader = nullptr;
-    
-    if (!spriteShader) {
-        // Crear un shader básico para sprites si no existe
-        // Normalmente esto se haría en el sistema de recursos
-        spriteShader = new Shader("shaders/sprite.vert", "shaders/sprite.frag");
-    }
+    Shader* spriteShader = AssetRegistry::Get().GetShader(m_ShaderHandle);
+    std::shared_ptr<Texture> texture = GetTexture();
+    if (!spriteShader || !texture)
+        return;
     
     spriteShader->Bind();
     
-    // Calcular matriz de modelo
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, glm::vec3(position, 0.0f));
-    
-    // Rotar alrededor del centro del sprite
-    model = glm::translate(model, glm::vec3(0.5f * size.x, 0.5f * size.y, 0.0f));
-    model = glm::rotate(model, glm::radians(rotation), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::translate(model, glm::vec3(-0.5f * size.x, -0.5f * size.y, 0.0f));
-    
-    // Escalar
-    model = glm::scale(model, glm::vec3(size, 1.0f));
+    // Colocar las esquinas en el mundo con el kernel de quads (giro en el centro)
+    float rotationRad = glm::radians(rotation);
+    float pivot = 0.5f;
+    QuadTransformInput input = { &position.x, &position.y, &size.x, &size.y, &rotationRad, &pivot, &pivot };
+    float corners[8];
+    QuadTransform::Compute(input, 1, corners);
     
     // Actualizar vértices con las coordenadas de textura adecuadas
     float vertices[] = {
-        // Pos      // Tex
-        0.0f, 1.0f, m_TexCoordMin.x, m_TexCoordMax.y,
-        1.0f, 0.0f, m_TexCoordMax.x, m_TexCoordMin.y,
-        0.0f, 0.0f, m_TexCoordMin.x, m_TexCoordMin.y,
-        1.0f, 1.0f, m_TexCoordMax.x, m_TexCoordMax.y
+        // Pos                     // Tex
+        corners[0], corners[1], m_TexCoordMin.x, m_TexCoordMin.y,
+        corners[2], corners[3], m_TexCoordMax.x, m_TexCoordMin.y,
+        corners[4], corners[5], m_TexCoordMax.x, m_TexCoordMax.y,
+        corners[6], corners[7], m_TexCoordMin.x, m_TexCoordMax.y
     };
     
     glBindVertexArray(m_VAO);
@@ -107,11 +120,11 @@ void Sprite::Draw(const glm::vec2& position, const glm::vec2& size, float rotati
     glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
     
     // Establecer uniforms
-    spriteShader->SetMat4("u_Model", model);
-    spriteShader->SetVec4("u_Color", m_Color);
+    spriteShader->SetMat4("u_Model", glm::mat4(1.0f));
+    spriteShader->SetFloat4("u_Color", m_Color);
     
     // Enlazar textura
-    m_Texture->Bind();
+    texture->Bind();
     spriteShader->SetInt("u_Texture", 0); // Unidad de textura 0
     
     // Renderizar
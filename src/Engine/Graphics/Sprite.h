@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Graphics/Texture.h"
+#include "Assets/AssetRegistry.h"
 #include <memory>
 #include <glm/glm.hpp>
 
@@ -9,24 +10,33 @@ namespace Destiny {
 class Sprite {
 public:
     Sprite(const std::shared_ptr<Texture>& texture);
+    // La textura se comparte entre todos los sprites con la misma ruta (AssetRegistry)
     Sprite(const std::string& texturePath);
-    ~Sprite() = default;
+    ~Sprite();
+
+    // No permitir copia
+    Sprite(const Sprite&) = delete;
+    Sprite& operator=(const Sprite&) = delete;
 
     // Renderizar el sprite
     void Draw(const glm::vec2& position, const glm::vec2& size = glm::vec2(1.0f), float rotation = 0.0f);
     
     // Establecer región de textura (para spritesheet)
     void SetTextureRegion(const glm::vec2& min, const glm::vec2& max);
+    const glm::vec2& GetTexCoordMin() const { return m_TexCoordMin; }
+    const glm::vec2& GetTexCoordMax() const { return m_TexCoordMax; }
     
     // Establecer color de tinte
     void SetColor(const glm::vec4& color) { m_Color = color; }
     const glm::vec4& GetColor() const { return m_Color; }
     
-    // Acceso a la textura
-    std::shared_ptr<Texture> GetTexture() const { return m_Texture; }
+    // Acceso a la textura (la recarga si el registro la había expulsado)
+    std::shared_ptr<Texture> GetTexture() const;
 
 private:
-    std::shared_ptr<Texture> m_Texture;
+    std::shared_ptr<Texture> m_Texture;      // Textura externa, fuera del registro
+    TextureHandle m_TextureHandle;           // Textura gestionada por el registro
+    ShaderHandle m_ShaderHandle;
     glm::vec2 m_TexCoordMin = { 0.0f, 0.0f };
     glm::vec2 m_TexCoordMax = { 1.0f, 1.0f };
     glm::vec4 m_Color = { 1.0f, 1.0f, 1.0f, 1.0f }; // Color blanco por defecto
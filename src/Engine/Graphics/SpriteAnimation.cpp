@@ -0,0 +1,268 @@
+#include "SpriteAnimation.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace Destiny {
+
+// Por debajo de esto no compensa repartir entre hilos
+static constexpr uint32_t MinAnimatorsPerJob = 4096;
+
+// Duración mínima de un frame para evitar divisiones por cero
+static constexpr float MinFrameDuration = 1.0e-4f;
+
+AnimationClip AnimationClip::FromGrid(const std::string& name, const glm::vec2& atlasSize, const glm::vec2& frameSize,
+                                      uint32_t firstFrame, uint32_t frameCount, float framesPerSecond,
+                                      AnimationLoop loop) {
+    AnimationClip clip;
+    clip.name = name;
+    clip.loop = loop;
+
+    uint32_t columns = std::max(1u, static_cast<uint32_t>(atlasSize.x / frameSize.x));
+    float frameU = frameSize.x / atlasSize.x;
+    float frameV = frameSize.y / atlasSize.y;
+    float duration = 1.0f / std::max(framesPerSecond, 1.0e-3f);
+
+    // Las texturas se suben de abajo arriba: la fila 0 del atlas está en v = 1
+    for (uint32_t i = 0; i < frameCount; i++) {
+        uint32_t frame = firstFrame + i;
+        float u = (frame % columns) * frameU;
+        float vMax = 1.0f - (frame / columns) * frameV;
+        clip.frames.push_back({ { u, vMax - frameV }, { u + frameU, vMax }, duration });
+    }
+
+    return clip;
+}
+
+SpriteAnimationSystem::SpriteAnimationSystem(JobSystem* jobSystem)
+    : m_JobSystem(jobSystem) {
+    // Frame 0: textura completa, para animadores sin clip
+    m_FrameRects.push_back({ 0.0f, 0.0f, 1.0f, 1.0f });
+    m_FrameEnds.push_back(1.0f);
+}
+
+uint32_t SpriteAnimationSystem::AddClip(const AnimationClip& clip) {
+    if (clip.frames.empty()) {
+        DESTINY_CORE_WARN("Clip de animación sin frames: {0}", clip.name);
+        return InvalidClip;
+    }
+
+    ClipInfo info;
+    info.name = clip.name;
+    info.firstFrame = static_cast<uint32_t>(m_FrameRects.size());
+    info.frameCount = static_cast<uint32_t>(clip.frames.size());
+    info.loop = clip.loop;
+    info.duration = 0.0f;
+
+    bool uniform = true;
+    for (const AnimationFrame& frame : clip.frames) {
+        float duration = std::max(frame.duration, MinFrameDuration);
+        uniform = uniform && duration == std::max(clip.frames[0].duration, MinFrameDuration);
+
+        info.duration += duration;
+        m_FrameRects.push_back({ frame.texCoordMin.x, frame.texCoordMin.y, frame.texCoordMax.x, frame.texCoordMax.y });
+        m_FrameEnds.push_back(info.duration);
+    }
+    info.frameDuration = uniform ? info.duration / info.frameCount : 0.0f;
+
+    m_Clips.push_back(info);
+    m_Stats.clipCount = static_cast<uint32_t>(m_Clips.size());
+    return static_cast<uint32_t>(m_Clips.size() - 1);
+}
+
+uint32_t SpriteAnimationSystem::FindClip(const std::string& name) const {
+    for (uint32_t i = 0; i < m_Clips.size(); i++) {
+        if (m_Clips[i].name == name)
+            return i;
+    }
+    return InvalidClip;
+}
+
+void SpriteAnimationSystem::Resize(uint32_t count) {
+    // Los animadores nuevos empiezan sin clip (frame 0, parados)
+    m_Time.resize(count, 0.0f);
+    m_Speed.resize(count, 0.0f);
+    m_Duration.resize(count, 1.0f);
+    m_InvFrameDuration.resize(count, 1.0f);
+    m_Clip.resize(count, InvalidClip);
+    m_FirstFrame.resize(count, 0);
+    m_LastFrame.resize(count, 0);
+    m_Loop.resize(count, static_cast<uint8_t>(AnimationLoop::Once));
+    m_Frame.resize(count, 0);
+    m_TexRects.resize(static_cast<size_t>(count) * 4, 0.0f);
+}
+
+void SpriteAnimationSystem::SwapRemove(uint32_t index) {
+    // Con el sistema vacío GetCount() - 1 daría la vuelta
+    if (index >= GetCount()) {
+        DESTINY_CORE_WARN("Animador fuera de rango: {0} (hay {1})", index, GetCount());
+        return;
+    }
+
+    uint32_t last = GetCount() - 1;
+    if (index != last) {
+        m_Time[index] = m_Time[last];
+        m_Speed[index] = m_Speed[last];
+        m_Duration[index] = m_Duration[last];
+        m_InvFrameDuration[index] = m_InvFrameDuration[last];
+        m_Clip[index] = m_Clip[last];
+        m_FirstFrame[index] = m_FirstFrame[last];
+        m_LastFrame[index] = m_LastFrame[last];
+        m_Loop[index] = m_Loop[last];
+        m_Frame[index] = m_Frame[last];
+        std::copy_n(&m_TexRects[static_cast<size_t>(last) * 4], 4, &m_TexRects[static_cast<size_t>(index) * 4]);
+    }
+    Resize(last);
+}
+
+void SpriteAnimationSystem::Play(uint32_t index, uint32_t clip, float speed, float startTime) {
+    if (clip >= m_Clips.size()) {
+        DESTINY_CORE_WARN("Clip de animación inválido: {0}", clip);
+        return;
+    }
+
+    const ClipInfo& info = m_Clips[clip];
+    m_Clip[index] = clip;
+    m_Time[index] = startTime;
+    m_Speed[index] = speed;
+    m_Duration[index] = info.duration;
+    m_InvFrameDuration[index] = info.frameDuration > 0.0f ? 1.0f / info.frameDuration : 0.0f;
+    m_FirstFrame[index] = info.firstFrame;
+    m_LastFrame[index] = info.frameCount - 1;
+    m_Loop[index] = static_cast<uint8_t>(info.loop);
+}
+
+bool SpriteAnimationSystem::IsFinished(uint32_t index) const {
+    return m_Loop[index] == static_cast<uint8_t>(AnimationLoop::Once) && m_Time[index] >= m_Duration[index];
+}
+
+void SpriteAnimationSystem::Update(float deltaTime) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    uint32_t count = GetCount();
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(count, MinAnimatorsPerJob, [this, deltaTime](uint32_t begin, uint32_t end) {
+            UpdateRange(begin, end, deltaTime);
+        });
+    }
+    else {
+        UpdateRange(0, count, deltaTime);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.updateMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.animatorCount = count;
+}
+
+void SpriteAnimationSystem::UpdateRange(uint32_t begin, uint32_t end, float deltaTime) {
+    const uint8_t once = static_cast<uint8_t>(AnimationLoop::Once);
+    const uint8_t pingPong = static_cast<uint8_t>(AnimationLoop::PingPong);
+
+    // 1. Tiempo y frame. SSE2 de cuatro en cuatro y el resto en escalar, con el
+    //    mismo resultado bit a bit: el frame se acota en float antes de convertir
+    //    para que la conversión esté definida en los dos caminos
+    uint32_t i = begin;
+
+#ifdef DESTINY_SIMD_X86
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    const __m128 exactLimit = _mm_set1_ps(8388608.0f);   // 2^23: a partir de aquí todo float es entero
+    const __m128 delta = _mm_set1_ps(deltaTime);
+    const __m128i onceMode = _mm_set1_epi32(once);
+    const __m128i pingPongMode = _mm_set1_epi32(pingPong);
+
+    for (; i + 4 <= end; i += 4) {
+        __m128 duration = _mm_loadu_ps(&m_Duration[i]);
+        __m128 time = _mm_add_ps(_mm_loadu_ps(&m_Time[i]), _mm_mul_ps(delta, _mm_loadu_ps(&m_Speed[i])));
+
+        int32_t loopBytes;
+        std::memcpy(&loopBytes, &m_Loop[i], sizeof(loopBytes));
+        __m128i loop = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(loopBytes), _mm_setzero_si128()),
+                                          _mm_setzero_si128());
+        __m128 isOnce = _mm_castsi128_ps(_mm_cmpeq_epi32(loop, onceMode));
+        __m128 isPingPong = _mm_castsi128_ps(_mm_cmpeq_epi32(loop, pingPongMode));
+
+        __m128 period = _mm_or_ps(_mm_and_ps(isPingPong, _mm_mul_ps(duration, two)), _mm_andnot_ps(isPingPong, duration));
+
+        // floor sin SSE4.1: truncar conservando el signo del cero y restar 1 si se
+        // pasó; los valores ya enteros, infinitos o NaN se quedan como están
+        __m128 quotient = _mm_div_ps(time, period);
+        __m128 truncated = _mm_or_ps(_mm_cvtepi32_ps(_mm_cvttps_epi32(quotient)), _mm_and_ps(quotient, signMask));
+        truncated = _mm_sub_ps(truncated, _mm_and_ps(_mm_cmpgt_ps(truncated, quotient), one));
+        __m128 small = _mm_cmplt_ps(_mm_andnot_ps(signMask, quotient), exactLimit);
+        __m128 floored = _mm_or_ps(_mm_and_ps(small, truncated), _mm_andnot_ps(small, quotient));
+
+        __m128 wrapped = _mm_sub_ps(time, _mm_mul_ps(floored, period));
+        __m128 clamped = _mm_min_ps(duration, _mm_max_ps(zero, time));
+        time = _mm_or_ps(_mm_and_ps(isOnce, clamped), _mm_andnot_ps(isOnce, wrapped));
+        _mm_storeu_ps(&m_Time[i], time);
+
+        __m128 backwards = _mm_and_ps(isPingPong, _mm_cmpge_ps(time, duration));
+        __m128 local = _mm_or_ps(_mm_and_ps(backwards, _mm_sub_ps(period, time)), _mm_andnot_ps(backwards, time));
+
+        __m128i lastFrame = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&m_LastFrame[i]));
+        __m128 frame = _mm_mul_ps(local, _mm_loadu_ps(&m_InvFrameDuration[i]));
+        frame = _mm_min_ps(_mm_max_ps(frame, zero), _mm_cvtepi32_ps(lastFrame));
+
+        __m128i firstFrame = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&m_FirstFrame[i]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(&m_Frame[i]), _mm_add_epi32(firstFrame, _mm_cvttps_epi32(frame)));
+    }
+#endif
+
+    for (; i < end; i++) {
+        float duration = m_Duration[i];
+        float time = m_Time[i] + deltaTime * m_Speed[i];
+        uint8_t loop = m_Loop[i];
+
+        float period = loop == pingPong ? duration * 2.0f : duration;
+        float wrapped = time - std::floor(time / period) * period;
+        float clamped = std::min(std::max(time, 0.0f), duration);
+        time = loop == once ? clamped : wrapped;
+        m_Time[i] = time;
+
+        // En ping-pong la segunda mitad recorre el clip hacia atrás. Un NaN acaba en el frame 0
+        float local = (loop == pingPong && time >= duration) ? period - time : time;
+        float frame = local * m_InvFrameDuration[i];
+        frame = frame > 0.0f ? frame : 0.0f;
+        frame = frame < static_cast<float>(m_LastFrame[i]) ? frame : static_cast<float>(m_LastFrame[i]);
+        m_Frame[i] = m_FirstFrame[i] + static_cast<uint32_t>(frame);
+    }
+
+    // 2. Región de cada frame; los clips con duraciones distintas buscan su frame aquí
+    for (uint32_t i = begin; i < end; i++) {
+        if (m_InvFrameDuration[i] == 0.0f && m_LastFrame[i] > 0) {
+            const ClipInfo& clip = m_Clips[m_Clip[i]];
+            float time = m_Time[i];
+            float local = (clip.loop == AnimationLoop::PingPong && time >= clip.duration) ? clip.duration * 2.0f - time : time;
+            m_Frame[i] = FindVariableFrame(clip, local);
+        }
+
+        const glm::vec4& rect = m_FrameRects[m_Frame[i]];
+        float* out = &m_TexRects[static_cast<size_t>(i) * 4];
+        out[0] = rect.x;
+        out[1] = rect.y;
+        out[2] = rect.z;
+        out[3] = rect.w;
+    }
+}
+
+uint32_t SpriteAnimationSystem::FindVariableFrame(const ClipInfo& clip, float time) const {
+    auto first = m_FrameEnds.begin() + clip.firstFrame;
+    auto last = first + clip.frameCount;
+    auto it = std::upper_bound(first, last, time);
+    uint32_t frame = static_cast<uint32_t>(std::min<ptrdiff_t>(it - first, clip.frameCount - 1));
+    return clip.firstFrame + frame;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class JobSystem;
+
+// Modo de repetición de un clip
+enum class AnimationLoop : uint8_t {
+    Once = 0,     // Se queda en el último frame
+    Loop,
+    PingPong
+};
+
+struct AnimationFrame {
+    glm::vec2 texCoordMin;
+    glm::vec2 texCoordMax;
+    float duration;           // Segundos
+};
+
+// Secuencia de regiones de un atlas
+struct AnimationClip {
+    std::string name;
+    std::vector<AnimationFrame> frames;
+    AnimationLoop loop = AnimationLoop::Loop;
+
+    // Frames de una rejilla de atlasSize píxeles, de izquierda a derecha y de arriba abajo
+    static AnimationClip FromGrid(const std::string& name, const glm::vec2& atlasSize, const glm::vec2& frameSize,
+                                  uint32_t firstFrame, uint32_t frameCount, float framesPerSecond,
+                                  AnimationLoop loop = AnimationLoop::Loop);
+};
+
+// Animación de sprites en bloque. El estado de cada animador vive en columnas
+// (índice = índice de la unidad en el juego) y Update avanza todos a la vez:
+// primero el tiempo y el frame (SSE2, cuatro animadores a la vez), después copia la región
+// de cada frame a GetTexRects(), que se pasa tal cual a Renderer::DrawQuads.
+class SpriteAnimationSystem {
+public:
+    SpriteAnimationSystem(JobSystem* jobSystem = nullptr);
+
+    // No permitir copia
+    SpriteAnimationSystem(const SpriteAnimationSystem&) = delete;
+    SpriteAnimationSystem& operator=(const SpriteAnimationSystem&) = delete;
+
+    // Clips compartidos por todos los animadores
+    uint32_t AddClip(const AnimationClip& clip);
+    uint32_t FindClip(const std::string& name) const;   // InvalidClip si no existe
+    static constexpr uint32_t InvalidClip = 0xffffffff;
+
+    // Animadores: uno por índice, siguiendo los arrays de unidades del juego
+    void Resize(uint32_t count);
+    void SwapRemove(uint32_t index);                    // Igual que el borrado del juego
+    uint32_t GetCount() const { return static_cast<uint32_t>(m_Time.size()); }
+
+    void Play(uint32_t index, uint32_t clip, float speed = 1.0f, float startTime = 0.0f);
+    void SetSpeed(uint32_t index, float speed) { m_Speed[index] = speed; }
+    bool IsFinished(uint32_t index) const;
+
+    // Avanzar todos los animadores y actualizar sus regiones
+    void Update(float deltaTime);
+
+    // 4 floats por animador: minU, minV, maxU, maxV
+    const float* GetTexRects() const { return m_TexRects.data(); }
+
+    // Estadísticas
+    struct Stats {
+        float updateMs = 0.0f;
+        uint32_t animatorCount = 0;
+        uint32_t clipCount = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct ClipInfo {
+        std::string name;
+        uint32_t firstFrame;        // En m_FrameRects
+        uint32_t frameCount;
+        float duration;
+        float frameDuration;        // Si todos los frames duran lo mismo; 0 si no
+        AnimationLoop loop;
+    };
+
+    void UpdateRange(uint32_t begin, uint32_t end, float deltaTime);
+    uint32_t FindVariableFrame(const ClipInfo& clip, float time) const;
+
+    JobSystem* m_JobSystem;
+
+    // Clips aplanados: regiones y fin acumulado de cada frame
+    std::vector<ClipInfo> m_Clips;
+    std::vector<glm::vec4> m_FrameRects;
+    std::vector<float> m_FrameEnds;
+
+    // Estado por animador (SoA); los datos del clip se copian para no saltar a m_Clips
+    std::vector<float> m_Time;
+    std::vector<float> m_Speed;
+    std::vector<float> m_Duration;
+    std::vector<float> m_InvFrameDuration;   // 0 = duración variable
+    std::vector<uint32_t> m_Clip;
+    std::vector<uint32_t> m_FirstFrame;
+    std::vector<uint32_t> m_LastFrame;       // frameCount - 1
+    std::vector<uint8_t> m_Loop;
+
+    std::vector<uint32_t> m_Frame;
+    std::vector<float> m_TexRects;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
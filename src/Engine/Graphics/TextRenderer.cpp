@@ -0,0 +1,156 @@
+#include "TextRenderer.h"
+#include "Font.h"
+#include "Renderer.h"
+
+#include <algorithm>
+
+namespace Destiny {
+
+// Siguiente codepoint de una cadena UTF-8; las secuencias inválidas dan U+FFFD
+static uint32_t DecodeUTF8(const std::string& text, size_t& i) {
+    uint8_t c = static_cast<uint8_t>(text[i++]);
+    if (c < 0x80)
+        return c;
+
+    uint32_t length = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+    if (length == 0 || i + length > text.size())
+        return 0xFFFD;
+
+    uint32_t codepoint = c & (0x3F >> length);
+    for (uint32_t k = 0; k < length; k++) {
+        uint8_t next = static_cast<uint8_t>(text[i]);
+        if ((next & 0xC0) != 0x80)
+            return 0xFFFD;
+        codepoint = (codepoint << 6) | (next & 0x3F);
+        i++;
+    }
+    return codepoint;
+}
+
+TextRenderer::TextRenderer(const std::shared_ptr<Font>& font)
+    : m_Font(font) {
+}
+
+void TextRenderer::DrawString(const std::string& text, const glm::vec2& position, float size, const glm::vec4& color) {
+    const ShapedRun& run = GetRun(text);
+    size_t count = run.offsetX.size();
+    size_t first = m_PositionX.size();
+
+    m_PositionX.resize(first + count);
+    m_PositionY.resize(first + count);
+    m_SizeX.resize(first + count);
+    m_SizeY.resize(first + count);
+    m_Colors.resize((first + count) * 4);
+
+    for (size_t i = 0; i < count; i++) {
+        m_PositionX[first + i] = position.x + run.offsetX[i] * size;
+        m_PositionY[first + i] = position.y + run.offsetY[i] * size;
+        m_SizeX[first + i] = run.sizeX[i] * size;
+        m_SizeY[first + i] = run.sizeY[i] * size;
+
+        float* c = &m_Colors[(first + i) * 4];
+        c[0] = color.x;
+        c[1] = color.y;
+        c[2] = color.z;
+        c[3] = color.w;
+    }
+    m_TexRects.insert(m_TexRects.end(), run.texRects.begin(), run.texRects.end());
+
+    m_FrameStats.labelCount++;
+    m_FrameStats.glyphCount += static_cast<uint32_t>(count);
+}
+
+glm::vec2 TextRenderer::MeasureText(const std::string& text, float size) {
+    return GetRun(text).extent * size;
+}
+
+void TextRenderer::Submit(Renderer& renderer) {
+    // Los glifos nuevos de este frame se suben una vez, antes de dibujar
+    m_Font->UploadAtlas();
+
+    uint32_t count = static_cast<uint32_t>(m_PositionX.size());
+    if (count > 0) {
+        QuadBatchInput input;
+        input.positionX = m_PositionX.data();
+        input.positionY = m_PositionY.data();
+        input.sizeX = m_SizeX.data();
+        input.sizeY = m_SizeY.data();
+        input.texRects = m_TexRects.data();
+        input.colors = m_Colors.data();
+        input.distanceField = true;
+        renderer.DrawQuads(input, count, m_Font->GetAtlas());
+    }
+
+    EvictUnusedRuns();
+
+    m_FrameStats.cachedRuns = static_cast<uint32_t>(m_Runs.size());
+    m_Stats = m_FrameStats;
+    m_FrameStats = {};
+    m_Frame++;
+
+    m_PositionX.clear();
+    m_PositionY.clear();
+    m_SizeX.clear();
+    m_SizeY.clear();
+    m_TexRects.clear();
+    m_Colors.clear();
+}
+
+const TextRenderer::ShapedRun& TextRenderer::GetRun(const std::string& text) {
+    auto it = m_Runs.find(text);
+    if (it != m_Runs.end()) {
+        it->second.lastFrame = m_Frame;
+        m_FrameStats.cacheHits++;
+        return it->second;
+    }
+
+    m_FrameStats.cacheMisses++;
+    ShapedRun& run = m_Runs[text];
+    ShapeRun(text, run);
+    run.lastFrame = m_Frame;
+    return run;
+}
+
+void TextRenderer::ShapeRun(const std::string& text, ShapedRun& run) {
+    float lineHeight = m_Font->GetLineHeight();
+    glm::vec2 pen(0.0f);
+    float width = 0.0f;
+    uint32_t lines = 1;
+
+    for (size_t i = 0; i < text.size();) {
+        uint32_t codepoint = DecodeUTF8(text, i);
+        if (codepoint == '\n') {
+            width = std::max(width, pen.x);
+            pen = glm::vec2(0.0f, pen.y - lineHeight);
+            lines++;
+            continue;
+        }
+
+        const GlyphInfo& glyph = m_Font->GetGlyph(codepoint);
+        if (glyph.visible) {
+            run.offsetX.push_back(pen.x + glyph.offset.x);
+            run.offsetY.push_back(pen.y + glyph.offset.y);
+            run.sizeX.push_back(glyph.size.x);
+            run.sizeY.push_back(glyph.size.y);
+            run.texRects.insert(run.texRects.end(), { glyph.texRect.x, glyph.texRect.y, glyph.texRect.z, glyph.texRect.w });
+        }
+        pen.x += glyph.advance;
+    }
+
+    run.extent = glm::vec2(std::max(width, pen.x), 1.0f + (lines - 1) * lineHeight);
+}
+
+void TextRenderer::EvictUnusedRuns() {
+    // Una pasada cada RunLifetimeFrames basta para que la caché no crezca sin límite
+    if (m_Frame % RunLifetimeFrames != 0)
+        return;
+
+    for (auto it = m_Runs.begin(); it != m_Runs.end();) {
+        if (m_Frame - it->second.lastFrame > RunLifetimeFrames)
+            it = m_Runs.erase(it);
+        else
+            ++it;
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
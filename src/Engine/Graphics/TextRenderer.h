@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class Font;
+class Renderer;
+
+// Texto en lote con una fuente SDF. Cada cadena se convierte en glifos una sola
+// vez (run en em, guardado mientras se siga dibujando) y en cada frame sólo se
+// escalan y desplazan sus quads a la cola, que Submit envía con una única llamada
+// a Renderer::DrawQuads: miles de etiquetas salen en pocos draws y el texto se ve
+// nítido con cualquier zoom sin volver a generar glifos.
+class TextRenderer {
+public:
+    explicit TextRenderer(const std::shared_ptr<Font>& font);
+
+    // No permitir copia
+    TextRenderer(const TextRenderer&) = delete;
+    TextRenderer& operator=(const TextRenderer&) = delete;
+
+    // position: esquina inferior izquierda de la primera línea; size: alto de la letra en unidades de mundo.
+    // Admite UTF-8 y '\n'.
+    void DrawString(const std::string& text, const glm::vec2& position, float size,
+                    const glm::vec4& color = glm::vec4(1.0f));
+
+    // Tamaño del texto en unidades de mundo
+    glm::vec2 MeasureText(const std::string& text, float size);
+
+    // Enviar la cola del frame al batch del renderer (entre BeginScene y EndScene)
+    void Submit(Renderer& renderer);
+
+    // Runs sin usar durante más frames que esto se descartan
+    static constexpr uint32_t RunLifetimeFrames = 120;
+
+    // Estadísticas del último Submit
+    struct Stats {
+        uint32_t labelCount = 0;
+        uint32_t glyphCount = 0;
+        uint32_t cacheHits = 0;
+        uint32_t cacheMisses = 0;
+        uint32_t cachedRuns = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    // Quads de una cadena en em, relativos a su origen
+    struct ShapedRun {
+        std::vector<float> offsetX, offsetY;
+        std::vector<float> sizeX, sizeY;
+        std::vector<float> texRects;
+        glm::vec2 extent = glm::vec2(0.0f);
+        uint64_t lastFrame = 0;
+    };
+
+    const ShapedRun& GetRun(const std::string& text);
+    void ShapeRun(const std::string& text, ShapedRun& run);
+    void EvictUnusedRuns();
+
+    std::shared_ptr<Font> m_Font;
+    std::unordered_map<std::string, ShapedRun> m_Runs;
+    uint64_t m_Frame = 1;
+
+    // Cola del frame en columnas, tal como las consume DrawQuads
+    std::vector<float> m_PositionX, m_PositionY;
+    std::vector<float> m_SizeX, m_SizeY;
+    std::vector<float> m_TexRects;
+    std::vector<float> m_Colors;
+
+    Stats m_Stats;
+    Stats m_FrameStats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "Texture.h"
+#include "../Core/Log.h"
+#include "../Assets/FileSystem.h"
+
+#include <GL/glew.h>
+#include <cstring>
+#include <vector>
+
+namespace Destiny {
+
+// Imagen TGA decodificada; pixels apunta a los bytes del asset cuando no hace falta conversión
+struct TGAImage {
+    const uint8_t* pixels = nullptr;
+    std::vector<uint8_t> converted;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int channels = 0;
+};
+
+// Decodificar un TGA sin comprimir (tipo 2 color o 3 escala de grises).
+// OpenGL acepta BGR(A) de abajo hacia arriba tal cual, así que el caso habitual
+// se sube sin copiar; sólo la escala de grises y el origen superior se convierten.
+static bool DecodeTGA(const AssetData& file, TGAImage& image) {
+    const uint8_t* data = file.GetData();
+    size_t size = file.GetSize();
+    if (size < 18)
+        return false;
+
+    uint8_t idLength = data[0];
+    uint8_t imageType = data[2];
+    uint8_t bitsPerPixel = data[16];
+    uint8_t descriptor = data[17];
+    image.width = data[12] | (data[13] << 8);
+    image.height = data[14] | (data[15] << 8);
+
+    if (imageType != 2 && imageType != 3)
+        return false;
+    if (bitsPerPixel != 8 && bitsPerPixel != 24 && bitsPerPixel != 32)
+        return false;
+
+    int srcChannels = bitsPerPixel / 8;
+    size_t rowSize = static_cast<size_t>(image.width) * srcChannels;
+    size_t pixelOffset = 18 + static_cast<size_t>(idLength);
+    if (size < pixelOffset + rowSize * image.height)
+        return false;
+
+    const uint8_t* src = data + pixelOffset;
+    bool topToBottom = (descriptor & 0x20) != 0;
+    image.channels = srcChannels == 4 ? 4 : 3;
+
+    if (srcChannels != 1 && !topToBottom) {
+        image.pixels = src;
+        return true;
+    }
+
+    size_t dstRowSize = static_cast<size_t>(image.width) * image.channels;
+    image.converted.resize(dstRowSize * image.height);
+
+    for (uint32_t y = 0; y < image.height; y++) {
+        uint32_t srcRow = topToBottom ? image.height - 1 - y : y;
+        const uint8_t* s = src + srcRow * rowSize;
+        uint8_t* d = &image.converted[y * dstRowSize];
+
+        if (srcChannels == 1) {
+            for (uint32_t x = 0; x < image.width; x++, d += 3)
+                d[0] = d[1] = d[2] = s[x];
+        }
+        else {
+            std::memcpy(d, s, rowSize);
+        }
+    }
+
+    image.pixels = image.converted.data();
+    return true;
+}
+
+Texture::Texture(const std::string& path)
+    : m_Path(path) {
+    AssetData file = FileSystem::Read(path);
+    
+    TGAImage image;
+    if (!file.IsValid() || !DecodeTGA(file, image)) {
+        DESTINY_CORE_ERROR("No se pudo cargar la textura: {0}", path);
+        return;
+    }
+
+    m_Width = image.width;
+    m_Height = image.height;
+    m_Channels = image.channels;
+
+    GLenum internalFormat = m_Channels == 4 ? GL_RGBA8 : GL_RGB8;
+    GLenum dataFormat = m_Channels == 4 ? GL_BGRA : GL_BGR;
+
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_Width, m_Height, 0, dataFormat, GL_UNSIGNED_BYTE, image.pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    DESTINY_CORE_INFO("Textura cargada: {0} ({1}x{2})", path, m_Width, m_Height);
+}
+
+Texture::Texture(uint32_t width, uint32_t height, int channels)
+    : m_Width(width), m_Height(height), m_Channels(channels == 1 ? 1 : 4) {
+    glGenTextures(1, &m_RendererID);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    GLenum internalFormat = m_Channels == 1 ? GL_R8 : GL_RGBA8;
+    GLenum dataFormat = m_Channels == 1 ? GL_RED : GL_RGBA;
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_Width, m_Height, 0, dataFormat, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+Texture::~Texture() {
+    glDeleteTextures(1, &m_RendererID);
+}
+
+void Texture::SetData(const void* data, uint32_t size) {
+    if (size < m_Width * m_Height * m_Channels) {
+        DESTINY_CORE_ERROR("Datos insuficientes para la textura ({0} bytes)", size);
+        return;
+    }
+
+    SetSubData(0, 0, m_Width, m_Height, data);
+}
+
+void Texture::SetSubData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* data) {
+    if (x + width > m_Width || y + height > m_Height) {
+        DESTINY_CORE_ERROR("Región fuera de la textura ({0}, {1}, {2}x{3})", x, y, width, height);
+        return;
+    }
+
+    GLenum dataFormat = m_Channels == 1 ? GL_RED : GL_RGBA;
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Texture::SetLinearFiltering(bool enabled) {
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, enabled ? GL_LINEAR : GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+bool Texture::LoadCoverage(const std::string& path, std::vector<uint8_t>& outPixels,
+                           uint32_t& outWidth, uint32_t& outHeight) {
+    AssetData file = FileSystem::Read(path);
+
+    TGAImage image;
+    if (!file.IsValid() || !DecodeTGA(file, image)) {
+        DESTINY_CORE_ERROR("No se pudo cargar la imagen: {0}", path);
+        return false;
+    }
+
+    outWidth = image.width;
+    outHeight = image.height;
+    outPixels.resize(static_cast<size_t>(image.width) * image.height);
+
+    // DecodeTGA deja las filas de abajo arriba (orden de OpenGL) y en BGR(A)
+    size_t rowSize = static_cast<size_t>(image.width) * image.channels;
+    for (uint32_t y = 0; y < image.height; y++) {
+        const uint8_t* src = image.pixels + (image.height - 1 - y) * rowSize;
+        uint8_t* dst = &outPixels[static_cast<size_t>(y) * image.width];
+
+        for (uint32_t x = 0; x < image.width; x++, src += image.channels) {
+            uint32_t luminance = (src[0] + src[1] + src[2]) / 3;
+            uint32_t alpha = image.channels == 4 ? src[3] : 255;
+            dst[x] = static_cast<uint8_t>(luminance * alpha / 255);
+        }
+    }
+
+    return true;
+}
+
+void Texture::Bind(uint32_t slot) const {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D, m_RendererID);
+}
+
+void Texture::Unbind() const {
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -1,12 +1,16 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace Destiny {
 
 class Texture {
 public:
     Texture(const std::string& path);
+    // channels: 4 = RGBA8, 1 = R8 (máscaras, niebla de guerra)
+    Texture(uint32_t width, uint32_t height, int channels = 4);
     ~Texture();
 
     // No permitir copia
@@ -19,12 +23,27 @@ public:
     // Desactivar la textura
     void Unbind() const;
     
+    // Subir píxeles RGBA8 o R8 según los canales (size en bytes debe cubrir la textura completa)
+    void SetData(const void* data, uint32_t size);
+    
+    // Subir sólo un rectángulo; data son sus píxeles contiguos
+    void SetSubData(uint32_t x, uint32_t y, uint32_t width, uint32_t height, const void* data);
+    
+    // Filtrado bilineal también al ampliar (campos de distancia, texturas no pixel art)
+    void SetLinearFiltering(bool enabled);
+    
+    // Leer un TGA como cobertura de 8 bits, fila 0 arriba (hojas de glifos, máscaras)
+    static bool LoadCoverage(const std::string& path, std::vector<uint8_t>& outPixels,
+                             uint32_t& outWidth, uint32_t& outHeight);
+    
     // Obtener dimensiones
     uint32_t GetWidth() const { return m_Width; }
     uint32_t GetHeight() const { return m_Height; }
     
     // Obtener ID de OpenGL
     uint32_t GetRendererID() const { return m_RendererID; }
+    
+    bool IsLoaded() const { return m_RendererID != 0; }
 
 private:
     uint32_t m_RendererID = 0;
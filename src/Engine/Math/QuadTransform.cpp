@@ -0,0 +1,297 @@
+#include "QuadTransform.h"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+        #define DESTINY_TARGET_AVX2
+    #else
+        #define DESTINY_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace Destiny {
+
+// Constantes de reducción de rango (Cody-Waite, pi/2 en tres partes) y
+// coeficientes minimax de sin/cos en [-pi/4, pi/4]
+static constexpr float TwoOverPi = 0.636619772367581343f;
+static constexpr float HalfPi1 = 1.5703125f;
+static constexpr float HalfPi2 = 4.837512969970703125e-4f;
+static constexpr float HalfPi3 = 7.54978995489188216e-8f;
+
+static constexpr float Sin1 = -1.6666654611e-1f;
+static constexpr float Sin2 = 8.3321608736e-3f;
+static constexpr float Sin3 = -1.9515295891e-4f;
+static constexpr float Cos1 = 4.166664568298827e-2f;
+static constexpr float Cos2 = -1.388731625493765e-3f;
+static constexpr float Cos3 = 2.443315711809948e-5f;
+
+void QuadTransform::FastSinCos(float angle, float& outSin, float& outCos) {
+    float k = std::nearbyint(angle * TwoOverPi);
+    int quadrant = static_cast<int>(k);
+
+    float r = ((angle - k * HalfPi1) - k * HalfPi2) - k * HalfPi3;
+    float z = r * r;
+
+    float s = ((Sin3 * z + Sin2) * z + Sin1) * z * r + r;
+    float c = ((Cos3 * z + Cos2) * z + Cos1) * z * z - 0.5f * z + 1.0f;
+
+    // Cuadrantes impares intercambian seno y coseno; el signo sale de los bits 1
+    float sinValue = (quadrant & 1) ? c : s;
+    float cosValue = (quadrant & 1) ? s : c;
+    outSin = (quadrant & 2) ? -sinValue : sinValue;
+    outCos = ((quadrant + 1) & 2) ? -cosValue : cosValue;
+}
+
+// Un quad; ComputeSSE2/ComputeAVX2 repiten exactamente estas operaciones por carril
+static inline void TransformQuad(const QuadTransformInput& in, uint32_t i, float* out) {
+    float s, c;
+    QuadTransform::FastSinCos(in.rotation[i], s, c);
+
+    float ax = -in.pivotX[i] * in.sizeX[i];
+    float ay = -in.pivotY[i] * in.sizeY[i];
+    float bx = in.sizeX[i] + ax;
+    float by = in.sizeY[i] + ay;
+    float px = in.positionX[i] - ax;
+    float py = in.positionY[i] - ay;
+
+    out[0] = (px + ax * c) - ay * s;  out[1] = (py + ax * s) + ay * c;
+    out[2] = (px + bx * c) - ay * s;  out[3] = (py + bx * s) + ay * c;
+    out[4] = (px + bx * c) - by * s;  out[5] = (py + bx * s) + by * c;
+    out[6] = (px + ax * c) - by * s;  out[7] = (py + ax * s) + by * c;
+}
+
+void QuadTransform::ComputeScalar(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    for (uint32_t i = 0; i < count; i++)
+        TransformQuad(input, i, outCorners + static_cast<size_t>(i) * 8);
+}
+
+#ifdef DESTINY_SIMD_X86
+
+static inline void SinCosSSE2(__m128 angle, __m128& outSin, __m128& outCos) {
+    __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(angle, _mm_set1_ps(TwoOverPi)));
+    __m128 k = _mm_cvtepi32_ps(quadrant);
+
+    __m128 r = _mm_sub_ps(angle, _mm_mul_ps(k, _mm_set1_ps(HalfPi1)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(HalfPi2)));
+    r = _mm_sub_ps(r, _mm_mul_ps(k, _mm_set1_ps(HalfPi3)));
+    __m128 z = _mm_mul_ps(r, r);
+
+    __m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Sin3), z), _mm_set1_ps(Sin2));
+    s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(Sin1));
+    s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), r), r);
+
+    __m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(Cos3), z), _mm_set1_ps(Cos2));
+    c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(Cos1));
+    c = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(c, z), z), _mm_mul_ps(_mm_set1_ps(0.5f), z));
+    c = _mm_add_ps(c, _mm_set1_ps(1.0f));
+
+    __m128i one = _mm_set1_epi32(1);
+    __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+    __m128 sinValue = _mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s));
+    __m128 cosValue = _mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c));
+
+    __m128i two = _mm_set1_epi32(2);
+    __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, two), 30));
+    __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30));
+    outSin = _mm_xor_ps(sinValue, sinSign);
+    outCos = _mm_xor_ps(cosValue, cosSign);
+}
+
+void QuadTransform::ComputeSSE2(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 s, c;
+        SinCosSSE2(_mm_loadu_ps(input.rotation + i), s, c);
+
+        __m128 sizeX = _mm_loadu_ps(input.sizeX + i);
+        __m128 sizeY = _mm_loadu_ps(input.sizeY + i);
+        __m128 ax = _mm_mul_ps(_mm_xor_ps(_mm_loadu_ps(input.pivotX + i), _mm_set1_ps(-0.0f)), sizeX);
+        __m128 ay = _mm_mul_ps(_mm_xor_ps(_mm_loadu_ps(input.pivotY + i), _mm_set1_ps(-0.0f)), sizeY);
+        __m128 bx = _mm_add_ps(sizeX, ax);
+        __m128 by = _mm_add_ps(sizeY, ay);
+        __m128 px = _mm_sub_ps(_mm_loadu_ps(input.positionX + i), ax);
+        __m128 py = _mm_sub_ps(_mm_loadu_ps(input.positionY + i), ay);
+
+        __m128 axc = _mm_add_ps(px, _mm_mul_ps(ax, c)), bxc = _mm_add_ps(px, _mm_mul_ps(bx, c));
+        __m128 axs = _mm_add_ps(py, _mm_mul_ps(ax, s)), bxs = _mm_add_ps(py, _mm_mul_ps(bx, s));
+        __m128 ays = _mm_mul_ps(ay, s), bys = _mm_mul_ps(by, s);
+        __m128 ayc = _mm_mul_ps(ay, c), byc = _mm_mul_ps(by, c);
+
+        __m128 x0 = _mm_sub_ps(axc, ays), y0 = _mm_add_ps(axs, ayc);
+        __m128 x1 = _mm_sub_ps(bxc, ays), y1 = _mm_add_ps(bxs, ayc);
+        __m128 x2 = _mm_sub_ps(bxc, bys), y2 = _mm_add_ps(bxs, byc);
+        __m128 x3 = _mm_sub_ps(axc, bys), y3 = _mm_add_ps(axs, byc);
+
+        // Transponer a 8 floats por quad
+        __m128 lo0 = _mm_unpacklo_ps(x0, y0), hi0 = _mm_unpackhi_ps(x0, y0);
+        __m128 lo1 = _mm_unpacklo_ps(x1, y1), hi1 = _mm_unpackhi_ps(x1, y1);
+        __m128 lo2 = _mm_unpacklo_ps(x2, y2), hi2 = _mm_unpackhi_ps(x2, y2);
+        __m128 lo3 = _mm_unpacklo_ps(x3, y3), hi3 = _mm_unpackhi_ps(x3, y3);
+
+        float* out = outCorners + static_cast<size_t>(i) * 8;
+        _mm_storeu_ps(out + 0,  _mm_movelh_ps(lo0, lo1));
+        _mm_storeu_ps(out + 4,  _mm_movelh_ps(lo2, lo3));
+        _mm_storeu_ps(out + 8,  _mm_movehl_ps(lo1, lo0));
+        _mm_storeu_ps(out + 12, _mm_movehl_ps(lo3, lo2));
+        _mm_storeu_ps(out + 16, _mm_movelh_ps(hi0, hi1));
+        _mm_storeu_ps(out + 20, _mm_movelh_ps(hi2, hi3));
+        _mm_storeu_ps(out + 24, _mm_movehl_ps(hi1, hi0));
+        _mm_storeu_ps(out + 28, _mm_movehl_ps(hi3, hi2));
+    }
+
+    for (; i < count; i++)
+        TransformQuad(input, i, outCorners + static_cast<size_t>(i) * 8);
+}
+
+DESTINY_TARGET_AVX2
+static inline void SinCosAVX2(__m256 angle, __m256& outSin, __m256& outCos) {
+    __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(angle, _mm256_set1_ps(TwoOverPi)));
+    __m256 k = _mm256_cvtepi32_ps(quadrant);
+
+    __m256 r = _mm256_sub_ps(angle, _mm256_mul_ps(k, _mm256_set1_ps(HalfPi1)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(HalfPi2)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(k, _mm256_set1_ps(HalfPi3)));
+    __m256 z = _mm256_mul_ps(r, r);
+
+    __m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Sin3), z), _mm256_set1_ps(Sin2));
+    s = _mm256_add_ps(_mm256_mul_ps(s, z), _mm256_set1_ps(Sin1));
+    s = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(s, z), r), r);
+
+    __m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(Cos3), z), _mm256_set1_ps(Cos2));
+    c = _mm256_add_ps(_mm256_mul_ps(c, z), _mm256_set1_ps(Cos1));
+    c = _mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(c, z), z), _mm256_mul_ps(_mm256_set1_ps(0.5f), z));
+    c = _mm256_add_ps(c, _mm256_set1_ps(1.0f));
+
+    __m256i one = _mm256_set1_epi32(1);
+    __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, one), one));
+    __m256 sinValue = _mm256_blendv_ps(s, c, swap);
+    __m256 cosValue = _mm256_blendv_ps(c, s, swap);
+
+    __m256i two = _mm256_set1_epi32(2);
+    __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, two), 30));
+    __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, one), two), 30));
+    outSin = _mm256_xor_ps(sinValue, sinSign);
+    outCos = _mm256_xor_ps(cosValue, cosSign);
+}
+
+DESTINY_TARGET_AVX2
+void QuadTransform::ComputeAVX2(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 s, c;
+        SinCosAVX2(_mm256_loadu_ps(input.rotation + i), s, c);
+
+        __m256 sizeX = _mm256_loadu_ps(input.sizeX + i);
+        __m256 sizeY = _mm256_loadu_ps(input.sizeY + i);
+        __m256 ax = _mm256_mul_ps(_mm256_xor_ps(_mm256_loadu_ps(input.pivotX + i), _mm256_set1_ps(-0.0f)), sizeX);
+        __m256 ay = _mm256_mul_ps(_mm256_xor_ps(_mm256_loadu_ps(input.pivotY + i), _mm256_set1_ps(-0.0f)), sizeY);
+        __m256 bx = _mm256_add_ps(sizeX, ax);
+        __m256 by = _mm256_add_ps(sizeY, ay);
+        __m256 px = _mm256_sub_ps(_mm256_loadu_ps(input.positionX + i), ax);
+        __m256 py = _mm256_sub_ps(_mm256_loadu_ps(input.positionY + i), ay);
+
+        __m256 axc = _mm256_add_ps(px, _mm256_mul_ps(ax, c)), bxc = _mm256_add_ps(px, _mm256_mul_ps(bx, c));
+        __m256 axs = _mm256_add_ps(py, _mm256_mul_ps(ax, s)), bxs = _mm256_add_ps(py, _mm256_mul_ps(bx, s));
+        __m256 ays = _mm256_mul_ps(ay, s), bys = _mm256_mul_ps(by, s);
+        __m256 ayc = _mm256_mul_ps(ay, c), byc = _mm256_mul_ps(by, c);
+
+        __m256 x0 = _mm256_sub_ps(axc, ays), y0 = _mm256_add_ps(axs, ayc);
+        __m256 x1 = _mm256_sub_ps(bxc, ays), y1 = _mm256_add_ps(bxs, ayc);
+        __m256 x2 = _mm256_sub_ps(bxc, bys), y2 = _mm256_add_ps(bxs, byc);
+        __m256 x3 = _mm256_sub_ps(axc, bys), y3 = _mm256_add_ps(axs, byc);
+
+        // Mismo transpuesto que SSE2, por carril de 128 bits (quads 0-3 y 4-7)
+        __m256 lo0 = _mm256_unpacklo_ps(x0, y0), hi0 = _mm256_unpackhi_ps(x0, y0);
+        __m256 lo1 = _mm256_unpacklo_ps(x1, y1), hi1 = _mm256_unpackhi_ps(x1, y1);
+        __m256 lo2 = _mm256_unpacklo_ps(x2, y2), hi2 = _mm256_unpackhi_ps(x2, y2);
+        __m256 lo3 = _mm256_unpacklo_ps(x3, y3), hi3 = _mm256_unpackhi_ps(x3, y3);
+
+        __m256 q0a = _mm256_shuffle_ps(lo0, lo1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 q0b = _mm256_shuffle_ps(lo2, lo3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 q1a = _mm256_shuffle_ps(lo0, lo1, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 q1b = _mm256_shuffle_ps(lo2, lo3, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 q2a = _mm256_shuffle_ps(hi0, hi1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 q2b = _mm256_shuffle_ps(hi2, hi3, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 q3a = _mm256_shuffle_ps(hi0, hi1, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 q3b = _mm256_shuffle_ps(hi2, hi3, _MM_SHUFFLE(3, 2, 3, 2));
+
+        float* out = outCorners + static_cast<size_t>(i) * 8;
+        _mm256_storeu_ps(out + 0,  _mm256_permute2f128_ps(q0a, q0b, 0x20));
+        _mm256_storeu_ps(out + 8,  _mm256_permute2f128_ps(q1a, q1b, 0x20));
+        _mm256_storeu_ps(out + 16, _mm256_permute2f128_ps(q2a, q2b, 0x20));
+        _mm256_storeu_ps(out + 24, _mm256_permute2f128_ps(q3a, q3b, 0x20));
+        _mm256_storeu_ps(out + 32, _mm256_permute2f128_ps(q0a, q0b, 0x31));
+        _mm256_storeu_ps(out + 40, _mm256_permute2f128_ps(q1a, q1b, 0x31));
+        _mm256_storeu_ps(out + 48, _mm256_permute2f128_ps(q2a, q2b, 0x31));
+        _mm256_storeu_ps(out + 56, _mm256_permute2f128_ps(q3a, q3b, 0x31));
+    }
+
+    for (; i < count; i++)
+        TransformQuad(input, i, outCorners + static_cast<size_t>(i) * 8);
+}
+
+static SimdLevel DetectSimdLevel() {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avxState = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+        __cpuidex(info, 7, 0);
+        if (avxState && (info[1] & (1 << 5)))
+            return SimdLevel::AVX2;
+    }
+    return SimdLevel::SSE2;
+#else
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return SimdLevel::AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return SimdLevel::SSE2;
+    return SimdLevel::Scalar;
+#endif
+}
+
+#else
+
+void QuadTransform::ComputeSSE2(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    ComputeScalar(input, count, outCorners);
+}
+
+void QuadTransform::ComputeAVX2(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    ComputeScalar(input, count, outCorners);
+}
+
+static SimdLevel DetectSimdLevel() {
+    return SimdLevel::Scalar;
+}
+
+#endif
+
+SimdLevel QuadTransform::GetSimdLevel() {
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+const char* QuadTransform::GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2: return "AVX2";
+        case SimdLevel::SSE2: return "SSE2";
+        default:              return "Scalar";
+    }
+}
+
+void QuadTransform::Compute(const QuadTransformInput& input, uint32_t count, float* outCorners) {
+    switch (GetSimdLevel()) {
+        case SimdLevel::AVX2: ComputeAVX2(input, count, outCorners); break;
+        case SimdLevel::SSE2: ComputeSSE2(input, count, outCorners); break;
+        default:              ComputeScalar(input, count, outCorners); break;
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
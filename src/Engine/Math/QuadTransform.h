@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Destiny {
+
+// Columnas SoA de entrada: un elemento por quad.
+// position es la esquina inferior izquierda del quad sin rotar, rotation va en radianes
+// y pivot es el punto de giro normalizado dentro del quad (0.5, 0.5 = centro).
+struct QuadTransformInput {
+    const float* positionX;
+    const float* positionY;
+    const float* sizeX;
+    const float* sizeY;
+    const float* rotation;
+    const float* pivotX;
+    const float* pivotY;
+};
+
+// Nivel de instrucciones SIMD usado por el kernel
+enum class SimdLevel {
+    Scalar = 0,
+    SSE2,
+    AVX2
+};
+
+// Kernel por lotes que coloca las 4 esquinas de cada quad sin construir matrices.
+// Salida: 8 floats por quad (x0 y0 x1 y1 x2 y2 x3 y3) con esquinas en orden
+// (0,0) (1,0) (1,1) (0,1) del quad local. Las tres implementaciones ejecutan las
+// mismas operaciones en el mismo orden y producen resultados idénticos bit a bit.
+class QuadTransform {
+public:
+    // Error absoluto máximo de FastSinCos para |ángulo| <= 8192 rad
+    static constexpr float SinCosMaxError = 1.0e-7f;
+
+    // Usa la mejor implementación disponible en la CPU (elegida una vez)
+    static void Compute(const QuadTransformInput& input, uint32_t count, float* outCorners);
+
+    // Implementaciones concretas (para verificación y mediciones)
+    static void ComputeScalar(const QuadTransformInput& input, uint32_t count, float* outCorners);
+    static void ComputeSSE2(const QuadTransformInput& input, uint32_t count, float* outCorners);
+    static void ComputeAVX2(const QuadTransformInput& input, uint32_t count, float* outCorners);
+
+    static SimdLevel GetSimdLevel();
+    static const char* GetSimdLevelName(SimdLevel level);
+
+    // Seno y coseno por reducción a cuadrante y polinomios minimax de grado 7/6
+    static void FastSinCos(float angle, float& outSin, float& outCos);
+};
+
+} // namespace Destiny
\ No newline at end of file
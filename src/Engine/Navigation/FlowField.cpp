@@ -0,0 +1,668 @@
+#include "FlowField.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace Destiny {
+
+static constexpr uint32_t Infinity = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t NoNode = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t NoSector = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t PaddedSize = FlowFieldPathfinder::SectorSize + 2;
+static constexpr uint8_t NoSide = 0xff;
+
+// Coste de paso ortogonal y diagonal (x10 para trabajar con enteros)
+static constexpr uint32_t StraightStep = 10;
+static constexpr uint32_t DiagonalStep = 14;
+
+// Vecinos en el orden de los índices de dirección
+static const int NeighborX[8] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+static const int NeighborY[8] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+
+// Lado de portal (E, O, N, S) -> índice de dirección
+static const uint8_t SideDirection[4] = { 0, 4, 2, 6 };
+
+// ---------------------------------------------------------------------------
+// FlowField
+// ---------------------------------------------------------------------------
+
+FlowField::FlowField(const glm::ivec2& goal, uint32_t width, uint32_t height, uint32_t sectorsX, uint32_t sectorCount)
+    : m_Goal(goal), m_Width(width), m_Height(height), m_SectorsX(sectorsX),
+      m_SectorDirections(sectorCount), m_UsedSectors(sectorCount, 0) {
+}
+
+void FlowField::Reset() {
+    for (auto& directions : m_SectorDirections)
+        std::vector<uint8_t>().swap(directions);
+
+    std::fill(m_UsedSectors.begin(), m_UsedSectors.end(), 0);
+    m_GraphValid = false;
+}
+
+const glm::vec2& FlowField::GetDirectionVector(uint8_t index) {
+    static const float d = 0.70710678f;
+    static const glm::vec2 vectors[9] = {
+        { 1.0f, 0.0f }, { d, d }, { 0.0f, 1.0f }, { -d, d },
+        { -1.0f, 0.0f }, { -d, -d }, { 0.0f, -1.0f }, { d, -d },
+        { 0.0f, 0.0f }
+    };
+    return vectors[index < NoDirection ? index : NoDirection];
+}
+
+uint8_t FlowField::GetDirectionIndex(const glm::ivec2& cell) const {
+    if (cell.x < 0 || cell.y < 0 || cell.x >= static_cast<int>(m_Width) || cell.y >= static_cast<int>(m_Height))
+        return NoDirection;
+
+    uint32_t sectorX = cell.x / FlowFieldPathfinder::SectorSize;
+    uint32_t sectorY = cell.y / FlowFieldPathfinder::SectorSize;
+    const std::vector<uint8_t>& directions = m_SectorDirections[sectorY * m_SectorsX + sectorX];
+    if (directions.empty())
+        return NoDirection;
+
+    uint32_t localX = cell.x % FlowFieldPathfinder::SectorSize;
+    uint32_t localY = cell.y % FlowFieldPathfinder::SectorSize;
+    return directions[localY * FlowFieldPathfinder::SectorSize + localX];
+}
+
+glm::vec2 FlowField::GetDirection(const glm::ivec2& cell) const {
+    return GetDirectionVector(GetDirectionIndex(cell));
+}
+
+// ---------------------------------------------------------------------------
+// FlowFieldPathfinder
+// ---------------------------------------------------------------------------
+
+FlowFieldPathfinder::FlowFieldPathfinder(uint32_t width, uint32_t height, JobSystem* jobSystem)
+    : m_Width(width), m_Height(height),
+      m_SectorsX((width + SectorSize - 1) / SectorSize),
+      m_SectorsY((height + SectorSize - 1) / SectorSize),
+      m_JobSystem(jobSystem),
+      m_Costs(static_cast<size_t>(width) * height, 1) {
+    m_Graphs.resize(GetSectorCount());
+
+    // El grafo completo se construye en el primer uso
+    m_DirtySectors.assign(GetSectorCount(), 1);
+    m_HasDirtySectors = true;
+}
+
+uint32_t FlowFieldPathfinder::GetSectorIndex(const glm::ivec2& cell) const {
+    return (cell.y / SectorSize) * m_SectorsX + cell.x / SectorSize;
+}
+
+void FlowFieldPathfinder::SetCost(const glm::ivec2& cell, uint8_t cost) {
+    if (cell.x < 0 || cell.y < 0 || cell.x >= static_cast<int>(m_Width) || cell.y >= static_cast<int>(m_Height))
+        return;
+
+    // El coste 0 haría que los caminos largos salieran gratis
+    cost = cost == 0 ? 1 : cost;
+
+    uint8_t& current = m_Costs[static_cast<size_t>(cell.y) * m_Width + cell.x];
+    if (current == cost)
+        return;
+
+    current = cost;
+    m_DirtySectors[GetSectorIndex(cell)] = 1;
+    m_HasDirtySectors = true;
+}
+
+void FlowFieldPathfinder::SetCostRect(const glm::ivec2& min, const glm::ivec2& max, uint8_t cost) {
+    int x0 = std::max(min.x, 0), y0 = std::max(min.y, 0);
+    int x1 = std::min(max.x, static_cast<int>(m_Width) - 1), y1 = std::min(max.y, static_cast<int>(m_Height) - 1);
+
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++)
+            SetCost({ x, y }, cost);
+    }
+}
+
+uint8_t FlowFieldPathfinder::GetCost(const glm::ivec2& cell) const {
+    if (cell.x < 0 || cell.y < 0 || cell.x >= static_cast<int>(m_Width) || cell.y >= static_cast<int>(m_Height))
+        return Impassable;
+    return m_Costs[static_cast<size_t>(cell.y) * m_Width + cell.x];
+}
+
+std::shared_ptr<FlowField> FlowFieldPathfinder::RequestField(const glm::ivec2& goal) {
+    if (goal.x < 0 || goal.y < 0 || goal.x >= static_cast<int>(m_Width) || goal.y >= static_cast<int>(m_Height)) {
+        DESTINY_CORE_WARN("Destino fuera del mapa: ({0}, {1})", goal.x, goal.y);
+        return nullptr;
+    }
+
+    ApplyPendingChanges();
+
+    uint32_t key = static_cast<uint32_t>(goal.y) * m_Width + goal.x;
+    auto it = m_Fields.find(key);
+    if (it != m_Fields.end()) {
+        it->second->m_LastRequest = ++m_RequestCounter;
+        return it->second;
+    }
+
+    // Expulsar el campo pedido hace más tiempo
+    if (m_MaxCachedFields > 0 && m_Fields.size() >= m_MaxCachedFields) {
+        auto oldest = std::min_element(m_Fields.begin(), m_Fields.end(), [](const auto& a, const auto& b) {
+            return a.second->m_LastRequest < b.second->m_LastRequest;
+        });
+        m_Fields.erase(oldest);
+    }
+
+    std::shared_ptr<FlowField> field(new FlowField(goal, m_Width, m_Height, m_SectorsX, GetSectorCount()));
+    field->m_LastRequest = ++m_RequestCounter;
+    m_Fields[key] = field;
+
+    m_Stats.cachedFields = static_cast<uint32_t>(m_Fields.size());
+    return field;
+}
+
+void FlowFieldPathfinder::Prepare(FlowField& field, const glm::ivec2* cells, uint32_t count) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    ApplyPendingChanges();
+
+    if (!field.m_GraphValid)
+        ComputeGraphDistances(field);
+
+    // Sectores con unidades que aún no tienen campo
+    std::vector<uint32_t> missing;
+    std::vector<uint8_t> queued(GetSectorCount(), 0);
+    for (uint32_t i = 0; i < count; i++) {
+        const glm::ivec2& cell = cells[i];
+        if (cell.x < 0 || cell.y < 0 || cell.x >= static_cast<int>(m_Width) || cell.y >= static_cast<int>(m_Height))
+            continue;
+
+        uint32_t sector = GetSectorIndex(cell);
+        if (!queued[sector] && field.m_SectorDirections[sector].empty()) {
+            queued[sector] = 1;
+            missing.push_back(sector);
+        }
+    }
+
+    // Cada sector escribe sólo su propio vector de direcciones
+    auto build = [this, &field, &missing](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++)
+            BuildSectorField(field, missing[i], field.m_SectorDirections[missing[i]]);
+    };
+
+    if (m_JobSystem)
+        m_JobSystem->ParallelFor(static_cast<uint32_t>(missing.size()), 1, build);
+    else
+        build(0, static_cast<uint32_t>(missing.size()));
+
+    for (uint32_t sector : missing)
+        TraceCorridor(field, sector);
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.fieldBuildMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.sectorsBuilt += static_cast<uint32_t>(missing.size());
+}
+
+void FlowFieldPathfinder::ApplyPendingChanges() {
+    if (!m_HasDirtySectors)
+        return;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // Un cambio en un sector altera los portales de sus bordes, y por tanto
+    // también los nodos de los cuatro vecinos
+    std::vector<uint8_t> affected(GetSectorCount(), 0);
+    for (uint32_t sector = 0; sector < GetSectorCount(); sector++) {
+        if (!m_DirtySectors[sector])
+            continue;
+
+        affected[sector] = 1;
+        for (uint8_t side = 0; side < 4; side++) {
+            uint32_t neighbor = GetNeighborSector(sector, side);
+            if (neighbor != NoSector)
+                affected[neighbor] = 1;
+        }
+    }
+
+    std::vector<uint32_t> rebuild;
+    for (uint32_t sector = 0; sector < GetSectorCount(); sector++) {
+        if (affected[sector])
+            rebuild.push_back(sector);
+    }
+
+    auto build = [this, &rebuild](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++)
+            BuildSectorGraph(rebuild[i]);
+    };
+
+    if (m_JobSystem)
+        m_JobSystem->ParallelFor(static_cast<uint32_t>(rebuild.size()), 4, build);
+    else
+        build(0, static_cast<uint32_t>(rebuild.size()));
+
+    // Renumerar los nodos globales
+    m_NodeOffsets.resize(GetSectorCount() + 1);
+    m_NodeSectors.clear();
+    uint32_t offset = 0;
+    for (uint32_t sector = 0; sector < GetSectorCount(); sector++) {
+        m_NodeOffsets[sector] = offset;
+        offset += static_cast<uint32_t>(m_Graphs[sector].nodes.size());
+        m_NodeSectors.resize(offset, sector);
+    }
+    m_NodeOffsets[GetSectorCount()] = offset;
+    m_Stats.portalCount = offset;
+
+    // Los campos que pasaban por sectores afectados se descartan; el resto
+    // conserva sus sectores y sólo recalcula el grafo cuando lo necesite
+    for (auto& entry : m_Fields) {
+        FlowField& field = *entry.second;
+        bool routedThrough = false;
+        for (uint32_t sector : rebuild) {
+            if (field.m_UsedSectors[sector]) {
+                routedThrough = true;
+                break;
+            }
+        }
+
+        if (routedThrough) {
+            field.Reset();
+            m_Stats.fieldsInvalidated++;
+        }
+        else {
+            field.m_GraphValid = false;
+        }
+    }
+
+    std::fill(m_DirtySectors.begin(), m_DirtySectors.end(), 0);
+    m_HasDirtySectors = false;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.graphBuildMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void FlowFieldPathfinder::GetSectorBounds(uint32_t sector, uint32_t& originX, uint32_t& originY,
+                                          uint32_t& width, uint32_t& height) const {
+    originX = (sector % m_SectorsX) * SectorSize;
+    originY = (sector / m_SectorsX) * SectorSize;
+    width = std::min(SectorSize, m_Width - originX);
+    height = std::min(SectorSize, m_Height - originY);
+}
+
+uint32_t FlowFieldPathfinder::GetNeighborSector(uint32_t sector, uint8_t side) const {
+    uint32_t x = sector % m_SectorsX;
+    uint32_t y = sector / m_SectorsX;
+
+    switch (side) {
+        case 0: return x + 1 < m_SectorsX ? sector + 1 : NoSector;
+        case 1: return x > 0 ? sector - 1 : NoSector;
+        case 2: return y + 1 < m_SectorsY ? sector + m_SectorsX : NoSector;
+        case 3: return y > 0 ? sector - m_SectorsX : NoSector;
+        default: return NoSector;
+    }
+}
+
+uint32_t FlowFieldPathfinder::GetTwinNode(uint32_t sector, uint32_t local) const {
+    // Ambos sectores recorren el borde compartido en el mismo orden,
+    // así que el tramo i de un lado es el tramo i del lado opuesto
+    const SectorGraph& graph = m_Graphs[sector];
+    uint8_t side = graph.nodes[local].side;
+    uint32_t neighbor = GetNeighborSector(sector, side);
+    uint32_t twinLocal = m_Graphs[neighbor].sideStart[side ^ 1] + (local - graph.sideStart[side]);
+    return m_NodeOffsets[neighbor] + twinLocal;
+}
+
+void FlowFieldPathfinder::BuildSectorGraph(uint32_t sector) {
+    SectorGraph& graph = m_Graphs[sector];
+    graph.nodes.clear();
+
+    uint32_t originX, originY, width, height;
+    GetSectorBounds(sector, originX, originY, width, height);
+
+    for (uint8_t side = 0; side < 4; side++) {
+        graph.sideStart[side] = static_cast<uint32_t>(graph.nodes.size());
+        if (GetNeighborSector(sector, side) == NoSector)
+            continue;
+
+        // Celdas del borde propio y desplazamiento hasta la celda enfrentada
+        uint32_t first, step, count;
+        int64_t across;
+        switch (side) {
+            case 0:  first = originY * m_Width + originX + width - 1; step = m_Width; count = height; across = 1; break;
+            case 1:  first = originY * m_Width + originX; step = m_Width; count = height; across = -1; break;
+            case 2:  first = (originY + height - 1) * m_Width + originX; step = 1; count = width; across = m_Width; break;
+            default: first = originY * m_Width + originX; step = 1; count = width; across = -static_cast<int64_t>(m_Width); break;
+        }
+
+        uint32_t runStart = Infinity;
+        for (uint32_t i = 0; i <= count; i++) {
+            bool open = false;
+            if (i < count) {
+                uint32_t cell = first + i * step;
+                open = m_Costs[cell] != Impassable && m_Costs[static_cast<size_t>(cell + across)] != Impassable;
+            }
+
+            if (open && runStart == Infinity) {
+                runStart = i;
+            }
+            else if (!open && runStart != Infinity) {
+                uint32_t length = i - runStart;
+                graph.nodes.push_back({ first + runStart * step, step, length,
+                                        first + (runStart + length / 2) * step, side });
+                runStart = Infinity;
+            }
+        }
+    }
+    graph.sideStart[4] = static_cast<uint32_t>(graph.nodes.size());
+
+    // Distancias dentro del sector entre todos los pares de portales
+    uint32_t nodeCount = static_cast<uint32_t>(graph.nodes.size());
+    graph.distances.assign(static_cast<size_t>(nodeCount) * nodeCount, Infinity);
+
+    std::vector<uint32_t> integration;
+    std::vector<Seed> seeds(1);
+    for (uint32_t i = 0; i < nodeCount; i++) {
+        seeds[0] = { graph.nodes[i].center, 0 };
+        IntegrateSector(sector, seeds, integration);
+
+        for (uint32_t j = 0; j < nodeCount; j++) {
+            uint32_t cell = graph.nodes[j].center;
+            uint32_t local = (cell / m_Width - originY + 1) * PaddedSize + (cell % m_Width - originX + 1);
+            graph.distances[static_cast<size_t>(i) * nodeCount + j] = integration[local];
+        }
+    }
+}
+
+void FlowFieldPathfinder::IntegrateSector(uint32_t sector, const std::vector<Seed>& seeds,
+                                          std::vector<uint32_t>& integration) const {
+    uint32_t originX, originY, width, height;
+    GetSectorBounds(sector, originX, originY, width, height);
+
+    integration.assign(PaddedSize * PaddedSize, Infinity);
+
+    // Cola de prioridad (valor, índice con borde); una por hilo para no reservar cada vez
+    using Entry = std::pair<uint32_t, uint32_t>;
+    thread_local std::vector<Entry> heap;
+    heap.clear();
+
+    auto toLocal = [&](uint32_t cell) {
+        return (cell / m_Width - originY + 1) * PaddedSize + (cell % m_Width - originX + 1);
+    };
+    auto passable = [&](int x, int y) {
+        return x >= 0 && y >= 0 && x < static_cast<int>(width) && y < static_cast<int>(height) &&
+               m_Costs[static_cast<size_t>(originY + y) * m_Width + originX + x] != Impassable;
+    };
+
+    for (const Seed& seed : seeds) {
+        if (m_Costs[seed.first] == Impassable)
+            continue;
+
+        uint32_t local = toLocal(seed.first);
+        if (seed.second < integration[local]) {
+            integration[local] = seed.second;
+            heap.push_back({ seed.second, local });
+            std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        }
+    }
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        Entry current = heap.back();
+        heap.pop_back();
+
+        if (current.first > integration[current.second])
+            continue;
+
+        int x = static_cast<int>(current.second % PaddedSize) - 1;
+        int y = static_cast<int>(current.second / PaddedSize) - 1;
+
+        for (int d = 0; d < 8; d++) {
+            int nx = x + NeighborX[d];
+            int ny = y + NeighborY[d];
+            if (!passable(nx, ny))
+                continue;
+
+            // Sin cortar esquinas: las diagonales exigen las dos celdas ortogonales libres
+            bool diagonal = (d & 1) != 0;
+            if (diagonal && (!passable(nx, y) || !passable(x, ny)))
+                continue;
+
+            uint8_t cost = m_Costs[static_cast<size_t>(originY + ny) * m_Width + originX + nx];
+            uint32_t value = current.first + (diagonal ? DiagonalStep : StraightStep) * cost;
+            uint32_t local = (ny + 1) * PaddedSize + (nx + 1);
+
+            if (value < integration[local]) {
+                integration[local] = value;
+                heap.push_back({ value, local });
+                std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+            }
+        }
+    }
+}
+
+void FlowFieldPathfinder::ComputeGraphDistances(FlowField& field) {
+    uint32_t nodeCount = m_NodeOffsets.back();
+    field.m_NodeDistance.assign(nodeCount, Infinity);
+    field.m_NodeNext.assign(nodeCount, NoNode);
+    field.m_NodeTraced.assign(nodeCount, 0);
+    field.m_GraphValid = true;
+
+    uint32_t goalCell = static_cast<uint32_t>(field.m_Goal.y) * m_Width + field.m_Goal.x;
+    if (m_Costs[goalCell] == Impassable)
+        return;
+
+    using Entry = std::pair<uint32_t, uint32_t>;
+    std::vector<Entry> heap;
+    std::vector<uint32_t>& distance = field.m_NodeDistance;
+
+    // Portales del sector destino: distancia local hasta el destino
+    uint32_t goalSector = GetSectorIndex(field.m_Goal);
+    uint32_t originX, originY, width, height;
+    GetSectorBounds(goalSector, originX, originY, width, height);
+
+    std::vector<uint32_t> integration;
+    IntegrateSector(goalSector, { { goalCell, 0 } }, integration);
+
+    const SectorGraph& goalGraph = m_Graphs[goalSector];
+    for (uint32_t j = 0; j < goalGraph.nodes.size(); j++) {
+        uint32_t cell = goalGraph.nodes[j].center;
+        uint32_t value = integration[(cell / m_Width - originY + 1) * PaddedSize + (cell % m_Width - originX + 1)];
+        if (value == Infinity)
+            continue;
+
+        uint32_t node = m_NodeOffsets[goalSector] + j;
+        distance[node] = value;
+        heap.push_back({ value, node });
+    }
+    std::make_heap(heap.begin(), heap.end(), std::greater<Entry>());
+
+    // Dijkstra sobre el grafo de portales
+    auto relax = [&](uint32_t from, uint32_t to, uint32_t value) {
+        if (value < distance[to]) {
+            distance[to] = value;
+            field.m_NodeNext[to] = from;
+            heap.push_back({ value, to });
+            std::push_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        }
+    };
+
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<Entry>());
+        Entry current = heap.back();
+        heap.pop_back();
+
+        uint32_t node = current.second;
+        if (current.first > distance[node])
+            continue;
+
+        uint32_t sector = m_NodeSectors[node];
+        uint32_t local = node - m_NodeOffsets[sector];
+        const SectorGraph& graph = m_Graphs[sector];
+
+        // Cruzar al tramo enfrentado del sector vecino
+        uint32_t twin = GetTwinNode(sector, local);
+        uint32_t twinSector = m_NodeSectors[twin];
+        uint32_t twinCell = m_Graphs[twinSector].nodes[twin - m_NodeOffsets[twinSector]].center;
+        relax(node, twin, current.first + StraightStep * m_Costs[twinCell]);
+
+        // Otros portales del mismo sector
+        uint32_t nodeCount = static_cast<uint32_t>(graph.nodes.size());
+        for (uint32_t j = 0; j < nodeCount; j++) {
+            uint32_t cost = graph.distances[static_cast<size_t>(local) * nodeCount + j];
+            if (j != local && cost != Infinity)
+                relax(node, m_NodeOffsets[sector] + j, current.first + cost);
+        }
+    }
+}
+
+void FlowFieldPathfinder::BuildSectorField(FlowField& field, uint32_t sector, std::vector<uint8_t>& directions) const {
+    uint32_t originX, originY, width, height;
+    GetSectorBounds(sector, originX, originY, width, height);
+
+    auto toLocal = [&](uint32_t cell) {
+        return (cell / m_Width - originY + 1) * PaddedSize + (cell % m_Width - originX + 1);
+    };
+
+    std::vector<Seed> seeds;
+    std::vector<uint32_t> integration;
+    std::vector<uint8_t> exitSide(PaddedSize * PaddedSize, NoSide);
+
+    if (GetSectorIndex(field.m_Goal) == sector)
+        seeds.push_back({ static_cast<uint32_t>(field.m_Goal.y) * m_Width + field.m_Goal.x, 0 });
+
+    // Sólo los tramos por los que el camino sale del sector (su siguiente nodo es
+    // el gemelo) son semillas, con la distancia del grafo. Los demás son entradas
+    // y los resuelve la integración desde las salidas.
+    const SectorGraph& graph = m_Graphs[sector];
+    for (uint32_t j = 0; j < graph.nodes.size(); j++) {
+        const PortalNode& node = graph.nodes[j];
+        uint32_t global = m_NodeOffsets[sector] + j;
+        uint32_t distance = field.m_NodeDistance[global];
+        uint32_t next = field.m_NodeNext[global];
+        if (distance == Infinity || next == NoNode || m_NodeSectors[next] == sector)
+            continue;
+
+        for (uint32_t k = 0; k < node.length; k++) {
+            uint32_t cell = node.firstCell + k * node.step;
+            seeds.push_back({ cell, distance });
+            exitSide[toLocal(cell)] = node.side;
+        }
+    }
+
+    IntegrateSector(sector, seeds, integration);
+
+    // Dirección hacia el vecino de menor integración; en empate gana el primero
+    // en el orden de los índices. Las diagonales sólo cuentan si no cortan una
+    // esquina bloqueada.
+    directions.assign(SectorSize * SectorSize, FlowField::NoDirection);
+
+    const int32_t offsets[8] = {
+        1, static_cast<int32_t>(PaddedSize) + 1, static_cast<int32_t>(PaddedSize), static_cast<int32_t>(PaddedSize) - 1,
+        -1, -static_cast<int32_t>(PaddedSize) - 1, -static_cast<int32_t>(PaddedSize), -static_cast<int32_t>(PaddedSize) + 1
+    };
+
+    for (uint32_t y = 0; y < height; y++) {
+        const uint32_t* row = &integration[(y + 1) * PaddedSize + 1];
+        const uint8_t* exits = &exitSide[(y + 1) * PaddedSize + 1];
+        uint8_t* out = &directions[y * SectorSize];
+
+        // Celda de portal sin vecino mejor: cruzar al sector contiguo
+        auto resolve = [&](uint32_t x, uint8_t bestDirection) {
+            bool exit = bestDirection == FlowField::NoDirection && exits[x] != NoSide && row[x] != Infinity;
+            out[x] = exit ? SideDirection[exits[x]] : bestDirection;
+        };
+
+        uint32_t x = 0;
+
+#ifdef DESTINY_SIMD_X86
+        // Cuatro celdas por iteración con SSE2. No hay comparación sin signo de
+        // 32 bits: se desplazan los valores con el bit de signo y se compara con signo
+        const __m128i bias = _mm_set1_epi32(static_cast<int32_t>(0x80000000u));
+        const __m128i infinity = _mm_set1_epi32(-1);
+
+        for (; x + 4 <= width; x += 4) {
+            const uint32_t* cell = row + x;
+            auto load = [cell](int32_t offset) {
+                return _mm_loadu_si128(reinterpret_cast<const __m128i*>(cell + offset));
+            };
+
+            __m128i east = load(offsets[0]), north = load(offsets[2]);
+            __m128i west = load(offsets[4]), south = load(offsets[6]);
+            __m128i eastBlocked = _mm_cmpeq_epi32(east, infinity), northBlocked = _mm_cmpeq_epi32(north, infinity);
+            __m128i westBlocked = _mm_cmpeq_epi32(west, infinity), southBlocked = _mm_cmpeq_epi32(south, infinity);
+
+            // Infinity tiene todos los bits a 1: OR con la máscara descarta la diagonal
+            const __m128i candidates[8] = {
+                east,
+                _mm_or_si128(load(offsets[1]), _mm_or_si128(eastBlocked, northBlocked)),
+                north,
+                _mm_or_si128(load(offsets[3]), _mm_or_si128(westBlocked, northBlocked)),
+                west,
+                _mm_or_si128(load(offsets[5]), _mm_or_si128(westBlocked, southBlocked)),
+                south,
+                _mm_or_si128(load(offsets[7]), _mm_or_si128(eastBlocked, southBlocked))
+            };
+
+            __m128i best = _mm_xor_si128(load(0), bias);
+            __m128i bestDirection = _mm_set1_epi32(FlowField::NoDirection);
+            for (int d = 0; d < 8; d++) {
+                __m128i candidate = _mm_xor_si128(candidates[d], bias);
+                __m128i better = _mm_cmplt_epi32(candidate, best);
+                best = _mm_or_si128(_mm_and_si128(better, candidate), _mm_andnot_si128(better, best));
+                bestDirection = _mm_or_si128(_mm_and_si128(better, _mm_set1_epi32(d)), _mm_andnot_si128(better, bestDirection));
+            }
+
+            alignas(16) uint32_t lanes[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes), bestDirection);
+            for (uint32_t lane = 0; lane < 4; lane++)
+                resolve(x + lane, static_cast<uint8_t>(lanes[lane]));
+        }
+#endif
+
+        for (; x < width; x++) {
+            const uint32_t* cell = row + x;
+            uint32_t east = cell[offsets[0]], north = cell[offsets[2]];
+            uint32_t west = cell[offsets[4]], south = cell[offsets[6]];
+
+            uint32_t candidates[8] = {
+                east,
+                (east != Infinity && north != Infinity) ? cell[offsets[1]] : Infinity,
+                north,
+                (west != Infinity && north != Infinity) ? cell[offsets[3]] : Infinity,
+                west,
+                (west != Infinity && south != Infinity) ? cell[offsets[5]] : Infinity,
+                south,
+                (east != Infinity && south != Infinity) ? cell[offsets[7]] : Infinity
+            };
+
+            uint32_t best = cell[0];
+            uint8_t bestDirection = FlowField::NoDirection;
+            for (uint8_t d = 0; d < 8; d++) {
+                if (candidates[d] < best) {
+                    best = candidates[d];
+                    bestDirection = d;
+                }
+            }
+
+            resolve(x, bestDirection);
+        }
+    }
+}
+
+void FlowFieldPathfinder::TraceCorridor(FlowField& field, uint32_t sector) {
+    field.m_UsedSectors[sector] = 1;
+    field.m_UsedSectors[GetSectorIndex(field.m_Goal)] = 1;
+
+    // Seguir los portales de este sector hasta el destino marcando los sectores recorridos
+    uint32_t first = m_NodeOffsets[sector];
+    uint32_t last = m_NodeOffsets[sector + 1];
+    for (uint32_t start = first; start < last; start++) {
+        uint32_t node = start;
+        while (node != NoNode && field.m_NodeDistance[node] != Infinity && !field.m_NodeTraced[node]) {
+            field.m_NodeTraced[node] = 1;
+            field.m_UsedSectors[m_NodeSectors[node]] = 1;
+            node = field.m_NodeNext[node];
+        }
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
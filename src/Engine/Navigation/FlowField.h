@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class JobSystem;
+
+// Campo de flujo hacia un destino. Se calcula por sectores bajo demanda
+// (FlowFieldPathfinder::Prepare) y cada celda guarda la dirección a seguir.
+class FlowField {
+public:
+    // Índices de dirección: E, NE, N, NO, O, SO, S, SE; NoDirection en el destino o sin camino
+    static constexpr uint8_t NoDirection = 8;
+
+    const glm::ivec2& GetGoal() const { return m_Goal; }
+
+    // Dirección unitaria para una celda; (0, 0) si su sector no está preparado
+    glm::vec2 GetDirection(const glm::ivec2& cell) const;
+    uint8_t GetDirectionIndex(const glm::ivec2& cell) const;
+
+    bool IsSectorReady(uint32_t sector) const { return !m_SectorDirections[sector].empty(); }
+
+    static const glm::vec2& GetDirectionVector(uint8_t index);
+
+private:
+    friend class FlowFieldPathfinder;
+
+    FlowField(const glm::ivec2& goal, uint32_t width, uint32_t height, uint32_t sectorsX, uint32_t sectorCount);
+
+    // Descartar todo lo calculado (el destino se mantiene)
+    void Reset();
+
+    glm::ivec2 m_Goal;
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_SectorsX;
+
+    // Direcciones por sector (SectorSize x SectorSize); vacío = sin calcular
+    std::vector<std::vector<uint8_t>> m_SectorDirections;
+
+    // Distancias al destino en el grafo de portales
+    std::vector<uint32_t> m_NodeDistance;
+    std::vector<uint32_t> m_NodeNext;
+    std::vector<uint8_t> m_NodeTraced;
+    bool m_GraphValid = false;
+
+    // Sectores por los que pasan los caminos ya calculados (para invalidar)
+    std::vector<uint8_t> m_UsedSectors;
+
+    uint64_t m_LastRequest = 0;
+};
+
+// Pathfinding por campos de flujo sobre una rejilla de costes.
+// El mapa se divide en sectores unidos por portales (tramos transitables del
+// borde compartido). Un campo resuelve primero el grafo de portales y después
+// sólo integra los sectores donde hay unidades, en paralelo. Los cambios de
+// coste reconstruyen los portales de los sectores afectados e invalidan sólo
+// los campos cuyos caminos pasaban por ellos.
+// Mediciones en mapas de 512x512 y 1024x1024: tools/FlowFieldBench.
+class FlowFieldPathfinder {
+public:
+    static constexpr uint32_t SectorSize = 32;
+    static constexpr uint8_t Impassable = 255;
+
+    FlowFieldPathfinder(uint32_t width, uint32_t height, JobSystem* jobSystem = nullptr);
+    ~FlowFieldPathfinder() = default;
+
+    // No permitir copia
+    FlowFieldPathfinder(const FlowFieldPathfinder&) = delete;
+    FlowFieldPathfinder& operator=(const FlowFieldPathfinder&) = delete;
+
+    // Costes por celda: 1 (terreno libre) .. 254; Impassable bloquea la celda
+    void SetCost(const glm::ivec2& cell, uint8_t cost);
+    void SetCostRect(const glm::ivec2& min, const glm::ivec2& max, uint8_t cost);
+    uint8_t GetCost(const glm::ivec2& cell) const;
+
+    // Campo cacheado por destino
+    std::shared_ptr<FlowField> RequestField(const glm::ivec2& goal);
+
+    // Calcular los sectores que contienen las celdas dadas (posiciones de unidades)
+    void Prepare(FlowField& field, const glm::ivec2* cells, uint32_t count);
+
+    void SetMaxCachedFields(uint32_t count) { m_MaxCachedFields = count; }
+
+    // Información
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+    uint32_t GetSectorCount() const { return m_SectorsX * m_SectorsY; }
+    uint32_t GetSectorIndex(const glm::ivec2& cell) const;
+
+    // Estadísticas
+    struct Stats {
+        float graphBuildMs = 0.0f;      // Última reconstrucción de portales
+        float fieldBuildMs = 0.0f;      // Último Prepare (grafo + sectores)
+        uint32_t portalCount = 0;
+        uint32_t cachedFields = 0;
+        uint32_t sectorsBuilt = 0;      // Total acumulado
+        uint32_t fieldsInvalidated = 0; // Total acumulado
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    // Tramo transitable de un borde de sector; su gemelo es el tramo enfrentado
+    struct PortalNode {
+        uint32_t firstCell;
+        uint32_t step;       // 1 en bordes horizontales, ancho del mapa en verticales
+        uint32_t length;
+        uint32_t center;
+        uint8_t side;        // 0 E, 1 O, 2 N, 3 S
+    };
+
+    struct SectorGraph {
+        std::vector<PortalNode> nodes;
+        uint32_t sideStart[5] = {};      // Nodos de cada lado: [sideStart[s], sideStart[s + 1])
+        std::vector<uint32_t> distances; // distances[i * n + j]: coste de ir de j a i
+    };
+
+    // Semilla para la integración: celda global y valor inicial
+    using Seed = std::pair<uint32_t, uint32_t>;
+
+    void ApplyPendingChanges();
+    void BuildSectorGraph(uint32_t sector);
+    void ComputeGraphDistances(FlowField& field);
+    void BuildSectorField(FlowField& field, uint32_t sector, std::vector<uint8_t>& directions) const;
+    void TraceCorridor(FlowField& field, uint32_t sector);
+
+    // Dijkstra dentro de un sector sobre un buffer con borde de una celda
+    void IntegrateSector(uint32_t sector, const std::vector<Seed>& seeds, std::vector<uint32_t>& integration) const;
+
+    void GetSectorBounds(uint32_t sector, uint32_t& originX, uint32_t& originY, uint32_t& width, uint32_t& height) const;
+    uint32_t GetNeighborSector(uint32_t sector, uint8_t side) const;
+    uint32_t GetTwinNode(uint32_t sector, uint32_t local) const;
+
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_SectorsX;
+    uint32_t m_SectorsY;
+    JobSystem* m_JobSystem;
+
+    std::vector<uint8_t> m_Costs;
+
+    // Grafo de portales; los índices globales de nodo son m_NodeOffsets[sector] + local
+    std::vector<SectorGraph> m_Graphs;
+    std::vector<uint32_t> m_NodeOffsets;
+    std::vector<uint32_t> m_NodeSectors;
+
+    std::vector<uint8_t> m_DirtySectors;
+    bool m_HasDirtySectors = false;
+
+    std::unordered_map<uint32_t, std::shared_ptr<FlowField>> m_Fields;
+    uint32_t m_MaxCachedFields = 64;
+    uint64_t m_RequestCounter = 0;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
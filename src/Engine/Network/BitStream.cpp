@@ -0,0 +1,95 @@
+#include "BitStream.h"
+
+#include <algorithm>
+
+namespace Destiny {
+
+void BitWriter::WriteBits(uint32_t value, uint32_t bitCount) {
+    for (uint32_t written = 0; written < bitCount;) {
+        size_t byteIndex = m_BitCount >> 3;
+        uint32_t bitOffset = static_cast<uint32_t>(m_BitCount & 7);
+        if (byteIndex == m_Buffer.size())
+            m_Buffer.push_back(0);
+
+        // Tantos bits como quepan en el byte actual
+        uint32_t chunk = std::min(8 - bitOffset, bitCount - written);
+        uint32_t bits = (value >> written) & ((1u << chunk) - 1);
+        m_Buffer[byteIndex] |= static_cast<uint8_t>(bits << bitOffset);
+
+        written += chunk;
+        m_BitCount += chunk;
+    }
+}
+
+void BitWriter::WriteVarUInt(uint32_t value, uint32_t groupBits) {
+    uint32_t mask = (1u << groupBits) - 1;
+    do {
+        uint32_t group = value & mask;
+        value >>= groupBits;
+        WriteBits(group, groupBits);
+        WriteBool(value != 0);
+    } while (value != 0);
+}
+
+void BitWriter::WriteVarInt(int32_t value, uint32_t groupBits) {
+    uint32_t zigzag = (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+    WriteVarUInt(zigzag, groupBits);
+}
+
+void BitWriter::Append(const BitWriter& other) {
+    size_t fullBytes = other.m_BitCount >> 3;
+    for (size_t i = 0; i < fullBytes; i++)
+        WriteBits(other.m_Buffer[i], 8);
+
+    uint32_t remaining = static_cast<uint32_t>(other.m_BitCount & 7);
+    if (remaining > 0)
+        WriteBits(other.m_Buffer[fullBytes], remaining);
+}
+
+void BitWriter::Clear() {
+    m_Buffer.clear();
+    m_BitCount = 0;
+}
+
+uint32_t BitReader::ReadBits(uint32_t bitCount) {
+    if (m_BitPosition + bitCount > m_BitSize) {
+        m_Valid = false;
+        m_BitPosition = m_BitSize;
+        return 0;
+    }
+
+    uint32_t value = 0;
+    for (uint32_t read = 0; read < bitCount;) {
+        size_t byteIndex = m_BitPosition >> 3;
+        uint32_t bitOffset = static_cast<uint32_t>(m_BitPosition & 7);
+
+        uint32_t chunk = std::min(8 - bitOffset, bitCount - read);
+        uint32_t bits = (m_Data[byteIndex] >> bitOffset) & ((1u << chunk) - 1);
+        value |= bits << read;
+
+        read += chunk;
+        m_BitPosition += chunk;
+    }
+
+    return value;
+}
+
+uint32_t BitReader::ReadVarUInt(uint32_t groupBits) {
+    uint32_t value = 0;
+    for (uint32_t shift = 0; shift < 32; shift += groupBits) {
+        value |= ReadBits(groupBits) << shift;
+        if (!ReadBool())
+            return value;
+    }
+
+    // Más grupos de los que caben en 32 bits: datos corruptos
+    m_Valid = false;
+    return value;
+}
+
+int32_t BitReader::ReadVarInt(uint32_t groupBits) {
+    uint32_t zigzag = ReadVarUInt(groupBits);
+    return static_cast<int32_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Destiny {
+
+// Escritura de campos de bits arbitrarios (LSB primero) sobre un buffer de bytes
+class BitWriter {
+public:
+    void WriteBits(uint32_t value, uint32_t bitCount);
+    void WriteBool(bool value) { WriteBits(value ? 1 : 0, 1); }
+
+    // Entero sin signo de longitud variable: grupos de 'groupBits' con bit de continuación
+    void WriteVarUInt(uint32_t value, uint32_t groupBits = 7);
+
+    // Entero con signo en zigzag (valores pequeños en pocos bits)
+    void WriteVarInt(int32_t value, uint32_t groupBits = 7);
+
+    // Copiar los bits de otro writer a continuación
+    void Append(const BitWriter& other);
+
+    void Clear();
+
+    const uint8_t* GetData() const { return m_Buffer.data(); }
+    size_t GetSize() const { return m_Buffer.size(); }
+    size_t GetBitCount() const { return m_BitCount; }
+
+private:
+    std::vector<uint8_t> m_Buffer;
+    size_t m_BitCount = 0;
+};
+
+// Lectura de un buffer escrito con BitWriter. Leer más allá del final devuelve
+// ceros y marca el lector como inválido (paquetes truncados o corruptos).
+class BitReader {
+public:
+    BitReader(const uint8_t* data, size_t size)
+        : m_Data(data), m_BitSize(size * 8) {}
+
+    uint32_t ReadBits(uint32_t bitCount);
+    bool ReadBool() { return ReadBits(1) != 0; }
+    uint32_t ReadVarUInt(uint32_t groupBits = 7);
+    int32_t ReadVarInt(uint32_t groupBits = 7);
+
+    bool IsValid() const { return m_Valid; }
+    size_t GetRemainingBits() const { return m_BitSize - m_BitPosition; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_BitSize;
+    size_t m_BitPosition = 0;
+    bool m_Valid = true;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,477 @@
+#include "Lockstep.h"
+#include "BitStream.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Destiny {
+
+// Lotes y checksums que caben en un paquete
+static constexpr uint32_t MaxBatchesPerPacket = 32;
+static constexpr uint32_t MaxChecksumsPerPacket = 8;
+static constexpr uint32_t MaxCommandsPerBatch = 1024;
+
+// Bits del número de lotes del paquete (WriteVarUInt de un valor < 128)
+static constexpr size_t BatchCountBits = 8;
+static_assert(MaxBatchesPerPacket < 128, "El número de lotes debe caber en un grupo de WriteVarUInt");
+
+// Peor caso de WriteVarUInt para un valor de 32 bits
+static constexpr size_t VarUIntMaxBits(uint32_t groupBits) {
+    return (32 + groupBits - 1) / groupBits * (groupBits + 1);
+}
+
+// Lo que ocupa un paquete además de sus lotes, en el peor caso: cabecera
+// (protocolo, jugador, tiempo, eco, confirmación, primer tick, número de lotes)
+// y checksums
+static constexpr size_t PacketOverheadBits = 16 + 3 + 32 + 1 + 32 + 3 * VarUIntMaxBits(7) + BatchCountBits
+    + VarUIntMaxBits(3) + MaxChecksumsPerPacket * (VarUIntMaxBits(7) + 32);
+
+// Un lote tiene que caber solo en un paquete; los comandos que no caben esperan al siguiente
+static constexpr size_t MaxBatchBits = Transport::MaxDatagramSize * 8 - PacketOverheadBits;
+
+// Comando más largo posible (ver WriteCommand)
+static constexpr size_t MaxCommandBits = 1 + 8 + VarUIntMaxBits(6) + 1 + VarUIntMaxBits(7) + 1 + 2 * VarUIntMaxBits(8);
+static_assert(VarUIntMaxBits(3) + MaxCommandBits <= MaxBatchBits, "Un lote debe admitir al menos un comando");
+
+// Checksums sin pareja más antiguos que esto se descartan
+static constexpr uint32_t ChecksumHistory = 64;
+
+// Cada cuánto se puede cambiar el retardo de entrada (subir es más urgente que bajar)
+static constexpr double DelayIncreaseIntervalMs = 250.0;
+static constexpr double DelayDecreaseIntervalMs = 2000.0;
+
+LockstepSession::LockstepSession(Transport& transport, const LockstepConfig& config)
+    : m_Transport(transport), m_Config(config),
+      m_InputDelay(config.minInputDelay), m_TurnLengthMs(config.tickMs) {
+    if (m_Config.players.empty() || m_Config.players.size() > MaxPlayers || m_Config.localPlayer >= m_Config.players.size()) {
+        DESTINY_CORE_ERROR("Configuración de lockstep inválida: {0} jugadores, jugador local {1}",
+                           m_Config.players.size(), m_Config.localPlayer);
+        m_Config.players.resize(1);
+        m_Config.localPlayer = 0;
+    }
+
+    m_Players.resize(m_Config.players.size());
+    for (size_t i = 0; i < m_Players.size(); i++)
+        m_Players[i].address = m_Config.players[i];
+
+    SealLocalBatches();
+}
+
+uint32_t LockstepSession::HashState(const void* data, size_t size, uint32_t hash) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+void LockstepSession::QueueCommand(const LockstepCommand& command) {
+    m_PendingCommands.push_back(command);
+    m_PendingCommands.back().player = m_Config.localPlayer;
+}
+
+void LockstepSession::SealLocalBatches() {
+    // Cada tick necesita un lote (aunque esté vacío). Si el retardo ha bajado, el
+    // objetivo puede quedar por detrás de lo ya sellado y los comandos esperan.
+    PlayerState& local = m_Players[m_Config.localPlayer];
+    uint32_t target = m_CurrentTick + m_InputDelay;
+    if (local.nextTick > target)
+        return;
+
+    while (local.nextTick < target)
+        local.batches[local.nextTick++];
+
+    // Como mucho MaxCommandsPerBatch comandos y MaxBatchBits codificados; el resto
+    // pasa al lote siguiente en el mismo orden
+    uint32_t limit = static_cast<uint32_t>(std::min<size_t>(m_PendingCommands.size(), MaxCommandsPerBatch));
+    size_t bits = VarUIntMaxBits(3);
+    uint32_t count = 0;
+    BitWriter scratch;
+    LockstepCommand previous;
+    for (; count < limit; count++) {
+        scratch.Clear();
+        WriteCommand(scratch, m_PendingCommands[count], previous);
+        if (bits + scratch.GetBitCount() > MaxBatchBits)
+            break;
+
+        bits += scratch.GetBitCount();
+        previous = m_PendingCommands[count];
+    }
+
+    local.batches[target].assign(m_PendingCommands.begin(), m_PendingCommands.begin() + count);
+    local.nextTick = target + 1;
+    m_PendingCommands.erase(m_PendingCommands.begin(), m_PendingCommands.begin() + count);
+}
+
+bool LockstepSession::AdvanceTick(std::vector<LockstepCommand>& outCommands) {
+    outCommands.clear();
+
+    for (const PlayerState& player : m_Players) {
+        if (player.batches.find(m_CurrentTick) == player.batches.end()) {
+            m_Stats.stalledUpdates++;
+            return false;
+        }
+    }
+
+    for (const PlayerState& player : m_Players) {
+        const std::vector<LockstepCommand>& batch = player.batches.at(m_CurrentTick);
+        outCommands.insert(outCommands.end(), batch.begin(), batch.end());
+    }
+
+    m_CurrentTick++;
+    SealLocalBatches();
+    Prune();
+    return true;
+}
+
+void LockstepSession::SubmitChecksum(uint32_t tick, uint32_t checksum) {
+    m_Players[m_Config.localPlayer].checksums[tick] = checksum;
+    CompareChecksums();
+}
+
+void LockstepSession::Update(double nowMs) {
+    ReceivePackets(nowMs);
+    AdaptInputDelay(nowMs);
+    SealLocalBatches();
+    CompareChecksums();
+    SendPackets(nowMs);
+
+    m_Stats.inputDelay = m_InputDelay;
+}
+
+void LockstepSession::CompareChecksums() {
+    PlayerState& local = m_Players[m_Config.localPlayer];
+
+    for (auto it = local.checksums.begin(); it != local.checksums.end();) {
+        bool complete = true;
+        for (size_t i = 0; i < m_Players.size(); i++) {
+            if (i == m_Config.localPlayer)
+                continue;
+
+            auto remote = m_Players[i].checksums.find(it->first);
+            if (remote == m_Players[i].checksums.end()) {
+                complete = false;
+                continue;
+            }
+
+            if (remote->second != it->second && !m_DesyncDetected) {
+                m_DesyncDetected = true;
+                m_DesyncTick = it->first;
+                DESTINY_CORE_ERROR("Desincronización en el tick {0} con el jugador {1} ({2} != {3})",
+                                   it->first, i, it->second, remote->second);
+            }
+        }
+
+        // Comparado con todos: ya no hace falta (pero se sigue enviando el más reciente)
+        if (complete && std::next(it) != local.checksums.end()) {
+            for (size_t i = 0; i < m_Players.size(); i++) {
+                if (i != m_Config.localPlayer)
+                    m_Players[i].checksums.erase(it->first);
+            }
+            it = local.checksums.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+void LockstepSession::Prune() {
+    // Los lotes locales se guardan hasta que todos los jugadores los confirman
+    uint32_t localKeep = m_CurrentTick;
+    for (size_t i = 0; i < m_Players.size(); i++) {
+        if (i != m_Config.localPlayer)
+            localKeep = std::min(localKeep, m_Players[i].ackedTick);
+    }
+
+    uint32_t checksumKeep = m_CurrentTick > ChecksumHistory ? m_CurrentTick - ChecksumHistory : 0;
+
+    for (size_t i = 0; i < m_Players.size(); i++) {
+        PlayerState& player = m_Players[i];
+        uint32_t keep = i == m_Config.localPlayer ? localKeep : m_CurrentTick;
+        player.batches.erase(player.batches.begin(), player.batches.lower_bound(keep));
+        player.checksums.erase(player.checksums.begin(), player.checksums.lower_bound(checksumKeep));
+    }
+}
+
+void LockstepSession::AdaptInputDelay(double nowMs) {
+    float worstRtt = 0.0f, worstJitter = 0.0f;
+    bool measured = false;
+    for (size_t i = 0; i < m_Players.size(); i++) {
+        const PlayerState& player = m_Players[i];
+        if (i == m_Config.localPlayer || !player.hasRtt)
+            continue;
+
+        worstRtt = std::max(worstRtt, player.rttMs);
+        worstJitter = std::max(worstJitter, player.rttVarianceMs);
+        measured = true;
+    }
+
+    m_Stats.rttMs = worstRtt;
+    m_Stats.jitterMs = worstJitter;
+    if (!measured)
+        return;
+
+    // Un lote tiene que llegar antes de que el receptor alcance su tick:
+    // media ida más margen por jitter, más un tick de holgura
+    float oneWayMs = worstRtt * 0.5f + 2.0f * worstJitter;
+    uint32_t needed = static_cast<uint32_t>(std::ceil(oneWayMs / m_Config.tickMs)) + 1;
+    needed = std::min(std::max(needed, m_Config.minInputDelay), m_Config.maxInputDelay);
+
+    if (needed > m_InputDelay && nowMs - m_LastDelayChange >= DelayIncreaseIntervalMs) {
+        m_InputDelay++;
+        m_LastDelayChange = nowMs;
+    }
+    else if (needed < m_InputDelay && nowMs - m_LastDelayChange >= DelayDecreaseIntervalMs) {
+        m_InputDelay--;
+        m_LastDelayChange = nowMs;
+    }
+
+    // Si ni el retardo máximo cubre la latencia, alargar el turno en lugar de parar cada tick
+    float maxCovered = static_cast<float>(std::max(m_Config.maxInputDelay, 2u) - 1) * m_Config.tickMs;
+    m_TurnLengthMs = oneWayMs > maxCovered
+        ? m_Config.tickMs * oneWayMs / maxCovered
+        : m_Config.tickMs;
+}
+
+void LockstepSession::WriteBatch(BitWriter& writer, const std::vector<LockstepCommand>& commands) {
+    // Casi todos los lotes tienen 0-2 comandos: grupos de 3 bits
+    writer.WriteVarUInt(static_cast<uint32_t>(commands.size()), 3);
+
+    // Cada comando en delta respecto al anterior del lote (las órdenes de un
+    // jugador suelen repetir tipo, unidades contiguas y destinos cercanos)
+    LockstepCommand previous;
+    for (const LockstepCommand& command : commands) {
+        WriteCommand(writer, command, previous);
+        previous = command;
+    }
+}
+
+void LockstepSession::WriteCommand(BitWriter& writer, const LockstepCommand& command, const LockstepCommand& previous) {
+    bool sameType = command.type == previous.type;
+    writer.WriteBool(sameType);
+    if (!sameType)
+        writer.WriteBits(command.type, 8);
+
+    writer.WriteVarInt(static_cast<int32_t>(command.unitId - previous.unitId), 6);
+
+    writer.WriteBool(command.targetId != 0);
+    if (command.targetId != 0)
+        writer.WriteVarUInt(command.targetId);
+
+    bool samePosition = command.x == previous.x && command.y == previous.y;
+    writer.WriteBool(samePosition);
+    if (!samePosition) {
+        writer.WriteVarInt(static_cast<int32_t>(static_cast<uint32_t>(command.x) - static_cast<uint32_t>(previous.x)), 8);
+        writer.WriteVarInt(static_cast<int32_t>(static_cast<uint32_t>(command.y) - static_cast<uint32_t>(previous.y)), 8);
+    }
+}
+
+bool LockstepSession::ReadBatch(BitReader& reader, uint8_t player, std::vector<LockstepCommand>& outCommands) {
+    uint32_t count = reader.ReadVarUInt(3);
+    if (count > MaxCommandsPerBatch)
+        return false;
+
+    outCommands.resize(count);
+    LockstepCommand previous;
+    for (LockstepCommand& command : outCommands) {
+        command.player = player;
+        command.type = reader.ReadBool() ? previous.type : static_cast<uint8_t>(reader.ReadBits(8));
+        command.unitId = previous.unitId + static_cast<uint32_t>(reader.ReadVarInt(6));
+        command.targetId = reader.ReadBool() ? reader.ReadVarUInt() : 0;
+
+        if (reader.ReadBool()) {
+            command.x = previous.x;
+            command.y = previous.y;
+        }
+        else {
+            command.x = static_cast<int32_t>(static_cast<uint32_t>(previous.x) + static_cast<uint32_t>(reader.ReadVarInt(8)));
+            command.y = static_cast<int32_t>(static_cast<uint32_t>(previous.y) + static_cast<uint32_t>(reader.ReadVarInt(8)));
+        }
+
+        previous = command;
+    }
+
+    return reader.IsValid();
+}
+
+void LockstepSession::SendPackets(double nowMs) {
+    // Dos envíos por turno: suficiente redundancia sin saturar la red
+    if (nowMs - m_LastSendTime < m_Config.tickMs * 0.5)
+        return;
+    m_LastSendTime = nowMs;
+
+    const PlayerState& local = m_Players[m_Config.localPlayer];
+    BitWriter writer, batches, checksums, scratch;
+
+    for (size_t i = 0; i < m_Players.size(); i++) {
+        if (i == m_Config.localPlayer)
+            continue;
+
+        PlayerState& peer = m_Players[i];
+        writer.Clear();
+
+        writer.WriteBits(m_Config.protocolId, 16);
+        writer.WriteBits(m_Config.localPlayer, 3);
+        writer.WriteBits(static_cast<uint32_t>(static_cast<uint64_t>(nowMs)), 32);
+
+        // Eco de su última marca de tiempo para que mida el RTT
+        writer.WriteBool(peer.hasRemoteTime);
+        if (peer.hasRemoteTime) {
+            writer.WriteBits(peer.lastRemoteTime, 32);
+            writer.WriteVarUInt(static_cast<uint32_t>(std::max(0.0, nowMs - peer.lastRemoteReceived)));
+        }
+
+        // Confirmación: siguiente tick que necesitamos de este jugador
+        writer.WriteVarUInt(peer.nextTick);
+
+        // Checksums más recientes; van detrás de los lotes pero se codifican antes
+        // para saber cuánto sitio dejan
+        checksums.Clear();
+        uint32_t checksumCount = static_cast<uint32_t>(std::min<size_t>(local.checksums.size(), MaxChecksumsPerPacket));
+        checksums.WriteVarUInt(checksumCount, 3);
+        auto checksum = local.checksums.end();
+        std::advance(checksum, -static_cast<int>(checksumCount));
+        for (; checksum != local.checksums.end(); ++checksum) {
+            checksums.WriteVarUInt(checksum->first);
+            checksums.WriteBits(checksum->second, 32);
+        }
+
+        // Nuestros lotes que aún no ha confirmado, mientras quepan en el datagrama.
+        // Siempre va al menos uno: SealLocalBatches garantiza que cabe solo
+        uint32_t first = peer.ackedTick;
+        if (!local.batches.empty())
+            first = std::max(first, local.batches.begin()->first);
+        uint32_t available = local.nextTick > first ? std::min(local.nextTick - first, MaxBatchesPerPacket) : 0;
+
+        writer.WriteVarUInt(first);
+        size_t budget = Transport::MaxDatagramSize * 8 - writer.GetBitCount() - BatchCountBits - checksums.GetBitCount();
+
+        batches.Clear();
+        uint32_t count = 0;
+        uint64_t commands = 0;
+        for (; count < available; count++) {
+            const std::vector<LockstepCommand>& batch = local.batches.at(first + count);
+            scratch.Clear();
+            WriteBatch(scratch, batch);
+            if (count > 0 && batches.GetBitCount() + scratch.GetBitCount() > budget)
+                break;
+
+            batches.Append(scratch);
+            commands += batch.size();
+        }
+
+        writer.WriteVarUInt(count);
+        writer.Append(batches);
+        writer.Append(checksums);
+        m_Stats.commandBits += batches.GetBitCount();
+        m_Stats.commandsSent += commands;
+
+        if (m_Transport.Send(peer.address, writer.GetData(), writer.GetSize())) {
+            m_Stats.bytesSent += writer.GetSize();
+            m_Stats.packetsSent++;
+        }
+    }
+}
+
+void LockstepSession::ReceivePackets(double nowMs) {
+    NetPacket packet;
+    while (m_Transport.Receive(packet)) {
+        m_Stats.bytesReceived += packet.data.size();
+
+        BitReader reader(packet.data.data(), packet.data.size());
+        uint32_t protocolId = reader.ReadBits(16);
+        uint32_t player = reader.ReadBits(3);
+
+        if (!reader.IsValid() || protocolId != m_Config.protocolId || player >= m_Players.size() ||
+            player == m_Config.localPlayer || m_Players[player].address != packet.from) {
+            m_Stats.packetsRejected++;
+            continue;
+        }
+
+        ReadPacket(m_Players[player], reader, nowMs);
+    }
+}
+
+void LockstepSession::ReadPacket(PlayerState& sender, BitReader& reader, double nowMs) {
+    uint8_t player = static_cast<uint8_t>(&sender - m_Players.data());
+
+    // Leer todo antes de aplicar nada: un paquete truncado se descarta entero
+    uint32_t sendTime = reader.ReadBits(32);
+    bool hasEcho = reader.ReadBool();
+    uint32_t echoTime = hasEcho ? reader.ReadBits(32) : 0;
+    uint32_t holdMs = hasEcho ? reader.ReadVarUInt() : 0;
+    uint32_t ack = reader.ReadVarUInt();
+    uint32_t first = reader.ReadVarUInt();
+    uint32_t count = reader.ReadVarUInt();
+
+    if (count > MaxBatchesPerPacket) {
+        m_Stats.packetsRejected++;
+        return;
+    }
+
+    std::vector<std::vector<LockstepCommand>> batches(count);
+    for (uint32_t i = 0; i < count; i++) {
+        if (!ReadBatch(reader, player, batches[i])) {
+            m_Stats.packetsRejected++;
+            return;
+        }
+    }
+
+    uint32_t checksumCount = reader.ReadVarUInt(3);
+    std::vector<std::pair<uint32_t, uint32_t>> checksums;
+    for (uint32_t i = 0; i < checksumCount && i < MaxChecksumsPerPacket; i++) {
+        uint32_t tick = reader.ReadVarUInt();
+        checksums.push_back({ tick, reader.ReadBits(32) });
+    }
+
+    if (!reader.IsValid() || checksumCount > MaxChecksumsPerPacket) {
+        m_Stats.packetsRejected++;
+        return;
+    }
+
+    m_Stats.packetsReceived++;
+
+    // Marca de tiempo más reciente (los paquetes pueden llegar desordenados)
+    if (!sender.hasRemoteTime || static_cast<int32_t>(sendTime - sender.lastRemoteTime) > 0) {
+        sender.lastRemoteTime = sendTime;
+        sender.lastRemoteReceived = nowMs;
+        sender.hasRemoteTime = true;
+    }
+
+    if (hasEcho) {
+        uint32_t now = static_cast<uint32_t>(static_cast<uint64_t>(nowMs));
+        int32_t sample = static_cast<int32_t>(now - echoTime - holdMs);
+        if (sample >= 0 && sample < 10000) {
+            float rtt = static_cast<float>(sample);
+            if (!sender.hasRtt) {
+                sender.rttMs = rtt;
+                sender.rttVarianceMs = rtt * 0.5f;
+                sender.hasRtt = true;
+            }
+            else {
+                // Suavizado como el de TCP (RFC 6298)
+                sender.rttVarianceMs = 0.75f * sender.rttVarianceMs + 0.25f * std::abs(sender.rttMs - rtt);
+                sender.rttMs = 0.875f * sender.rttMs + 0.125f * rtt;
+            }
+        }
+    }
+
+    sender.ackedTick = std::max(sender.ackedTick, ack);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t tick = first + i;
+        if (tick >= sender.nextTick && sender.batches.find(tick) == sender.batches.end())
+            sender.batches[tick] = std::move(batches[i]);
+    }
+
+    while (sender.batches.find(sender.nextTick) != sender.batches.end())
+        sender.nextTick++;
+
+    for (const auto& checksum : checksums)
+        sender.checksums[checksum.first] = checksum.second;
+}
+
+} // namespace Destiny
\ No newline at end of file
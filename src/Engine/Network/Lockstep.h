@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Transport.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace Destiny {
+
+class BitWriter;
+class BitReader;
+
+// Orden de un jugador. El significado de type lo define el juego; las
+// coordenadas son enteras para que la simulación siga siendo determinista.
+struct LockstepCommand {
+    uint8_t player = 0;      // Lo rellena la sesión
+    uint8_t type = 0;
+    uint32_t unitId = 0;     // Unidad o grupo que recibe la orden
+    uint32_t targetId = 0;   // 0 = sin objetivo
+    int32_t x = 0;
+    int32_t y = 0;
+};
+
+struct LockstepConfig {
+    uint8_t localPlayer = 0;
+    std::vector<NetAddress> players;   // Dirección de cada jugador (la local se ignora)
+
+    float tickMs = 50.0f;              // Duración nominal de un turno
+    uint32_t minInputDelay = 2;        // En ticks
+    uint32_t maxInputDelay = 12;
+    uint16_t protocolId = 0x4453;      // Descarta paquetes de otras partidas/versiones
+};
+
+// Lockstep determinista: todos los jugadores simulan los mismos ticks con los
+// mismos comandos. Los comandos locales se programan inputDelay ticks en el
+// futuro y cada tick sólo avanza cuando están los lotes de todos los jugadores.
+//
+// Por la red sólo viajan los lotes de comandos (codificados por bits y en
+// delta respecto al comando anterior) y un checksum por tick del estado de la
+// simulación. Cada paquete repite los lotes aún no confirmados, así que la
+// pérdida de paquetes no necesita retransmisiones explícitas. El retardo de
+// entrada y la duración del turno se adaptan al RTT medido.
+class LockstepSession {
+public:
+    static constexpr uint32_t MaxPlayers = 8;
+
+    LockstepSession(Transport& transport, const LockstepConfig& config);
+
+    // No permitir copia
+    LockstepSession(const LockstepSession&) = delete;
+    LockstepSession& operator=(const LockstepSession&) = delete;
+
+    // Encolar un comando del jugador local. Entra en el próximo lote; si ese lote
+    // ya está lleno (por número de comandos o por tamaño de paquete), en los siguientes
+    void QueueCommand(const LockstepCommand& command);
+
+    // Recibir y enviar; llamar una vez por frame con el tiempo actual en ms
+    void Update(double nowMs);
+
+    // Consumir el siguiente tick si ya están todos sus lotes. outCommands recibe
+    // los comandos ordenados por jugador y por orden de emisión.
+    bool AdvanceTick(std::vector<LockstepCommand>& outCommands);
+
+    // Checksum del estado tras simular 'tick' (el que devolvió AdvanceTick)
+    void SubmitChecksum(uint32_t tick, uint32_t checksum);
+
+    // Siguiente tick a simular
+    uint32_t GetCurrentTick() const { return m_CurrentTick; }
+    uint32_t GetInputDelay() const { return m_InputDelay; }
+
+    // Duración de turno recomendada: crece si la latencia no cabe en maxInputDelay
+    float GetTurnLengthMs() const { return m_TurnLengthMs; }
+
+    bool HasDesync() const { return m_DesyncDetected; }
+    uint32_t GetDesyncTick() const { return m_DesyncTick; }
+
+    // FNV-1a de 32 bits para calcular checksums del estado de la simulación
+    static uint32_t HashState(const void* data, size_t size, uint32_t hash = 2166136261u);
+
+    // Estadísticas
+    struct Stats {
+        float rttMs = 0.0f;           // RTT suavizado del peor jugador remoto
+        float jitterMs = 0.0f;
+        uint32_t inputDelay = 0;
+        uint32_t stalledUpdates = 0;  // Updates en los que faltaba algún lote
+        uint64_t bytesSent = 0;
+        uint64_t bytesReceived = 0;
+        uint32_t packetsSent = 0;
+        uint32_t packetsReceived = 0;
+        uint32_t packetsRejected = 0;
+        uint64_t commandBits = 0;     // Bits usados por comandos enviados
+        uint64_t commandsSent = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct PlayerState {
+        NetAddress address;
+
+        // Lotes por tick: [firstTick, nextTick) recibidos sin huecos, más los
+        // que llegan adelantados
+        std::map<uint32_t, std::vector<LockstepCommand>> batches;
+        uint32_t nextTick = 0;
+
+        // Ticks del jugador local que este jugador ya ha confirmado
+        uint32_t ackedTick = 0;
+
+        std::map<uint32_t, uint32_t> checksums;
+
+        // Medición de RTT
+        uint32_t lastRemoteTime = 0;
+        double lastRemoteReceived = 0.0;
+        bool hasRemoteTime = false;
+        float rttMs = 0.0f;
+        float rttVarianceMs = 0.0f;
+        bool hasRtt = false;
+    };
+
+    void SealLocalBatches();
+    void SendPackets(double nowMs);
+    void ReceivePackets(double nowMs);
+    void ReadPacket(PlayerState& sender, BitReader& reader, double nowMs);
+    void AdaptInputDelay(double nowMs);
+    void CompareChecksums();
+    void Prune();
+
+    static void WriteBatch(BitWriter& writer, const std::vector<LockstepCommand>& commands);
+    static void WriteCommand(BitWriter& writer, const LockstepCommand& command, const LockstepCommand& previous);
+    static bool ReadBatch(BitReader& reader, uint8_t player, std::vector<LockstepCommand>& outCommands);
+
+    Transport& m_Transport;
+    LockstepConfig m_Config;
+    std::vector<PlayerState> m_Players;
+
+    std::vector<LockstepCommand> m_PendingCommands;
+    uint32_t m_CurrentTick = 0;
+    uint32_t m_InputDelay;
+    float m_TurnLengthMs;
+
+    double m_LastSendTime = -1.0e9;
+    double m_LastDelayChange = 0.0;
+
+    bool m_DesyncDetected = false;
+    uint32_t m_DesyncTick = 0;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "LoopbackTransport.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Destiny {
+
+static double SteadyTimeMs() {
+    using namespace std::chrono;
+    return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+}
+
+LoopbackNetwork::LoopbackNetwork(uint32_t seed)
+    : m_Random(seed), m_StartTime(SteadyTimeMs()) {
+}
+
+void LoopbackNetwork::SetConditions(const Conditions& conditions) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Conditions = conditions;
+}
+
+void LoopbackNetwork::AdvanceTime(double ms) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_ManualTime += ms;
+}
+
+double LoopbackNetwork::GetTime() const {
+    return m_ManualClock ? m_ManualTime : SteadyTimeMs() - m_StartTime;
+}
+
+std::unique_ptr<Transport> LoopbackNetwork::CreateEndpoint(uint16_t port) {
+    return std::make_unique<LoopbackTransport>(*this, port);
+}
+
+LoopbackNetwork::Stats LoopbackNetwork::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+void LoopbackNetwork::Submit(uint16_t from, const NetAddress& to, const uint8_t* data, size_t size) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Stats.sent++;
+
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+    if (chance(m_Random) < m_Conditions.lossRate) {
+        m_Stats.dropped++;
+        return;
+    }
+
+    uint32_t copies = chance(m_Random) < m_Conditions.duplicateRate ? 2 : 1;
+    m_Stats.duplicated += copies - 1;
+
+    double now = GetTime();
+    for (uint32_t i = 0; i < copies; i++) {
+        float jitter = m_Conditions.jitterMs * (chance(m_Random) * 2.0f - 1.0f);
+        double delay = std::max(0.0, static_cast<double>(m_Conditions.latencyMs + jitter));
+
+        InFlight entry;
+        entry.deliverAt = now + delay;
+        entry.sequence = m_Sequence++;
+        entry.to = to.port;
+        entry.packet.from = { 0x7f000001, from };
+        entry.packet.data.assign(data, data + size);
+        m_InFlight.push_back(std::move(entry));
+    }
+}
+
+bool LoopbackNetwork::Poll(uint16_t port, NetPacket& outPacket) {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    // El primero en llegar de los que ya han llegado a este puerto
+    double now = GetTime();
+    auto best = m_InFlight.end();
+    for (auto it = m_InFlight.begin(); it != m_InFlight.end(); ++it) {
+        if (it->to != port || it->deliverAt > now)
+            continue;
+        if (best == m_InFlight.end() || it->deliverAt < best->deliverAt ||
+            (it->deliverAt == best->deliverAt && it->sequence < best->sequence))
+            best = it;
+    }
+
+    if (best == m_InFlight.end())
+        return false;
+
+    outPacket = std::move(best->packet);
+    if (best != m_InFlight.end() - 1)
+        *best = std::move(m_InFlight.back());
+    m_InFlight.pop_back();
+    m_Stats.delivered++;
+    return true;
+}
+
+bool LoopbackTransport::Send(const NetAddress& to, const uint8_t* data, size_t size) {
+    // Mismo límite que UDP para que los paquetes demasiado grandes se vean aquí
+    if (size > MaxDatagramSize)
+        return false;
+
+    m_Network.Submit(m_Port, to, data, size);
+    return true;
+}
+
+bool LoopbackTransport::Receive(NetPacket& outPacket) {
+    return m_Network.Poll(m_Port, outPacket);
+}
+
+} // namespace Destiny
\ No newline at end of file
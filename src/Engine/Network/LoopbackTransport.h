@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Transport.h"
+
+#include <memory>
+#include <mutex>
+#include <random>
+
+namespace Destiny {
+
+// Red simulada en el propio proceso para probar el juego en red en una máquina.
+// Cada LoopbackTransport creado por la red es un extremo identificado por su puerto.
+// Los envíos se retrasan (latencia + jitter, lo que también los desordena) y pueden
+// perderse o duplicarse. Con una semilla fija y el reloj manual es reproducible.
+class LoopbackNetwork {
+public:
+    struct Conditions {
+        float latencyMs = 0.0f;       // Retardo de ida
+        float jitterMs = 0.0f;        // Variación uniforme +- jitterMs
+        float lossRate = 0.0f;        // 0..1
+        float duplicateRate = 0.0f;   // 0..1
+    };
+
+    explicit LoopbackNetwork(uint32_t seed = 1);
+
+    // No permitir copia
+    LoopbackNetwork(const LoopbackNetwork&) = delete;
+    LoopbackNetwork& operator=(const LoopbackNetwork&) = delete;
+
+    void SetConditions(const Conditions& conditions);
+    const Conditions& GetConditions() const { return m_Conditions; }
+
+    // Reloj manual (ms) para pruebas deterministas; por defecto se usa el reloj real
+    void SetManualClock(bool manual) { m_ManualClock = manual; }
+    void AdvanceTime(double ms);
+    double GetTime() const;
+
+    std::unique_ptr<Transport> CreateEndpoint(uint16_t port);
+
+    // Estadísticas
+    struct Stats {
+        uint32_t sent = 0;
+        uint32_t delivered = 0;
+        uint32_t dropped = 0;
+        uint32_t duplicated = 0;
+    };
+
+    Stats GetStats() const;
+
+private:
+    friend class LoopbackTransport;
+
+    struct InFlight {
+        double deliverAt;
+        uint64_t sequence;   // Desempate estable entre envíos con el mismo instante
+        uint16_t to;
+        NetPacket packet;
+    };
+
+    void Submit(uint16_t from, const NetAddress& to, const uint8_t* data, size_t size);
+    bool Poll(uint16_t port, NetPacket& outPacket);
+
+    mutable std::mutex m_Mutex;
+    Conditions m_Conditions;
+    std::mt19937 m_Random;
+    std::vector<InFlight> m_InFlight;
+    uint64_t m_Sequence = 0;
+
+    bool m_ManualClock = false;
+    double m_ManualTime = 0.0;
+    double m_StartTime;
+
+    Stats m_Stats;
+};
+
+// Extremo de LoopbackNetwork; la red debe vivir más que sus extremos
+class LoopbackTransport : public Transport {
+public:
+    LoopbackTransport(LoopbackNetwork& network, uint16_t port)
+        : m_Network(network), m_Port(port) {}
+
+    bool Send(const NetAddress& to, const uint8_t* data, size_t size) override;
+    bool Receive(NetPacket& outPacket) override;
+    NetAddress GetLocalAddress() const override { return { 0x7f000001, m_Port }; }
+
+private:
+    LoopbackNetwork& m_Network;
+    uint16_t m_Port;
+};
+
+} // namespace Destiny
\ No newline at end of file
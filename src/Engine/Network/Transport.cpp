@@ -0,0 +1,27 @@
+#include "Transport.h"
+
+#include <cstdio>
+
+namespace Destiny {
+
+NetAddress NetAddress::FromString(const std::string& ip, uint16_t port) {
+    unsigned int a, b, c, d;
+    char extra;
+    NetAddress address;
+    address.port = port;
+
+    if (std::sscanf(ip.c_str(), "%u.%u.%u.%u%c", &a, &b, &c, &d, &extra) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+        return address;
+
+    address.ip = (a << 24) | (b << 16) | (c << 8) | d;
+    return address;
+}
+
+std::string NetAddress::ToString() const {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u:%u", (ip >> 24) & 0xff, (ip >> 16) & 0xff,
+                  (ip >> 8) & 0xff, ip & 0xff, static_cast<unsigned int>(port));
+    return buffer;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Destiny {
+
+// Dirección de red IPv4 (en orden de host). LoopbackTransport usa sólo el puerto.
+struct NetAddress {
+    uint32_t ip = 0;
+    uint16_t port = 0;
+
+    bool operator==(const NetAddress& other) const { return ip == other.ip && port == other.port; }
+    bool operator!=(const NetAddress& other) const { return !(*this == other); }
+
+    // "a.b.c.d"; ip = 0 si no se puede interpretar
+    static NetAddress FromString(const std::string& ip, uint16_t port);
+    std::string ToString() const;
+};
+
+// Datagrama recibido
+struct NetPacket {
+    NetAddress from;
+    std::vector<uint8_t> data;
+};
+
+// Transporte de datagramas no fiable y sin conexión (UDP o simulado).
+// Los paquetes pueden perderse, duplicarse o llegar desordenados.
+class Transport {
+public:
+    // Tamaño máximo de datagrama que se envía o acepta (por debajo del MTU habitual)
+    static constexpr size_t MaxDatagramSize = 1400;
+
+    virtual ~Transport() = default;
+
+    virtual bool Send(const NetAddress& to, const uint8_t* data, size_t size) = 0;
+
+    // Siguiente paquete pendiente; false si no hay ninguno (nunca bloquea)
+    virtual bool Receive(NetPacket& outPacket) = 0;
+
+    virtual NetAddress GetLocalAddress() const = 0;
+};
+
+} // namespace Destiny
\ No newline at end of file
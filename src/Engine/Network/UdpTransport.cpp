@@ -0,0 +1,154 @@
+#include "UdpTransport.h"
+#include "../Core/Log.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <arpa/inet.h>
+    #include <errno.h>
+    #include <fcntl.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
+namespace Destiny {
+
+#ifdef _WIN32
+// Winsock necesita inicializarse una vez por proceso
+static bool InitializeSockets() {
+    static bool initialized = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    return initialized;
+}
+
+static void CloseSocket(uintptr_t socket) {
+    closesocket(static_cast<SOCKET>(socket));
+}
+
+static bool SetNonBlocking(uintptr_t socket) {
+    u_long mode = 1;
+    return ioctlsocket(static_cast<SOCKET>(socket), FIONBIO, &mode) == 0;
+}
+
+static bool WouldBlock() {
+    return WSAGetLastError() == WSAEWOULDBLOCK;
+}
+
+static bool ConnectionReset() {
+    return WSAGetLastError() == WSAECONNRESET;
+}
+#else
+static bool InitializeSockets() {
+    return true;
+}
+
+static void CloseSocket(int socket) {
+    close(socket);
+}
+
+static bool SetNonBlocking(int socket) {
+    int flags = fcntl(socket, F_GETFL, 0);
+    return flags != -1 && fcntl(socket, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+static bool WouldBlock() {
+    return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+static bool ConnectionReset() {
+    return errno == ECONNREFUSED;
+}
+#endif
+
+UdpTransport::~UdpTransport() {
+    Close();
+}
+
+bool UdpTransport::Open(uint16_t port) {
+    Close();
+
+    if (!InitializeSockets()) {
+        DESTINY_CORE_ERROR("No se pudo inicializar la red");
+        return false;
+    }
+
+    m_Socket = static_cast<SocketHandle>(socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP));
+    if (m_Socket == InvalidSocket) {
+        DESTINY_CORE_ERROR("No se pudo crear el socket UDP");
+        return false;
+    }
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+
+    if (bind(m_Socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || !SetNonBlocking(m_Socket)) {
+        DESTINY_CORE_ERROR("No se pudo abrir el puerto UDP {0}", port);
+        Close();
+        return false;
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(m_Socket, reinterpret_cast<sockaddr*>(&address), &length);
+    m_LocalAddress.ip = ntohl(address.sin_addr.s_addr);
+    m_LocalAddress.port = ntohs(address.sin_port);
+
+    DESTINY_CORE_INFO("Socket UDP abierto en el puerto {0}", m_LocalAddress.port);
+    return true;
+}
+
+void UdpTransport::Close() {
+    if (m_Socket != InvalidSocket) {
+        CloseSocket(m_Socket);
+        m_Socket = InvalidSocket;
+    }
+}
+
+bool UdpTransport::Send(const NetAddress& to, const uint8_t* data, size_t size) {
+    if (m_Socket == InvalidSocket || size > MaxDatagramSize)
+        return false;
+
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(to.ip);
+    address.sin_port = htons(to.port);
+
+    auto sent = sendto(m_Socket, reinterpret_cast<const char*>(data), static_cast<int>(size), 0,
+                       reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    return sent == static_cast<decltype(sent)>(size);
+}
+
+bool UdpTransport::Receive(NetPacket& outPacket) {
+    if (m_Socket == InvalidSocket)
+        return false;
+
+    uint8_t buffer[MaxDatagramSize];
+    sockaddr_in address = {};
+    socklen_t length = sizeof(address);
+
+    // Los errores de "puerto inalcanzable" de un envío anterior no cortan la lectura
+    while (true) {
+        auto received = recvfrom(m_Socket, reinterpret_cast<char*>(buffer), sizeof(buffer), 0,
+                                 reinterpret_cast<sockaddr*>(&address), &length);
+        if (received < 0) {
+            if (ConnectionReset())
+                continue;
+            if (!WouldBlock())
+                DESTINY_CORE_WARN("Error al recibir por UDP");
+            return false;
+        }
+
+        outPacket.from.ip = ntohl(address.sin_addr.s_addr);
+        outPacket.from.port = ntohs(address.sin_port);
+        outPacket.data.assign(buffer, buffer + received);
+        return true;
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
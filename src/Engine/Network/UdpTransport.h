@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Transport.h"
+
+namespace Destiny {
+
+// Transporte sobre un socket UDP no bloqueante
+class UdpTransport : public Transport {
+public:
+    UdpTransport() = default;
+    ~UdpTransport() override;
+
+    // No permitir copia
+    UdpTransport(const UdpTransport&) = delete;
+    UdpTransport& operator=(const UdpTransport&) = delete;
+
+    // Abrir el socket en el puerto dado (0 = cualquiera)
+    bool Open(uint16_t port);
+    void Close();
+    bool IsOpen() const { return m_Socket != InvalidSocket; }
+
+    bool Send(const NetAddress& to, const uint8_t* data, size_t size) override;
+    bool Receive(NetPacket& outPacket) override;
+    NetAddress GetLocalAddress() const override { return m_LocalAddress; }
+
+private:
+#ifdef _WIN32
+    using SocketHandle = uintptr_t;
+#else
+    using SocketHandle = int;
+#endif
+    static constexpr SocketHandle InvalidSocket = static_cast<SocketHandle>(-1);
+
+    SocketHandle m_Socket = InvalidSocket;
+    NetAddress m_LocalAddress;
+};
+
+} // namespace Destiny
\ No newline at end of file
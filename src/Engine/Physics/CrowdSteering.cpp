@@ -0,0 +1,316 @@
+#include "CrowdSteering.h"
+#include "SpatialGrid.h"
+#include "../Core/JobSystem.h"
+#include "../Math/QuadTransform.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #define DESTINY_TARGET_AVX2
+    #else
+        #define DESTINY_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace Destiny {
+
+// Carriles de acumulación: los de AVX2, también en la versión escalar
+static constexpr uint32_t Lanes = 8;
+static constexpr uint32_t MinUnitsPerJob = 256;
+
+// Acumuladores por carril: lanes[accumulator * Lanes + lane]
+enum SteeringAccumulator : uint32_t {
+    AccumSeparationX = 0,
+    AccumSeparationY,
+    AccumOffsetX,
+    AccumOffsetY,
+    AccumVelocityX,
+    AccumVelocityY,
+    AccumCount,
+    AccumulatorCount
+};
+
+// Suma de los 8 carriles, siempre en el mismo orden
+static inline float SumLanes(const float* lanes) {
+    return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+}
+
+CrowdSteering::CrowdSteering(JobSystem* jobSystem)
+    : m_JobSystem(jobSystem) {
+    m_UseAVX2 = QuadTransform::GetSimdLevel() == SimdLevel::AVX2;
+}
+
+void CrowdSteering::SetObstacles(const SpatialGrid* grid, const float* positionX, const float* positionY, const float* radius) {
+    m_ObstacleGrid = grid;
+    m_ObstacleX = positionX;
+    m_ObstacleY = positionY;
+    m_ObstacleRadius = radius;
+}
+
+void CrowdSteering::Update(const SpatialGrid& units, const SteeringInput& input, uint32_t count, float deltaTime,
+                           float* outVelocityX, float* outVelocityY) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    // 1. Estado en el orden de la rejilla; el relleno permite leer 8 más allá del final
+    const uint32_t* ids = units.GetSortedIds();
+    size_t padded = static_cast<size_t>(count) + Lanes;
+    m_X.assign(padded, 0.0f);
+    m_Y.assign(padded, 0.0f);
+    m_VelocityX.assign(padded, 0.0f);
+    m_VelocityY.assign(padded, 0.0f);
+    m_PreferredX.assign(padded, 0.0f);
+    m_PreferredY.assign(padded, 0.0f);
+    m_Groups.assign(padded, 0);
+
+    auto gather = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t s = begin; s < end; s++) {
+            uint32_t id = ids[s];
+            m_X[s] = input.positionX[id];
+            m_Y[s] = input.positionY[id];
+            m_VelocityX[s] = input.velocityX[id];
+            m_VelocityY[s] = input.velocityY[id];
+            m_PreferredX[s] = input.preferredX ? input.preferredX[id] : 0.0f;
+            m_PreferredY[s] = input.preferredY ? input.preferredY[id] : 0.0f;
+            m_Groups[s] = input.groups ? input.groups[id] : 0;
+        }
+    };
+
+    // 2. Fuerzas: las unidades son independientes, los rangos siguen el orden de las celdas
+    std::atomic<uint32_t> candidates{ 0 };
+    auto steer = [&](uint32_t begin, uint32_t end) {
+        uint32_t visited = 0;
+        SteerRange(units, begin, end, deltaTime, outVelocityX, outVelocityY, visited);
+        candidates.fetch_add(visited, std::memory_order_relaxed);
+    };
+
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(count, MinUnitsPerJob, gather);
+        m_JobSystem->ParallelFor(count, MinUnitsPerJob, steer);
+    }
+    else {
+        gather(0, count);
+        steer(0, count);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.updateMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.unitCount = count;
+    m_Stats.candidatesVisited = candidates.load();
+    m_Stats.simd = m_UseAVX2 && !m_ForceScalar;
+}
+
+void CrowdSteering::SteerRange(const SpatialGrid& units, uint32_t begin, uint32_t end, float deltaTime,
+                               float* outVelocityX, float* outVelocityY, uint32_t& outCandidates) const {
+    const SteeringParams& p = m_Params;
+    const uint32_t* ids = units.GetSortedIds();
+    bool simd = m_UseAVX2 && !m_ForceScalar;
+    alignas(32) float lanes[AccumulatorCount * Lanes];
+
+    for (uint32_t s = begin; s < end; s++) {
+        float px = m_X[s];
+        float py = m_Y[s];
+        float vx = m_VelocityX[s];
+        float vy = m_VelocityY[s];
+
+        std::memset(lanes, 0, sizeof(lanes));
+        units.ForEachCellRange(glm::vec2(px, py), p.neighborRadius, [&](uint32_t first, uint32_t last) {
+            outCandidates += last - first;
+            if (simd)
+                AccumulateAVX2(s, first, last, lanes);
+            else
+                AccumulateScalar(s, first, last, lanes);
+        });
+
+        NeighborSums sums;
+        sums.separationX = SumLanes(&lanes[AccumSeparationX * Lanes]);
+        sums.separationY = SumLanes(&lanes[AccumSeparationY * Lanes]);
+        sums.offsetX = SumLanes(&lanes[AccumOffsetX * Lanes]);
+        sums.offsetY = SumLanes(&lanes[AccumOffsetY * Lanes]);
+        sums.velocityX = SumLanes(&lanes[AccumVelocityX * Lanes]);
+        sums.velocityY = SumLanes(&lanes[AccumVelocityY * Lanes]);
+        sums.count = SumLanes(&lanes[AccumCount * Lanes]);
+
+        // Búsqueda y separación
+        float fx = p.seekWeight * (m_PreferredX[s] - vx);
+        float fy = p.seekWeight * (m_PreferredY[s] - vy);
+        fx += p.separationWeight * p.maxSpeed * sums.separationX;
+        fy += p.separationWeight * p.maxSpeed * sums.separationY;
+
+        // Cohesión hacia el centro del grupo cercano y alineación con su velocidad media
+        if (sums.count > 0.0f) {
+            fx += p.cohesionWeight * (sums.offsetX / sums.count);
+            fy += p.cohesionWeight * (sums.offsetY / sums.count);
+            fx += p.alignmentWeight * (sums.velocityX / sums.count - vx);
+            fy += p.alignmentWeight * (sums.velocityY / sums.count - vy);
+        }
+
+        // Obstáculos: empuje hacia fuera que crece al entrar en el margen
+        if (m_ObstacleGrid) {
+            m_ObstacleGrid->ForEachInRadius(glm::vec2(px, py), p.avoidanceDistance, [&](uint32_t obstacle) {
+                float dx = px - m_ObstacleX[obstacle];
+                float dy = py - m_ObstacleY[obstacle];
+                float distance = std::sqrt(dx * dx + dy * dy);
+                float reach = m_ObstacleRadius[obstacle] + p.avoidanceDistance;
+                if (distance <= 0.0f || distance >= reach)
+                    return;
+
+                float strength = std::min((reach - distance) / p.avoidanceDistance, 1.0f) / distance;
+                fx += p.obstacleWeight * p.maxSpeed * (dx * strength);
+                fy += p.obstacleWeight * p.maxSpeed * (dy * strength);
+            });
+        }
+
+        float force = fx * fx + fy * fy;
+        if (force > p.maxForce * p.maxForce) {
+            float scale = p.maxForce / std::sqrt(force);
+            fx *= scale;
+            fy *= scale;
+        }
+
+        float nvx = vx + fx * deltaTime;
+        float nvy = vy + fy * deltaTime;
+        float speed = nvx * nvx + nvy * nvy;
+        if (speed > p.maxSpeed * p.maxSpeed) {
+            float scale = p.maxSpeed / std::sqrt(speed);
+            nvx *= scale;
+            nvy *= scale;
+        }
+
+        uint32_t id = ids[s];
+        outVelocityX[id] = nvx;
+        outVelocityY[id] = nvy;
+    }
+}
+
+// Referencia de AccumulateAVX2: el candidato j va al carril (j - begin) % 8 y cada
+// operación coincide con la del carril vectorial
+void CrowdSteering::AccumulateScalar(uint32_t self, uint32_t begin, uint32_t end, float* lanes) const {
+    float px = m_X[self];
+    float py = m_Y[self];
+    uint32_t group = m_Groups[self];
+    float neighborRadius2 = m_Params.neighborRadius * m_Params.neighborRadius;
+    float separationRadius = m_Params.separationRadius;
+
+    for (uint32_t j = begin; j < end; j++) {
+        if (j == self)
+            continue;
+
+        uint32_t lane = (j - begin) & (Lanes - 1);
+        float ox = m_X[j] - px;
+        float oy = m_Y[j] - py;
+        float d2 = ox * ox + oy * oy;
+
+        // Misma posición (unidades creadas en el mismo punto): no hay dirección de la
+        // que separarse, así que se empuja en x con la fuerza máxima y el sentido lo
+        // decide el índice, opuesto para cada unidad del par
+        if (d2 == 0.0f) {
+            float push = j < self ? -1.0f : 1.0f;
+            lanes[AccumSeparationX * Lanes + lane] = lanes[AccumSeparationX * Lanes + lane] - push;
+            continue;
+        }
+
+        if (!(d2 < neighborRadius2))
+            continue;
+
+        float d = std::sqrt(d2);
+        if (d < separationRadius) {
+            float w = (separationRadius - d) / (d * separationRadius);
+            lanes[AccumSeparationX * Lanes + lane] = lanes[AccumSeparationX * Lanes + lane] - ox * w;
+            lanes[AccumSeparationY * Lanes + lane] = lanes[AccumSeparationY * Lanes + lane] - oy * w;
+        }
+
+        if (m_Groups[j] == group) {
+            lanes[AccumOffsetX * Lanes + lane] += ox;
+            lanes[AccumOffsetY * Lanes + lane] += oy;
+            lanes[AccumVelocityX * Lanes + lane] += m_VelocityX[j];
+            lanes[AccumVelocityY * Lanes + lane] += m_VelocityY[j];
+            lanes[AccumCount * Lanes + lane] += 1.0f;
+        }
+    }
+}
+
+#ifdef DESTINY_SIMD_X86
+
+DESTINY_TARGET_AVX2
+void CrowdSteering::AccumulateAVX2(uint32_t self, uint32_t begin, uint32_t end, float* lanes) const {
+    const __m256 px = _mm256_set1_ps(m_X[self]);
+    const __m256 py = _mm256_set1_ps(m_Y[self]);
+    const __m256i group = _mm256_set1_epi32(static_cast<int>(m_Groups[self]));
+    const __m256 neighborRadius2 = _mm256_set1_ps(m_Params.neighborRadius * m_Params.neighborRadius);
+    const __m256 separationRadius = _mm256_set1_ps(m_Params.separationRadius);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    const __m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i selfIndex = _mm256_set1_epi32(static_cast<int>(self));
+    const __m256i endIndex = _mm256_set1_epi32(static_cast<int>(end));
+
+    __m256 separationX = _mm256_load_ps(&lanes[AccumSeparationX * Lanes]);
+    __m256 separationY = _mm256_load_ps(&lanes[AccumSeparationY * Lanes]);
+    __m256 offsetX = _mm256_load_ps(&lanes[AccumOffsetX * Lanes]);
+    __m256 offsetY = _mm256_load_ps(&lanes[AccumOffsetY * Lanes]);
+    __m256 velocityX = _mm256_load_ps(&lanes[AccumVelocityX * Lanes]);
+    __m256 velocityY = _mm256_load_ps(&lanes[AccumVelocityY * Lanes]);
+    __m256 count = _mm256_load_ps(&lanes[AccumCount * Lanes]);
+
+    for (uint32_t j = begin; j < end; j += Lanes) {
+        // Carriles válidos: dentro del tramo y distintos de la propia unidad
+        __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(j)), laneOffsets);
+        __m256i inRange = _mm256_andnot_si256(_mm256_cmpeq_epi32(index, selfIndex), _mm256_cmpgt_epi32(endIndex, index));
+
+        __m256 ox = _mm256_sub_ps(_mm256_loadu_ps(&m_X[j]), px);
+        __m256 oy = _mm256_sub_ps(_mm256_loadu_ps(&m_Y[j]), py);
+        __m256 d2 = _mm256_add_ps(_mm256_mul_ps(ox, ox), _mm256_mul_ps(oy, oy));
+        __m256 neighbor = _mm256_and_ps(_mm256_castsi256_ps(inRange),
+                                        _mm256_and_ps(_mm256_cmp_ps(d2, neighborRadius2, _CMP_LT_OQ),
+                                                      _mm256_cmp_ps(d2, zero, _CMP_GT_OQ)));
+        __m256 coincident = _mm256_and_ps(_mm256_castsi256_ps(inRange), _mm256_cmp_ps(d2, zero, _CMP_EQ_OQ));
+        if (_mm256_movemask_ps(_mm256_or_ps(neighbor, coincident)) == 0)
+            continue;
+
+        // Empuje fijo de las unidades en la misma posición (ver AccumulateScalar);
+        // se resta como el resto de la separación para no cambiar el signo de los ceros
+        __m256 before = _mm256_castsi256_ps(_mm256_cmpgt_epi32(selfIndex, index));
+        __m256 push = _mm256_blendv_ps(one, minusOne, before);
+        separationX = _mm256_sub_ps(separationX, _mm256_and_ps(coincident, push));
+
+        __m256 d = _mm256_sqrt_ps(d2);
+        __m256 separate = _mm256_and_ps(neighbor, _mm256_cmp_ps(d, separationRadius, _CMP_LT_OQ));
+        __m256 w = _mm256_div_ps(_mm256_sub_ps(separationRadius, d), _mm256_mul_ps(d, separationRadius));
+        separationX = _mm256_sub_ps(separationX, _mm256_and_ps(separate, _mm256_mul_ps(ox, w)));
+        separationY = _mm256_sub_ps(separationY, _mm256_and_ps(separate, _mm256_mul_ps(oy, w)));
+
+        __m256i groups = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&m_Groups[j]));
+        __m256 sameGroup = _mm256_and_ps(neighbor, _mm256_castsi256_ps(_mm256_cmpeq_epi32(groups, group)));
+        offsetX = _mm256_add_ps(offsetX, _mm256_and_ps(sameGroup, ox));
+        offsetY = _mm256_add_ps(offsetY, _mm256_and_ps(sameGroup, oy));
+        velocityX = _mm256_add_ps(velocityX, _mm256_and_ps(sameGroup, _mm256_loadu_ps(&m_VelocityX[j])));
+        velocityY = _mm256_add_ps(velocityY, _mm256_and_ps(sameGroup, _mm256_loadu_ps(&m_VelocityY[j])));
+        count = _mm256_add_ps(count, _mm256_and_ps(sameGroup, one));
+    }
+
+    _mm256_store_ps(&lanes[AccumSeparationX * Lanes], separationX);
+    _mm256_store_ps(&lanes[AccumSeparationY * Lanes], separationY);
+    _mm256_store_ps(&lanes[AccumOffsetX * Lanes], offsetX);
+    _mm256_store_ps(&lanes[AccumOffsetY * Lanes], offsetY);
+    _mm256_store_ps(&lanes[AccumVelocityX * Lanes], velocityX);
+    _mm256_store_ps(&lanes[AccumVelocityY * Lanes], velocityY);
+    _mm256_store_ps(&lanes[AccumCount * Lanes], count);
+}
+
+#else
+
+void CrowdSteering::AccumulateAVX2(uint32_t self, uint32_t begin, uint32_t end, float* lanes) const {
+    AccumulateScalar(self, begin, end, lanes);
+}
+
+#endif
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Destiny {
+
+class JobSystem;
+class SpatialGrid;
+
+struct SteeringParams {
+    float neighborRadius = 3.0f;        // Alcance de cohesión y alineación
+    float separationRadius = 1.0f;      // Distancia mínima deseada entre unidades
+    float avoidanceDistance = 1.5f;     // Margen alrededor de los obstáculos
+
+    float seekWeight = 1.0f;            // Hacia la velocidad preferida (campo de flujo, orden de movimiento)
+    float separationWeight = 2.0f;
+    float cohesionWeight = 0.25f;
+    float alignmentWeight = 0.5f;
+    float obstacleWeight = 3.0f;
+
+    float maxSpeed = 5.0f;
+    float maxForce = 30.0f;             // Aceleración máxima
+};
+
+// Columnas SoA de las unidades; el índice es el id con el que se construyó la rejilla
+struct SteeringInput {
+    const float* positionX;
+    const float* positionY;
+    const float* velocityX;
+    const float* velocityY;
+    const float* preferredX = nullptr;  // Velocidad preferida; nullptr = quedarse quieto
+    const float* preferredY = nullptr;
+    const uint32_t* groups = nullptr;   // Cohesión y alineación sólo dentro del grupo; nullptr = uno solo
+};
+
+// Steering de multitudes: separación, cohesión, alineación, búsqueda de la
+// velocidad preferida y evitación de obstáculos circulares.
+// Los vecinos salen de la SpatialGrid de las unidades: cada unidad recorre los
+// tramos contiguos de las columnas ordenadas de las celdas que alcanza y acumula
+// las fuerzas de 8 candidatos a la vez con AVX2. Las unidades se procesan en el
+// orden de la rejilla, repartiendo entre hilos rangos de celdas.
+//
+// Determinista bit a bit para el lockstep: cada unidad sólo lee el estado del
+// tick anterior, los candidatos se recorren en orden fijo y se acumulan en 8
+// carriles que se suman siempre en el mismo orden. La versión escalar emula los
+// mismos carriles, así que da el mismo resultado con o sin AVX2 y con cualquier
+// número de hilos (el archivo se compila sin contracción a FMA).
+class CrowdSteering {
+public:
+    explicit CrowdSteering(JobSystem* jobSystem = nullptr);
+    ~CrowdSteering() = default;
+
+    // No permitir copia
+    CrowdSteering(const CrowdSteering&) = delete;
+    CrowdSteering& operator=(const CrowdSteering&) = delete;
+
+    void SetParams(const SteeringParams& params) { m_Params = params; }
+    const SteeringParams& GetParams() const { return m_Params; }
+
+    // Obstáculos (edificios, rocas): rejilla construida con sus radios y sus columnas.
+    // nullptr los desactiva. Los datos deben seguir vivos mientras estén puestos.
+    void SetObstacles(const SpatialGrid* grid, const float* positionX, const float* positionY, const float* radius);
+
+    // Calcula las velocidades del siguiente tick. units debe estar construida este
+    // tick con input.positionX/Y; las salidas se indexan por id
+    void Update(const SpatialGrid& units, const SteeringInput& input, uint32_t count, float deltaTime,
+                float* outVelocityX, float* outVelocityY);
+
+    // Forzar la ruta escalar (para verificar que coincide con la vectorizada)
+    void SetForceScalar(bool forceScalar) { m_ForceScalar = forceScalar; }
+
+    // Estadísticas del último Update
+    struct Stats {
+        float updateMs = 0.0f;
+        uint32_t unitCount = 0;
+        uint32_t candidatesVisited = 0;     // Pares probados (incluye los descartados por distancia)
+        bool simd = false;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    // Sumas de los vecinos de una unidad
+    struct NeighborSums {
+        float separationX, separationY;
+        float offsetX, offsetY;             // Suma de (vecino - unidad) del grupo
+        float velocityX, velocityY;         // Suma de velocidades del grupo
+        float count;
+    };
+
+    void SteerRange(const SpatialGrid& units, uint32_t begin, uint32_t end, float deltaTime,
+                    float* outVelocityX, float* outVelocityY, uint32_t& outCandidates) const;
+    void AccumulateScalar(uint32_t self, uint32_t begin, uint32_t end, float* lanes) const;
+    void AccumulateAVX2(uint32_t self, uint32_t begin, uint32_t end, float* lanes) const;
+
+    JobSystem* m_JobSystem;
+    SteeringParams m_Params;
+    bool m_ForceScalar = false;
+    bool m_UseAVX2 = false;
+
+    const SpatialGrid* m_ObstacleGrid = nullptr;
+    const float* m_ObstacleX = nullptr;
+    const float* m_ObstacleY = nullptr;
+    const float* m_ObstacleRadius = nullptr;
+
+    // Estado de las unidades en el orden de la rejilla, con relleno para cargas de 8
+    std::vector<float> m_X, m_Y;
+    std::vector<float> m_VelocityX, m_VelocityY;
+    std::vector<float> m_PreferredX, m_PreferredY;
+    std::vector<uint32_t> m_Groups;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
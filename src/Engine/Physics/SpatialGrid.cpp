@@ -0,0 +1,251 @@
+#include "SpatialGrid.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Destiny {
+
+// Por debajo de esto no compensa repartir el cálculo de celdas entre hilos
+static constexpr uint32_t MinEntitiesPerJob = 4096;
+static constexpr uint32_t MinQueriesPerJob = 64;
+
+SpatialGrid::SpatialGrid(const glm::vec2& worldMin, const glm::vec2& worldMax, float cellSize, JobSystem* jobSystem)
+    : m_WorldMin(worldMin), m_CellSize(cellSize), m_InvCellSize(1.0f / cellSize), m_JobSystem(jobSystem) {
+    m_CellsX = std::max(1u, static_cast<uint32_t>(std::ceil((worldMax.x - worldMin.x) * m_InvCellSize)));
+    m_CellsY = std::max(1u, static_cast<uint32_t>(std::ceil((worldMax.y - worldMin.y) * m_InvCellSize)));
+
+    // Una celda extra como centinela para que m_CellStart[c + 1] siempre exista
+    m_CellStart.assign(GetCellCount() + 1, 0);
+
+    DESTINY_CORE_INFO("Rejilla espacial: {0}x{1} celdas de {2}", m_CellsX, m_CellsY, cellSize);
+}
+
+uint32_t SpatialGrid::GetCellCoord(float value, float origin, uint32_t cells) const {
+    float cell = (value - origin) * m_InvCellSize;
+    if (!(cell > 0.0f))
+        return 0;
+    return std::min(static_cast<uint32_t>(cell), cells - 1);
+}
+
+void SpatialGrid::GetCellRange(float minX, float minY, float maxX, float maxY,
+                               uint32_t& x0, uint32_t& y0, uint32_t& x1, uint32_t& y1) const {
+    x0 = GetCellCoord(minX, m_WorldMin.x, m_CellsX);
+    y0 = GetCellCoord(minY, m_WorldMin.y, m_CellsY);
+    x1 = GetCellCoord(maxX, m_WorldMin.x, m_CellsX);
+    y1 = GetCellCoord(maxY, m_WorldMin.y, m_CellsY);
+}
+
+void SpatialGrid::Build(const float* positionX, const float* positionY, const float* radius, uint32_t count) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    m_EntityCells.resize(count);
+    m_SortedIds.resize(count);
+    m_SortedX.resize(count);
+    m_SortedY.resize(count);
+    m_SortedRadius.resize(count);
+
+    // 1. Celda de cada entidad (independiente por entidad, en paralelo)
+    auto computeCells = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            uint32_t x = GetCellCoord(positionX[i], m_WorldMin.x, m_CellsX);
+            uint32_t y = GetCellCoord(positionY[i], m_WorldMin.y, m_CellsY);
+            m_EntityCells[i] = y * m_CellsX + x;
+        }
+    };
+
+    if (m_JobSystem)
+        m_JobSystem->ParallelFor(count, MinEntitiesPerJob, computeCells);
+    else
+        computeCells(0, count);
+
+    // 2. Conteo por celda y suma prefija: m_CellStart[c] pasa a ser el inicio de la celda c
+    std::fill(m_CellStart.begin(), m_CellStart.end(), 0);
+    for (uint32_t i = 0; i < count; i++)
+        m_CellStart[m_EntityCells[i] + 1]++;
+
+    uint32_t occupied = 0, maxOccupancy = 0;
+    for (uint32_t c = 0; c < GetCellCount(); c++) {
+        uint32_t cellCount = m_CellStart[c + 1];
+        occupied += cellCount != 0;
+        maxOccupancy = std::max(maxOccupancy, cellCount);
+        m_CellStart[c + 1] += m_CellStart[c];
+    }
+
+    // 3. Reparto estable: dentro de cada celda las entidades quedan en orden de id,
+    //    así que los resultados no dependen de los hilos
+    float maxRadius = 0.0f;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t slot = m_CellStart[m_EntityCells[i]]++;
+        m_SortedIds[slot] = i;
+        m_SortedX[slot] = positionX[i];
+        m_SortedY[slot] = positionY[i];
+
+        float r = radius ? radius[i] : 0.0f;
+        m_SortedRadius[slot] = r;
+        maxRadius = std::max(maxRadius, r);
+    }
+
+    // El reparto ha avanzado cada inicio hasta el final de su celda; desplazar para restaurarlo
+    for (uint32_t c = GetCellCount(); c > 0; c--)
+        m_CellStart[c] = m_CellStart[c - 1];
+    m_CellStart[0] = 0;
+
+    m_MaxRadius = maxRadius;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.buildMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.entityCount = count;
+    m_Stats.occupiedCells = occupied;
+    m_Stats.maxCellOccupancy = maxOccupancy;
+    m_Stats.maxRadius = maxRadius;
+}
+
+uint32_t SpatialGrid::QueryRadius(const glm::vec2& center, float radius, uint32_t* outIds, uint32_t maxResults) const {
+    uint32_t found = 0;
+    ForEachInRadius(center, radius, [&](uint32_t id) {
+        if (found < maxResults)
+            outIds[found] = id;
+        found++;
+    });
+    return found;
+}
+
+uint32_t SpatialGrid::QueryAABB(const glm::vec2& min, const glm::vec2& max, uint32_t* outIds, uint32_t maxResults) const {
+    uint32_t x0, y0, x1, y1;
+    GetCellRange(min.x - m_MaxRadius, min.y - m_MaxRadius, max.x + m_MaxRadius, max.y + m_MaxRadius, x0, y0, x1, y1);
+
+    uint32_t found = 0;
+    for (uint32_t y = y0; y <= y1; y++) {
+        uint32_t begin = m_CellStart[y * m_CellsX + x0];
+        uint32_t end = m_CellStart[y * m_CellsX + x1 + 1];
+
+        for (uint32_t i = begin; i < end; i++) {
+            // Distancia del centro al punto más cercano del rectángulo
+            float dx = m_SortedX[i] - std::min(std::max(m_SortedX[i], min.x), max.x);
+            float dy = m_SortedY[i] - std::min(std::max(m_SortedY[i], min.y), max.y);
+            float r = m_SortedRadius[i];
+
+            if (dx * dx + dy * dy <= r * r) {
+                if (found < maxResults)
+                    outIds[found] = m_SortedIds[i];
+                found++;
+            }
+        }
+    }
+
+    return found;
+}
+
+bool SpatialGrid::Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& outHit) const {
+    if (m_SortedIds.empty() || m_MaxRadius <= 0.0f)
+        return false;
+
+    // Una entidad puede sobresalir de su celda hasta m_MaxRadius: en cada celda del
+    // rayo se revisan también las vecinas a esa distancia
+    int spread = static_cast<int>(std::ceil(m_MaxRadius * m_InvCellSize));
+
+    float best = maxDistance;
+    bool hit = false;
+
+    auto testCell = [&](int cx, int cy) {
+        if (cx < 0 || cy < 0 || cx >= static_cast<int>(m_CellsX) || cy >= static_cast<int>(m_CellsY))
+            return;
+
+        uint32_t cell = cy * m_CellsX + cx;
+        for (uint32_t i = m_CellStart[cell]; i < m_CellStart[cell + 1]; i++) {
+            // Rayo contra círculo
+            float mx = origin.x - m_SortedX[i];
+            float my = origin.y - m_SortedY[i];
+            float r = m_SortedRadius[i];
+            float b = mx * direction.x + my * direction.y;
+            float c = mx * mx + my * my - r * r;
+            if (r <= 0.0f || (c > 0.0f && b > 0.0f))
+                continue;
+
+            float discriminant = b * b - c;
+            if (discriminant < 0.0f)
+                continue;
+
+            float t = std::max(0.0f, -b - std::sqrt(discriminant));
+            if (t < best || (t == best && hit && m_SortedIds[i] < outHit.id)) {
+                best = t;
+                outHit.id = m_SortedIds[i];
+                outHit.distance = t;
+                hit = true;
+            }
+        }
+    };
+
+    // Recorrido DDA de las celdas que atraviesa el rayo
+    float startX = (origin.x - m_WorldMin.x) * m_InvCellSize;
+    float startY = (origin.y - m_WorldMin.y) * m_InvCellSize;
+    int cx = static_cast<int>(std::floor(startX));
+    int cy = static_cast<int>(std::floor(startY));
+    int stepX = direction.x > 0.0f ? 1 : -1;
+    int stepY = direction.y > 0.0f ? 1 : -1;
+
+    float deltaX = direction.x != 0.0f ? std::abs(m_CellSize / direction.x) : INFINITY;
+    float deltaY = direction.y != 0.0f ? std::abs(m_CellSize / direction.y) : INFINITY;
+    float nextX = direction.x != 0.0f ? ((stepX > 0 ? (cx + 1) - startX : startX - cx) * deltaX) : INFINITY;
+    float nextY = direction.y != 0.0f ? ((stepY > 0 ? (cy + 1) - startY : startY - cy) * deltaY) : INFINITY;
+
+    // Fuera del mundo se usa la celda de borde más cercana, que es donde Build
+    // guarda las entidades que quedan fuera
+    auto clampX = [this](int x) { return std::min(std::max(x, 0), static_cast<int>(m_CellsX) - 1); };
+    auto clampY = [this](int y) { return std::min(std::max(y, 0), static_cast<int>(m_CellsY) - 1); };
+
+    float cellEnter = 0.0f;
+    int lastX = -1, lastY = -1;
+    while (cellEnter <= best) {
+        int kx = clampX(cx), ky = clampY(cy);
+        if (kx != lastX || ky != lastY) {
+            for (int y = ky - spread; y <= ky + spread; y++) {
+                for (int x = kx - spread; x <= kx + spread; x++)
+                    testCell(x, y);
+            }
+            lastX = kx;
+            lastY = ky;
+        }
+
+        // Si la celda de borde ya no puede cambiar en ningún eje no queda nada por revisar
+        bool fixedX = direction.x == 0.0f || (cx < 0 && stepX < 0) || (cx >= static_cast<int>(m_CellsX) && stepX > 0);
+        bool fixedY = direction.y == 0.0f || (cy < 0 && stepY < 0) || (cy >= static_cast<int>(m_CellsY) && stepY > 0);
+        if (fixedX && fixedY)
+            break;
+
+        // Cualquier impacto más cercano está en una celda con entrada anterior
+        if (nextX < nextY) {
+            cellEnter = nextX;
+            nextX += deltaX;
+            cx += stepX;
+        }
+        else {
+            cellEnter = nextY;
+            nextY += deltaY;
+            cy += stepY;
+        }
+    }
+
+    return hit;
+}
+
+void SpatialGrid::QueryRadiusBatch(const RadiusQuery* queries, uint32_t count, uint32_t maxResultsPerQuery,
+                                   uint32_t* outIds, uint32_t* outCounts) const {
+    // Cada consulta escribe en su propio tramo de salida
+    auto run = [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i = begin; i < end; i++) {
+            outCounts[i] = QueryRadius(queries[i].center, queries[i].radius,
+                                       outIds + static_cast<size_t>(i) * maxResultsPerQuery, maxResultsPerQuery);
+        }
+    };
+
+    if (m_JobSystem)
+        m_JobSystem->ParallelFor(count, MinQueriesPerJob, run);
+    else
+        run(0, count);
+}
+
+} // namespace Destiny
\ No newline at end of file
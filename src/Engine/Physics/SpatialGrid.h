@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class JobSystem;
+
+// Resultado de un rayo contra las entidades de la rejilla
+struct RaycastHit {
+    uint32_t id = 0;
+    float distance = 0.0f;
+};
+
+// Consulta por radio para los lotes
+struct RadiusQuery {
+    glm::vec2 center;
+    float radius;
+};
+
+// Broadphase de rejilla uniforme para consultas de vecinos.
+// Se reconstruye entera cada tick con una ordenación por conteo: las entidades
+// quedan contiguas por celda (ids y posiciones en columnas), así que recorrer una
+// celda es leer memoria seguida. Cada entidad se guarda en la celda de su centro
+// y las consultas amplían su área con el radio máximo. Las consultas no reservan
+// memoria y son seguras desde varios hilos mientras no se llame a Build.
+class SpatialGrid {
+public:
+    // Las posiciones fuera de [worldMin, worldMax] se agrupan en las celdas del borde
+    SpatialGrid(const glm::vec2& worldMin, const glm::vec2& worldMax, float cellSize, JobSystem* jobSystem = nullptr);
+    ~SpatialGrid() = default;
+
+    // No permitir copia
+    SpatialGrid(const SpatialGrid&) = delete;
+    SpatialGrid& operator=(const SpatialGrid&) = delete;
+
+    // Reconstruir con las entidades de este tick; el id de cada una es su índice.
+    // radius puede ser nullptr (entidades puntuales).
+    void Build(const float* positionX, const float* positionY, const float* radius, uint32_t count);
+
+    // Entidades que tocan el círculo / rectángulo. Escriben como mucho maxResults ids
+    // y devuelven el número total encontrado (puede ser mayor que maxResults).
+    uint32_t QueryRadius(const glm::vec2& center, float radius, uint32_t* outIds, uint32_t maxResults) const;
+    uint32_t QueryAABB(const glm::vec2& min, const glm::vec2& max, uint32_t* outIds, uint32_t maxResults) const;
+
+    // Igual que QueryRadius pero llamando a func(id) sin copiar resultados
+    template<typename Func>
+    void ForEachInRadius(const glm::vec2& center, float radius, Func&& func) const;
+
+    // Llama a func(begin, end) con cada tramo de las columnas ordenadas que puede
+    // tocar el círculo (una fila de celdas por tramo, en orden fijo). Para kernels
+    // que recorren los candidatos seguidos sin pasar por los ids
+    template<typename Func>
+    void ForEachCellRange(const glm::vec2& center, float radius, Func&& func) const;
+
+    // Columnas ordenadas por celda del último Build; GetSortedIds()[i] es el id de la fila i
+    const uint32_t* GetSortedIds() const { return m_SortedIds.data(); }
+    const float* GetSortedX() const { return m_SortedX.data(); }
+    const float* GetSortedY() const { return m_SortedY.data(); }
+
+    // Primera entidad que corta el rayo (direction normalizada); las puntuales no se detectan
+    bool Raycast(const glm::vec2& origin, const glm::vec2& direction, float maxDistance, RaycastHit& outHit) const;
+
+    // Lote de consultas en paralelo. Los ids de la consulta i van en
+    // outIds[i * maxResultsPerQuery] y su total en outCounts[i].
+    void QueryRadiusBatch(const RadiusQuery* queries, uint32_t count, uint32_t maxResultsPerQuery,
+                          uint32_t* outIds, uint32_t* outCounts) const;
+
+    // Información
+    uint32_t GetEntityCount() const { return static_cast<uint32_t>(m_SortedIds.size()); }
+    uint32_t GetCellCount() const { return m_CellsX * m_CellsY; }
+    float GetCellSize() const { return m_CellSize; }
+
+    // Estadísticas del último Build
+    struct Stats {
+        float buildMs = 0.0f;
+        uint32_t entityCount = 0;
+        uint32_t occupiedCells = 0;
+        uint32_t maxCellOccupancy = 0;
+        float maxRadius = 0.0f;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    void GetCellRange(float minX, float minY, float maxX, float maxY,
+                      uint32_t& x0, uint32_t& y0, uint32_t& x1, uint32_t& y1) const;
+    uint32_t GetCellCoord(float value, float origin, uint32_t cells) const;
+
+    glm::vec2 m_WorldMin;
+    float m_CellSize;
+    float m_InvCellSize;
+    uint32_t m_CellsX;
+    uint32_t m_CellsY;
+    JobSystem* m_JobSystem;
+
+    // m_CellStart[c] .. m_CellStart[c + 1]: entidades de la celda c en las columnas ordenadas
+    std::vector<uint32_t> m_CellStart;
+    std::vector<uint32_t> m_SortedIds;
+    std::vector<float> m_SortedX;
+    std::vector<float> m_SortedY;
+    std::vector<float> m_SortedRadius;
+
+    // Celda de cada entidad (entrada del conteo)
+    std::vector<uint32_t> m_EntityCells;
+
+    float m_MaxRadius = 0.0f;
+    Stats m_Stats;
+};
+
+template<typename Func>
+void SpatialGrid::ForEachInRadius(const glm::vec2& center, float radius, Func&& func) const {
+    float reach = radius + m_MaxRadius;
+    uint32_t x0, y0, x1, y1;
+    GetCellRange(center.x - reach, center.y - reach, center.x + reach, center.y + reach, x0, y0, x1, y1);
+
+    for (uint32_t y = y0; y <= y1; y++) {
+        // Las celdas de una fila son contiguas en las columnas ordenadas
+        uint32_t begin = m_CellStart[y * m_CellsX + x0];
+        uint32_t end = m_CellStart[y * m_CellsX + x1 + 1];
+
+        for (uint32_t i = begin; i < end; i++) {
+            float dx = m_SortedX[i] - center.x;
+            float dy = m_SortedY[i] - center.y;
+            float range = radius + m_SortedRadius[i];
+            if (dx * dx + dy * dy <= range * range)
+                func(m_SortedIds[i]);
+        }
+    }
+}
+
+template<typename Func>
+void SpatialGrid::ForEachCellRange(const glm::vec2& center, float radius, Func&& func) const {
+    float reach = radius + m_MaxRadius;
+    uint32_t x0, y0, x1, y1;
+    GetCellRange(center.x - reach, center.y - reach, center.x + reach, center.y + reach, x0, y0, x1, y1);
+
+    for (uint32_t y = y0; y <= y1; y++) {
+        uint32_t begin = m_CellStart[y * m_CellsX + x0];
+        uint32_t end = m_CellStart[y * m_CellsX + x1 + 1];
+        if (begin < end)
+            func(begin, end);
+    }
+}
+
+} // namespace Destiny
\ No newline at end of file
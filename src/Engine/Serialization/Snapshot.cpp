@@ -0,0 +1,368 @@
+#include "Snapshot.h"
+#include "SnapshotFormat.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace Destiny {
+
+static uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static float ThroughputMBs(uint64_t bytes, float ms) {
+    return ms > 0.0f ? static_cast<float>(bytes) / (1024.0f * 1024.0f) / (ms / 1000.0f) : 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+// SnapshotWriter
+// ---------------------------------------------------------------------------
+
+SnapshotWriter::SnapshotWriter(uint32_t chunkSize)
+    : m_ChunkSize(static_cast<uint32_t>(AlignUp(std::max(chunkSize, 64u), SnapshotDataAlignment))) {
+}
+
+void SnapshotWriter::AddColumn(const std::string& name, uint32_t schemaVersion, const void* data,
+                               uint32_t elementSize, uint64_t elementCount) {
+    m_Columns.push_back({ HashColumnName(name), schemaVersion, static_cast<const uint8_t*>(data), elementSize, elementCount });
+}
+
+bool SnapshotWriter::Save(const std::string& path, uint64_t tick, bool incremental) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    if (incremental && m_LastSnapshotId == 0) {
+        DESTINY_CORE_WARN("Snapshot incremental sin base, se guarda completo: {0}", path);
+        incremental = false;
+    }
+
+    // 1. Chunks de cada columna y cuáles han cambiado
+    struct ColumnPlan {
+        std::vector<uint64_t> hashes;
+        std::vector<uint32_t> chunks;   // Índices a guardar
+        uint64_t size;
+    };
+
+    std::vector<ColumnPlan> plans(m_Columns.size());
+    uint64_t columnBytes = 0;
+    uint32_t skipped = 0;
+
+    for (size_t i = 0; i < m_Columns.size(); i++) {
+        const Column& column = m_Columns[i];
+        ColumnPlan& plan = plans[i];
+        plan.size = column.elementCount * column.elementSize;
+        columnBytes += plan.size;
+
+        uint32_t chunkCount = static_cast<uint32_t>((plan.size + m_ChunkSize - 1) / m_ChunkSize);
+        plan.hashes.resize(chunkCount);
+
+        auto previous = m_ChunkHashes.find(column.nameHash);
+        for (uint32_t c = 0; c < chunkCount; c++) {
+            uint64_t offset = static_cast<uint64_t>(c) * m_ChunkSize;
+            uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(m_ChunkSize, plan.size - offset));
+            plan.hashes[c] = HashChunk(column.data + offset, size);
+
+            bool unchanged = incremental && previous != m_ChunkHashes.end() &&
+                             c < previous->second.size() && previous->second[c] == plan.hashes[c];
+            if (unchanged)
+                skipped++;
+            else
+                plan.chunks.push_back(c);
+        }
+    }
+
+    // 2. Disposición del archivo
+    SnapshotHeader header = {};
+    std::copy(SnapshotMagic, SnapshotMagic + 4, header.magic);
+    header.version = SnapshotVersion;
+    header.snapshotId = std::max<uint64_t>(m_LastSnapshotId + 1, std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+    header.baseId = incremental ? m_LastSnapshotId : 0;
+    header.tick = tick;
+    header.columnCount = static_cast<uint32_t>(m_Columns.size());
+    header.chunkSize = m_ChunkSize;
+    header.columnTableOffset = sizeof(SnapshotHeader);
+
+    std::vector<SnapshotColumnEntry> entries(m_Columns.size());
+    std::vector<SnapshotChunkEntry> chunkTable;
+
+    uint64_t offset = header.columnTableOffset + entries.size() * sizeof(SnapshotColumnEntry);
+    for (size_t i = 0; i < m_Columns.size(); i++) {
+        entries[i].chunkTableOffset = offset;
+        offset += plans[i].chunks.size() * sizeof(SnapshotChunkEntry);
+    }
+
+    for (size_t i = 0; i < m_Columns.size(); i++) {
+        const Column& column = m_Columns[i];
+        const ColumnPlan& plan = plans[i];
+        SnapshotColumnEntry& entry = entries[i];
+
+        // Los chunks (múltiplos de 64 bytes) van seguidos: si están todos, la columna es contigua
+        offset = AlignUp(offset, SnapshotDataAlignment);
+        entry.nameHash = column.nameHash;
+        entry.schemaVersion = column.schemaVersion;
+        entry.elementSize = column.elementSize;
+        entry.elementCount = column.elementCount;
+        entry.dataOffset = !plan.hashes.empty() && plan.chunks.size() == plan.hashes.size() ? offset : 0;
+        entry.chunkCount = static_cast<uint32_t>(plan.chunks.size());
+
+        for (uint32_t c : plan.chunks) {
+            uint64_t chunkOffset = static_cast<uint64_t>(c) * m_ChunkSize;
+            uint32_t size = static_cast<uint32_t>(std::min<uint64_t>(m_ChunkSize, plan.size - chunkOffset));
+            chunkTable.push_back({ c, size, offset });
+            offset += size;
+        }
+    }
+
+    // 3. Volcado: las columnas se escriben directamente desde la memoria del juego
+    std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+        DESTINY_CORE_ERROR("No se pudo crear el snapshot: {0}", path);
+        return false;
+    }
+
+    static const char padding[SnapshotDataAlignment] = {};
+    uint64_t written = 0;
+    auto pad = [&](uint64_t target) {
+        if (target > written) {
+            out.write(padding, static_cast<std::streamsize>(target - written));
+            written = target;
+        }
+    };
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(SnapshotColumnEntry));
+    out.write(reinterpret_cast<const char*>(chunkTable.data()), chunkTable.size() * sizeof(SnapshotChunkEntry));
+    written = sizeof(header) + entries.size() * sizeof(SnapshotColumnEntry) + chunkTable.size() * sizeof(SnapshotChunkEntry);
+
+    size_t chunkIndex = 0;
+    for (size_t i = 0; i < m_Columns.size(); i++) {
+        const Column& column = m_Columns[i];
+        uint32_t count = entries[i].chunkCount;
+
+        // Tramos de chunks consecutivos en una sola escritura
+        for (uint32_t c = 0; c < count;) {
+            const SnapshotChunkEntry& first = chunkTable[chunkIndex + c];
+            pad(first.offset);
+
+            uint64_t size = first.size;
+            uint32_t run = 1;
+            while (c + run < count && chunkTable[chunkIndex + c + run].index == first.index + run)
+                size += chunkTable[chunkIndex + c + run++].size;
+
+            out.write(reinterpret_cast<const char*>(column.data) + static_cast<uint64_t>(first.index) * m_ChunkSize,
+                      static_cast<std::streamsize>(size));
+            written += size;
+            c += run;
+        }
+        chunkIndex += count;
+    }
+
+    out.close();
+    if (!out) {
+        DESTINY_CORE_ERROR("Error al escribir el snapshot: {0}", path);
+        return false;
+    }
+
+    // 4. El snapshot guardado pasa a ser la base del siguiente incremental
+    for (size_t i = 0; i < m_Columns.size(); i++)
+        m_ChunkHashes[m_Columns[i].nameHash] = std::move(plans[i].hashes);
+    m_LastSnapshotId = header.snapshotId;
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.fileBytes = written;
+    m_Stats.columnBytes = columnBytes;
+    m_Stats.chunksWritten = static_cast<uint32_t>(chunkTable.size());
+    m_Stats.chunksSkipped = skipped;
+    m_Stats.saveMs = std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.throughputMBs = ThroughputMBs(columnBytes, m_Stats.saveMs);
+
+    DESTINY_CORE_INFO("Snapshot guardado: {0} ({1} KB, {2} chunks, {3} sin cambios, {4} MB/s)",
+                      path, written / 1024, m_Stats.chunksWritten, skipped, static_cast<uint32_t>(m_Stats.throughputMBs));
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// SnapshotReader
+// ---------------------------------------------------------------------------
+
+bool SnapshotReader::Open(const std::string& path) {
+    auto start = std::chrono::high_resolution_clock::now();
+    Close();
+
+    if (!m_File.Open(path)) {
+        DESTINY_CORE_ERROR("No se pudo abrir el snapshot: {0}", path);
+        return false;
+    }
+
+    if (!Validate()) {
+        DESTINY_CORE_ERROR("Snapshot inválido: {0}", path);
+        m_File.Close();
+        return false;
+    }
+
+    m_Path = path;
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.fileBytes = m_File.GetSize();
+    m_Stats.openMs = std::chrono::duration<float, std::milli>(end - start).count();
+    return true;
+}
+
+void SnapshotReader::Close() {
+    m_File.Close();
+    m_Path.clear();
+    m_Stats = Stats();
+}
+
+const SnapshotHeader* SnapshotReader::GetHeader() const {
+    return m_File.IsOpen() ? reinterpret_cast<const SnapshotHeader*>(m_File.GetData()) : nullptr;
+}
+
+bool SnapshotReader::Validate() const {
+    const uint8_t* base = m_File.GetData();
+    uint64_t fileSize = m_File.GetSize();
+    if (fileSize < sizeof(SnapshotHeader))
+        return false;
+
+    const SnapshotHeader* header = reinterpret_cast<const SnapshotHeader*>(base);
+    if (std::memcmp(header->magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+        return false;
+    if (header->version != SnapshotVersion) {
+        DESTINY_CORE_ERROR("Versión de snapshot no soportada: {0}", header->version);
+        return false;
+    }
+
+    // Los límites se comprueban restando para que un offset enorme no desborde la suma
+    uint64_t tableSize = static_cast<uint64_t>(header->columnCount) * sizeof(SnapshotColumnEntry);
+    if (header->chunkSize == 0 || header->columnTableOffset % alignof(SnapshotColumnEntry) != 0 ||
+        header->columnTableOffset > fileSize || tableSize > fileSize - header->columnTableOffset)
+        return false;
+
+    // Validar una sola vez para que las lecturas no tengan que comprobar límites
+    const SnapshotColumnEntry* columns = reinterpret_cast<const SnapshotColumnEntry*>(base + header->columnTableOffset);
+    for (uint32_t i = 0; i < header->columnCount; i++) {
+        const SnapshotColumnEntry& column = columns[i];
+        uint64_t columnSize = column.elementCount * column.elementSize;
+        if (column.elementSize != 0 && columnSize / column.elementSize != column.elementCount)
+            return false;
+
+        if (column.dataOffset != 0 && (column.dataOffset % SnapshotDataAlignment != 0 ||
+                                      column.dataOffset > fileSize || columnSize > fileSize - column.dataOffset))
+            return false;
+
+        uint64_t chunkTableSize = static_cast<uint64_t>(column.chunkCount) * sizeof(SnapshotChunkEntry);
+        if (column.chunkTableOffset % alignof(SnapshotChunkEntry) != 0 || column.chunkTableOffset > fileSize ||
+            chunkTableSize > fileSize - column.chunkTableOffset)
+            return false;
+
+        const SnapshotChunkEntry* chunks = reinterpret_cast<const SnapshotChunkEntry*>(base + column.chunkTableOffset);
+        for (uint32_t c = 0; c < column.chunkCount; c++) {
+            if (chunks[c].offset > fileSize || chunks[c].size > fileSize - chunks[c].offset)
+                return false;
+            if (static_cast<uint64_t>(chunks[c].index) * header->chunkSize + chunks[c].size > columnSize)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool SnapshotReader::IsIncremental() const {
+    const SnapshotHeader* header = GetHeader();
+    return header && header->baseId != 0;
+}
+
+uint64_t SnapshotReader::GetSnapshotId() const {
+    const SnapshotHeader* header = GetHeader();
+    return header ? header->snapshotId : 0;
+}
+
+uint64_t SnapshotReader::GetBaseId() const {
+    const SnapshotHeader* header = GetHeader();
+    return header ? header->baseId : 0;
+}
+
+uint64_t SnapshotReader::GetTick() const {
+    const SnapshotHeader* header = GetHeader();
+    return header ? header->tick : 0;
+}
+
+const SnapshotColumnEntry* SnapshotReader::FindColumn(const std::string& name) const {
+    const SnapshotHeader* header = GetHeader();
+    if (!header)
+        return nullptr;
+
+    // Pocas columnas: búsqueda lineal por hash
+    uint64_t hash = HashColumnName(name);
+    const SnapshotColumnEntry* columns = reinterpret_cast<const SnapshotColumnEntry*>(m_File.GetData() + header->columnTableOffset);
+    for (uint32_t i = 0; i < header->columnCount; i++) {
+        if (columns[i].nameHash == hash)
+            return &columns[i];
+    }
+    return nullptr;
+}
+
+uint64_t SnapshotReader::GetColumnCount(const std::string& name) const {
+    const SnapshotColumnEntry* column = FindColumn(name);
+    return column ? column->elementCount : 0;
+}
+
+uint32_t SnapshotReader::GetColumnVersion(const std::string& name) const {
+    const SnapshotColumnEntry* column = FindColumn(name);
+    return column ? column->schemaVersion : 0;
+}
+
+const void* SnapshotReader::GetColumnData(const std::string& name, uint32_t schemaVersion, uint32_t elementSize) const {
+    const SnapshotColumnEntry* column = FindColumn(name);
+    if (!column || column->dataOffset == 0 || IsIncremental())
+        return nullptr;
+    if (column->schemaVersion != schemaVersion || column->elementSize != elementSize)
+        return nullptr;
+
+    return m_File.GetData() + column->dataOffset;
+}
+
+bool SnapshotReader::ReadColumn(const std::string& name, uint32_t schemaVersion, void* dst, uint32_t elementSize, uint64_t capacity) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    const SnapshotColumnEntry* column = FindColumn(name);
+    if (!column) {
+        DESTINY_CORE_WARN("Columna '{0}' no encontrada en el snapshot {1}", name, m_Path);
+        return false;
+    }
+    if (column->schemaVersion != schemaVersion || column->elementSize != elementSize) {
+        DESTINY_CORE_ERROR("Columna '{0}': versión {1} ({2} bytes), se esperaba {3} ({4} bytes)",
+                           name, column->schemaVersion, column->elementSize, schemaVersion, elementSize);
+        return false;
+    }
+    if (column->elementCount > capacity) {
+        DESTINY_CORE_ERROR("Columna '{0}': {1} elementos no caben en {2}", name, column->elementCount, capacity);
+        return false;
+    }
+
+    const uint8_t* base = m_File.GetData();
+    uint8_t* out = static_cast<uint8_t*>(dst);
+    uint64_t copied = 0;
+
+    if (column->dataOffset != 0) {
+        copied = column->elementCount * elementSize;
+        std::memcpy(out, base + column->dataOffset, copied);
+    }
+    else {
+        const SnapshotHeader* header = GetHeader();
+        const SnapshotChunkEntry* chunks = reinterpret_cast<const SnapshotChunkEntry*>(base + column->chunkTableOffset);
+        for (uint32_t c = 0; c < column->chunkCount; c++) {
+            std::memcpy(out + static_cast<uint64_t>(chunks[c].index) * header->chunkSize, base + chunks[c].offset, chunks[c].size);
+            copied += chunks[c].size;
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.bytesRead += copied;
+    m_Stats.readMs += std::chrono::duration<float, std::milli>(end - start).count();
+    m_Stats.throughputMBs = ThroughputMBs(m_Stats.bytesRead, m_Stats.openMs + m_Stats.readMs);
+    return true;
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../Assets/MappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Destiny {
+
+struct SnapshotHeader;
+struct SnapshotColumnEntry;
+
+// Escritura de snapshots. El juego registra sus columnas (un array contiguo por
+// componente) y Save las vuelca tal cual, sin serializar campo a campo.
+// Un Save incremental sólo escribe los chunks que cambiaron desde el anterior
+// Save de este mismo writer.
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(uint32_t chunkSize = 64 * 1024);
+
+    // Los datos deben seguir siendo válidos hasta Save
+    void AddColumn(const std::string& name, uint32_t schemaVersion, const void* data,
+                   uint32_t elementSize, uint64_t elementCount);
+    void ClearColumns() { m_Columns.clear(); }
+
+    bool Save(const std::string& path, uint64_t tick, bool incremental);
+
+    // Id del último snapshot guardado (base del siguiente incremental)
+    uint64_t GetLastSnapshotId() const { return m_LastSnapshotId; }
+
+    // Estadísticas del último Save
+    struct Stats {
+        uint64_t fileBytes = 0;
+        uint64_t columnBytes = 0;     // Tamaño total del estado
+        uint32_t chunksWritten = 0;
+        uint32_t chunksSkipped = 0;   // Sin cambios (incremental)
+        float saveMs = 0.0f;
+        float throughputMBs = 0.0f;   // Estado total / tiempo
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct Column {
+        uint64_t nameHash;
+        uint32_t schemaVersion;
+        const uint8_t* data;
+        uint32_t elementSize;
+        uint64_t elementCount;
+    };
+
+    uint32_t m_ChunkSize;
+    std::vector<Column> m_Columns;
+
+    // Hash de cada chunk en el último snapshot guardado, por columna
+    std::unordered_map<uint64_t, std::vector<uint64_t>> m_ChunkHashes;
+    uint64_t m_LastSnapshotId = 0;
+
+    Stats m_Stats;
+};
+
+// Lectura de snapshots proyectados en memoria. En un snapshot completo las
+// columnas se pueden usar sin copiar (GetColumnData, alineadas a 64 bytes);
+// ReadColumn copia a la memoria del juego o, si es incremental, aplica sólo
+// los chunks guardados sobre el estado de su base.
+class SnapshotReader {
+public:
+    SnapshotReader() = default;
+
+    // No permitir copia
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return m_File.IsOpen(); }
+
+    bool IsIncremental() const;
+    uint64_t GetSnapshotId() const;
+    uint64_t GetBaseId() const;
+    uint64_t GetTick() const;
+
+    // Información de columnas; 0 si no existe
+    uint64_t GetColumnCount(const std::string& name) const;
+    uint32_t GetColumnVersion(const std::string& name) const;
+
+    // Vista directa (sólo snapshots completos); nullptr si no existe o no coincide
+    const void* GetColumnData(const std::string& name, uint32_t schemaVersion, uint32_t elementSize) const;
+
+    // Copiar la columna a dst, que debe tener sitio para GetColumnCount elementos
+    bool ReadColumn(const std::string& name, uint32_t schemaVersion, void* dst, uint32_t elementSize, uint64_t capacity);
+
+    // Estadísticas acumuladas desde Open
+    struct Stats {
+        uint64_t fileBytes = 0;
+        uint64_t bytesRead = 0;       // Copiados por ReadColumn
+        float openMs = 0.0f;
+        float readMs = 0.0f;
+        float throughputMBs = 0.0f;   // bytesRead / (openMs + readMs)
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    bool Validate() const;
+    const SnapshotColumnEntry* FindColumn(const std::string& name) const;
+    const SnapshotHeader* GetHeader() const;
+
+    MappedFile m_File;
+    std::string m_Path;
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
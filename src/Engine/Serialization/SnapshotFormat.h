@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace Destiny {
+
+// Formato binario de los snapshots del estado de la simulación (.snap).
+//
+//   SnapshotHeader
+//   SnapshotColumnEntry[columnCount]
+//   SnapshotChunkEntry[]          tabla de chunks de cada columna
+//   bloques de datos              cada uno alineado a SnapshotDataAlignment
+//
+// Cada columna (un componente en SoA) se guarda troceada en chunks de chunkSize
+// bytes. En un snapshot completo están todos y son contiguos, así que la columna
+// se puede usar directamente desde la proyección en memoria. Un snapshot
+// incremental sólo contiene los chunks que cambiaron desde su base (baseId).
+//
+// Todos los enteros están en little-endian y las estructuras no tienen relleno.
+
+static constexpr char SnapshotMagic[4] = { 'D', 'S', 'N', 'P' };
+static constexpr uint32_t SnapshotVersion = 1;
+static constexpr uint64_t SnapshotDataAlignment = 64;
+
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint64_t snapshotId;
+    uint64_t baseId;            // 0 = snapshot completo
+    uint64_t tick;
+    uint32_t columnCount;
+    uint32_t chunkSize;
+    uint64_t columnTableOffset;
+};
+
+struct SnapshotColumnEntry {
+    uint64_t nameHash;
+    uint32_t schemaVersion;     // Versión del layout del componente
+    uint32_t elementSize;
+    uint64_t elementCount;
+    uint64_t dataOffset;        // Bloque contiguo si están todos los chunks; 0 si no
+    uint64_t chunkTableOffset;
+    uint32_t chunkCount;        // Chunks guardados en este archivo
+    uint32_t reserved;
+};
+
+struct SnapshotChunkEntry {
+    uint32_t index;             // Posición del chunk dentro de la columna
+    uint32_t size;
+    uint64_t offset;            // Desde el inicio del archivo
+};
+
+static_assert(sizeof(SnapshotHeader) == 48, "SnapshotHeader debe ocupar 48 bytes");
+static_assert(sizeof(SnapshotColumnEntry) == 48, "SnapshotColumnEntry debe ocupar 48 bytes");
+static_assert(sizeof(SnapshotChunkEntry) == 16, "SnapshotChunkEntry debe ocupar 16 bytes");
+
+// FNV-1a de 64 bits del nombre de la columna
+inline uint64_t HashColumnName(const std::string& name) {
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Hash rápido de un chunk para detectar cambios (8 bytes por paso)
+inline uint64_t HashChunk(const uint8_t* data, size_t size) {
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; i++)
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    return hash;
+}
+
+} // namespace Destiny
\ No newline at end of file
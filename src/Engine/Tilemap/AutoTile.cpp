@@ -0,0 +1,260 @@
+#include "AutoTile.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+    #define DESTINY_SIMD_X86 1
+    #include <immintrin.h>
+#endif
+
+namespace Destiny {
+
+namespace {
+
+constexpr uint8_t BorderTerrain = 255;
+constexpr uint32_t MinRowsPerJob = 16;
+
+// Una esquina sólo cuenta si los dos lados que la forman también conectan
+uint8_t ReduceBlobMask(uint8_t mask) {
+    auto keepCorner = [&mask](uint8_t corner, uint8_t sideA, uint8_t sideB) {
+        if ((mask & sideA) == 0 || (mask & sideB) == 0)
+            mask &= static_cast<uint8_t>(~corner);
+    };
+    keepCorner(AutoTileNorthEast, AutoTileNorth, AutoTileEast);
+    keepCorner(AutoTileSouthEast, AutoTileSouth, AutoTileEast);
+    keepCorner(AutoTileSouthWest, AutoTileSouth, AutoTileWest);
+    keepCorner(AutoTileNorthWest, AutoTileNorth, AutoTileWest);
+    return mask;
+}
+
+// Variantes numeradas por orden creciente de máscara reducida
+struct BlobTables {
+    std::array<uint8_t, 256> variant{};
+    std::array<uint8_t, AutoTile::BlobVariantCount> mask{};
+
+    BlobTables() {
+        std::array<uint8_t, 256> compact{};
+        uint32_t count = 0;
+        for (uint32_t m = 0; m < 256; m++) {
+            if (ReduceBlobMask(static_cast<uint8_t>(m)) != m)
+                continue;
+            mask[count] = static_cast<uint8_t>(m);
+            compact[m] = static_cast<uint8_t>(count++);
+        }
+
+        for (uint32_t m = 0; m < 256; m++)
+            variant[m] = compact[ReduceBlobMask(static_cast<uint8_t>(m))];
+    }
+};
+
+const BlobTables& GetBlobTables() {
+    static const BlobTables tables;
+    return tables;
+}
+
+uint8_t EdgeVariant(uint8_t mask) {
+    return ((mask & AutoTileNorth) ? 1 : 0) | ((mask & AutoTileEast) ? 2 : 0) |
+           ((mask & AutoTileSouth) ? 4 : 0) | ((mask & AutoTileWest) ? 8 : 0);
+}
+
+} // namespace
+
+AutoTile::AutoTile(uint32_t width, uint32_t height, AutoTileMode mode, uint32_t chunkSize, JobSystem* jobSystem)
+    : m_Width(width), m_Height(height), m_Stride(width + 2), m_Mode(mode),
+      m_ChunkSize(std::max(chunkSize, 1u)), m_JobSystem(jobSystem) {
+    m_ChunksX = (width + m_ChunkSize - 1) / m_ChunkSize;
+    m_ChunksY = (height + m_ChunkSize - 1) / m_ChunkSize;
+
+    // Terreno 0 en todo el mapa: todas las celdas conectadas
+    m_Terrain.assign(static_cast<size_t>(m_Stride) * (height + 2), BorderTerrain);
+    for (uint32_t y = 0; y < height; y++)
+        std::memset(&m_Terrain[Padded(0, y)], 0, width);
+
+    m_Variants.assign(static_cast<size_t>(width) * height, 0);
+    m_ChunkDirty.assign(static_cast<size_t>(m_ChunksX) * m_ChunksY, 0);
+    ResolveRows(0, height);
+}
+
+void AutoTile::SetTerrain(uint32_t x, uint32_t y, uint8_t terrain) {
+    if (x >= m_Width || y >= m_Height)
+        return;
+
+    if (terrain > MaxTerrain) {
+        DESTINY_CORE_WARN("Terreno inválido para el autotile: {0}", static_cast<uint32_t>(terrain));
+        return;
+    }
+
+    uint8_t& cell = m_Terrain[Padded(x, y)];
+    if (cell == terrain)
+        return;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    cell = terrain;
+    MarkChunkDirty(x, y);
+
+    // Sólo el 3x3: ninguna otra celda tiene a ésta como vecina
+    m_Stats = {};
+    uint32_t x0 = x > 0 ? x - 1 : 0, x1 = std::min(x + 1, m_Width - 1);
+    uint32_t y0 = y > 0 ? y - 1 : 0, y1 = std::min(y + 1, m_Height - 1);
+    for (uint32_t cy = y0; cy <= y1; cy++) {
+        for (uint32_t cx = x0; cx <= x1; cx++) {
+            uint8_t variant = ResolveCell(cx, cy);
+            uint8_t& current = m_Variants[static_cast<size_t>(cy) * m_Width + cx];
+            m_Stats.cellsResolved++;
+            if (variant == current)
+                continue;
+
+            current = variant;
+            m_Stats.variantsChanged++;
+            MarkChunkDirty(cx, cy);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.resolveMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void AutoTile::SetTerrain(const uint8_t* terrain) {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint32_t y = 0; y < m_Height; y++) {
+        uint8_t* row = &m_Terrain[Padded(0, y)];
+        std::memcpy(row, terrain + static_cast<size_t>(y) * m_Width, m_Width);
+        std::replace(row, row + m_Width, BorderTerrain, MaxTerrain);
+    }
+
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(m_Height, MinRowsPerJob, [this](uint32_t begin, uint32_t end) {
+            ResolveRows(begin, end);
+        });
+    }
+    else {
+        ResolveRows(0, m_Height);
+    }
+
+    for (uint32_t chunk = 0; chunk < m_ChunkDirty.size(); chunk++) {
+        if (!m_ChunkDirty[chunk]) {
+            m_ChunkDirty[chunk] = 1;
+            m_DirtyChunks.push_back(chunk);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.cellsResolved = m_Width * m_Height;
+    m_Stats.variantsChanged = m_Width * m_Height;
+    m_Stats.resolveMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+uint8_t AutoTile::ResolveCell(uint32_t x, uint32_t y) const {
+    const uint8_t* center = &m_Terrain[Padded(x, y)];
+    const uint8_t* north = center + m_Stride;
+    const uint8_t* south = center - m_Stride;
+    uint8_t terrain = *center;
+
+    auto connects = [terrain](uint8_t neighbor) {
+        return neighbor == terrain || neighbor == BorderTerrain;
+    };
+
+    uint8_t mask = (connects(north[0]) ? AutoTileNorth : 0) |
+                   (connects(north[1]) ? AutoTileNorthEast : 0) |
+                   (connects(center[1]) ? AutoTileEast : 0) |
+                   (connects(south[1]) ? AutoTileSouthEast : 0) |
+                   (connects(south[0]) ? AutoTileSouth : 0) |
+                   (connects(south[-1]) ? AutoTileSouthWest : 0) |
+                   (connects(center[-1]) ? AutoTileWest : 0) |
+                   (connects(north[-1]) ? AutoTileNorthWest : 0);
+
+    return m_Mode == AutoTileMode::Edge4 ? EdgeVariant(mask) : GetBlobTables().variant[mask];
+}
+
+void AutoTile::ResolveRows(uint32_t firstRow, uint32_t lastRow) {
+    const BlobTables& tables = GetBlobTables();
+
+    for (uint32_t y = firstRow; y < lastRow; y++) {
+        const uint8_t* row = &m_Terrain[Padded(0, y)];
+        const uint8_t* north = row + m_Stride;
+        const uint8_t* south = row - m_Stride;
+        uint8_t* out = &m_Variants[static_cast<size_t>(y) * m_Width];
+        uint32_t x = 0;
+
+#ifdef DESTINY_SIMD_X86
+        // 16 celdas a la vez: cada comparación da 0xff por vecino conectado y
+        // cada bit de la máscara se queda con su constante
+        const __m128i border = _mm_set1_epi8(static_cast<char>(BorderTerrain));
+        auto bit = [](uint8_t value) { return _mm_set1_epi8(static_cast<char>(value)); };
+
+        for (; x + 16 <= m_Width; x += 16) {
+            __m128i center = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + x));
+            auto connects = [&](const uint8_t* neighbors) {
+                __m128i n = _mm_loadu_si128(reinterpret_cast<const __m128i*>(neighbors));
+                return _mm_or_si128(_mm_cmpeq_epi8(n, center), _mm_cmpeq_epi8(n, border));
+            };
+
+            __m128i n = connects(north + x);
+            __m128i e = connects(row + x + 1);
+            __m128i s = connects(south + x);
+            __m128i w = connects(row + x - 1);
+
+            if (m_Mode == AutoTileMode::Edge4) {
+                __m128i variant = _mm_or_si128(_mm_or_si128(_mm_and_si128(n, bit(1)), _mm_and_si128(e, bit(2))),
+                                               _mm_or_si128(_mm_and_si128(s, bit(4)), _mm_and_si128(w, bit(8))));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x), variant);
+                continue;
+            }
+
+            // Esquinas ya reducidas: la tabla recibe directamente la máscara del blob
+            __m128i ne = _mm_and_si128(connects(north + x + 1), _mm_and_si128(n, e));
+            __m128i se = _mm_and_si128(connects(south + x + 1), _mm_and_si128(s, e));
+            __m128i sw = _mm_and_si128(connects(south + x - 1), _mm_and_si128(s, w));
+            __m128i nw = _mm_and_si128(connects(north + x - 1), _mm_and_si128(n, w));
+
+            __m128i mask = _mm_or_si128(
+                _mm_or_si128(_mm_or_si128(_mm_and_si128(n, bit(AutoTileNorth)), _mm_and_si128(ne, bit(AutoTileNorthEast))),
+                             _mm_or_si128(_mm_and_si128(e, bit(AutoTileEast)), _mm_and_si128(se, bit(AutoTileSouthEast)))),
+                _mm_or_si128(_mm_or_si128(_mm_and_si128(s, bit(AutoTileSouth)), _mm_and_si128(sw, bit(AutoTileSouthWest))),
+                             _mm_or_si128(_mm_and_si128(w, bit(AutoTileWest)), _mm_and_si128(nw, bit(AutoTileNorthWest)))));
+
+            alignas(16) uint8_t masks[16];
+            _mm_store_si128(reinterpret_cast<__m128i*>(masks), mask);
+            for (uint32_t k = 0; k < 16; k++)
+                out[x + k] = tables.variant[masks[k]];
+        }
+#else
+        (void)tables;
+#endif
+
+        for (; x < m_Width; x++)
+            out[x] = ResolveCell(x, y);
+    }
+}
+
+void AutoTile::MarkChunkDirty(uint32_t x, uint32_t y) {
+    uint32_t chunk = (y / m_ChunkSize) * m_ChunksX + x / m_ChunkSize;
+    if (m_ChunkDirty[chunk])
+        return;
+
+    m_ChunkDirty[chunk] = 1;
+    m_DirtyChunks.push_back(chunk);
+}
+
+void AutoTile::ConsumeDirtyChunks(std::vector<uint32_t>& outChunks) {
+    outChunks.clear();
+    outChunks.swap(m_DirtyChunks);
+    for (uint32_t chunk : outChunks)
+        m_ChunkDirty[chunk] = 0;
+}
+
+uint8_t AutoTile::GetBlobVariant(uint8_t mask) {
+    return GetBlobTables().variant[mask];
+}
+
+uint8_t AutoTile::GetBlobMask(uint8_t variant) {
+    return variant < BlobVariantCount ? GetBlobTables().mask[variant] : 0;
+}
+
+} // namespace Destiny
\ No newline at end of file
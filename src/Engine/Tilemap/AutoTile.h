@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Destiny {
+
+class JobSystem;
+
+enum class AutoTileMode {
+    Edge4 = 0,     // 4 vecinos ortogonales: 16 variantes
+    Blob47         // 8 vecinos con esquinas sólo si tocan ambos lados: 47 variantes
+};
+
+// Bits de la máscara de vecinos (la fila 0 es la de abajo; norte = y + 1)
+enum AutoTileNeighbor : uint8_t {
+    AutoTileNorth = 1 << 0,
+    AutoTileNorthEast = 1 << 1,
+    AutoTileEast = 1 << 2,
+    AutoTileSouthEast = 1 << 3,
+    AutoTileSouth = 1 << 4,
+    AutoTileSouthWest = 1 << 5,
+    AutoTileWest = 1 << 6,
+    AutoTileNorthWest = 1 << 7
+};
+
+// Autotiling por máscaras de vecinos con tablas precalculadas. Cada celda guarda
+// un tipo de terreno y conecta con los vecinos del mismo tipo (fuera del mapa
+// cuenta como conectado, para que los bordes no se corten). La variante de cada
+// celda sale de la máscara por una tabla: directa en Edge4 y por la tabla de 256
+// entradas del blob de 47 en Blob47.
+//
+// Pintar o destruir una celda sólo vuelve a resolver su vecindario 3x3 y marca
+// como sucios los chunks cuyas variantes cambiaron, para que el tilemap sólo
+// reconstruya esos. SetTerrain con el mapa entero resuelve fila a fila con SSE2
+// (16 celdas por iteración) y reparte las filas entre hilos.
+class AutoTile {
+public:
+    static constexpr uint8_t MaxTerrain = 254;        // 255 se reserva para el borde
+    static constexpr uint32_t BlobVariantCount = 47;
+
+    AutoTile(uint32_t width, uint32_t height, AutoTileMode mode = AutoTileMode::Blob47,
+             uint32_t chunkSize = 16, JobSystem* jobSystem = nullptr);
+    ~AutoTile() = default;
+
+    // No permitir copia
+    AutoTile(const AutoTile&) = delete;
+    AutoTile& operator=(const AutoTile&) = delete;
+
+    // Pintar o destruir una celda: re-resuelve sólo el 3x3 que la rodea
+    void SetTerrain(uint32_t x, uint32_t y, uint8_t terrain);
+
+    // Carga del mapa entero (width * height, fila 0 abajo; 255 se lee como MaxTerrain).
+    // Marca todos los chunks
+    void SetTerrain(const uint8_t* terrain);
+
+    uint8_t GetTerrain(uint32_t x, uint32_t y) const { return m_Terrain[Padded(x, y)]; }
+
+    // Índice de variante (0-15 en Edge4, 0-46 en Blob47) para el atlas del tileset
+    uint8_t GetVariant(uint32_t x, uint32_t y) const { return m_Variants[static_cast<size_t>(y) * m_Width + x]; }
+    const uint8_t* GetVariants() const { return m_Variants.data(); }
+
+    // Chunks con variantes nuevas desde la última llamada (índice = cy * chunksX + cx)
+    void ConsumeDirtyChunks(std::vector<uint32_t>& outChunks);
+    uint32_t GetChunkSize() const { return m_ChunkSize; }
+    uint32_t GetChunksX() const { return m_ChunksX; }
+    uint32_t GetChunksY() const { return m_ChunksY; }
+
+    // Tablas del blob de 47: máscara de 8 bits -> variante y variante -> máscara reducida
+    static uint8_t GetBlobVariant(uint8_t mask);
+    static uint8_t GetBlobMask(uint8_t variant);
+
+    // Información
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+    AutoTileMode GetMode() const { return m_Mode; }
+
+    // Estadísticas de la última operación
+    struct Stats {
+        uint32_t cellsResolved = 0;
+        uint32_t variantsChanged = 0;
+        float resolveMs = 0.0f;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    // El terreno lleva un borde de una celda con el valor comodín
+    size_t Padded(uint32_t x, uint32_t y) const { return static_cast<size_t>(y + 1) * m_Stride + x + 1; }
+
+    uint8_t ResolveCell(uint32_t x, uint32_t y) const;
+    void ResolveRows(uint32_t firstRow, uint32_t lastRow);
+    void MarkChunkDirty(uint32_t x, uint32_t y);
+
+    uint32_t m_Width;
+    uint32_t m_Height;
+    uint32_t m_Stride;
+    AutoTileMode m_Mode;
+    uint32_t m_ChunkSize;
+    uint32_t m_ChunksX;
+    uint32_t m_ChunksY;
+    JobSystem* m_JobSystem;
+
+    std::vector<uint8_t> m_Terrain;      // (width + 2) * (height + 2)
+    std::vector<uint8_t> m_Variants;     // width * height
+
+    std::vector<uint8_t> m_ChunkDirty;
+    std::vector<uint32_t> m_DirtyChunks;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
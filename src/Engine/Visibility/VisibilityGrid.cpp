@@ -0,0 +1,244 @@
+#include "VisibilityGrid.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace Destiny {
+
+VisibilityGrid::VisibilityGrid(uint32_t width, uint32_t height, float cellSize, const glm::vec2& origin,
+                               uint32_t playerCount, JobSystem* jobSystem)
+    : m_Width(width), m_Height(height), m_CellSize(cellSize), m_Origin(origin),
+      m_WordsPerRow((width + 63) / 64), m_JobSystem(jobSystem) {
+    if (playerCount > MaxPlayers) {
+        DESTINY_CORE_WARN("Demasiados jugadores para la visibilidad ({0}), se usan {1}", playerCount, MaxPlayers);
+        playerCount = MaxPlayers;
+    }
+
+    // Máscaras circulares de todos los radios; el +0.5 redondea el borde
+    m_StampRows.resize(MaxSightCells + 1);
+    for (uint32_t r = 0; r <= MaxSightCells; r++) {
+        float radius = r + 0.5f;
+        m_StampRows[r].resize(2 * r + 1);
+        for (int32_t dy = -static_cast<int32_t>(r); dy <= static_cast<int32_t>(r); dy++)
+            m_StampRows[r][dy + r] = static_cast<int32_t>(std::sqrt(radius * radius - static_cast<float>(dy * dy)));
+    }
+
+    size_t cells = static_cast<size_t>(width) * height;
+    size_t words = static_cast<size_t>(m_WordsPerRow) * height;
+    m_Players.resize(playerCount);
+    for (PlayerState& state : m_Players) {
+        state.viewerCount.assign(cells, 0);
+        state.visible.assign(words, 0);
+        state.explored.assign(words, 0);
+    }
+}
+
+uint32_t VisibilityGrid::AddViewer(uint32_t player, const glm::vec2& position, float sightRadius) {
+    if (player >= m_Players.size()) {
+        DESTINY_CORE_WARN("Jugador inválido para la visibilidad: {0}", player);
+        return InvalidViewer;
+    }
+
+    uint32_t viewer;
+    if (!m_FreeViewers.empty()) {
+        viewer = m_FreeViewers.back();
+        m_FreeViewers.pop_back();
+    }
+    else {
+        viewer = static_cast<uint32_t>(m_Viewers.size());
+        m_Viewers.emplace_back();
+    }
+
+    Viewer& v = m_Viewers[viewer];
+    v = Viewer();
+    v.player = player;
+    v.pendingCell = WorldToCell(position);
+    v.pendingRadius = RadiusToCells(sightRadius);
+    v.alive = true;
+    QueueViewer(viewer);
+    return viewer;
+}
+
+void VisibilityGrid::MoveViewer(uint32_t viewer, const glm::vec2& position) {
+    Viewer& v = m_Viewers[viewer];
+    glm::ivec2 cell = WorldToCell(position);
+    if (cell == v.pendingCell)
+        return;
+
+    v.pendingCell = cell;
+    QueueViewer(viewer);
+}
+
+void VisibilityGrid::SetViewerRadius(uint32_t viewer, float sightRadius) {
+    Viewer& v = m_Viewers[viewer];
+    uint32_t radius = RadiusToCells(sightRadius);
+    if (radius == v.pendingRadius)
+        return;
+
+    v.pendingRadius = radius;
+    QueueViewer(viewer);
+}
+
+void VisibilityGrid::RemoveViewer(uint32_t viewer) {
+    if (viewer >= m_Viewers.size() || !m_Viewers[viewer].alive)
+        return;
+
+    // El hueco se libera en Update, después de quitar su estampa
+    m_Viewers[viewer].alive = false;
+    QueueViewer(viewer);
+}
+
+void VisibilityGrid::QueueViewer(uint32_t viewer) {
+    Viewer& v = m_Viewers[viewer];
+    if (v.queued)
+        return;
+
+    v.queued = true;
+    m_Players[v.player].queuedViewers.push_back(viewer);
+}
+
+void VisibilityGrid::Update() {
+    auto start = std::chrono::high_resolution_clock::now();
+
+    m_Stats.viewersUpdated = 0;
+    for (const PlayerState& state : m_Players)
+        m_Stats.viewersUpdated += static_cast<uint32_t>(state.queuedViewers.size());
+
+    uint32_t playerCount = GetPlayerCount();
+    if (m_JobSystem) {
+        m_JobSystem->ParallelFor(playerCount, 1, [this](uint32_t begin, uint32_t end) {
+            for (uint32_t player = begin; player < end; player++)
+                UpdatePlayer(player);
+        });
+    }
+    else {
+        for (uint32_t player = 0; player < playerCount; player++)
+            UpdatePlayer(player);
+    }
+
+    // Liberar los observadores eliminados
+    m_Stats.cellsTouched = 0;
+    for (PlayerState& state : m_Players) {
+        for (uint32_t viewer : state.queuedViewers) {
+            if (!m_Viewers[viewer].alive)
+                m_FreeViewers.push_back(viewer);
+        }
+        state.queuedViewers.clear();
+        m_Stats.cellsTouched += state.cellsTouched;
+    }
+    m_Stats.viewerCount = static_cast<uint32_t>(m_Viewers.size() - m_FreeViewers.size());
+
+    auto end = std::chrono::high_resolution_clock::now();
+    m_Stats.updateMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void VisibilityGrid::UpdatePlayer(uint32_t player) {
+    PlayerState& state = m_Players[player];
+    state.cellsTouched = 0;
+
+    for (uint32_t index : state.queuedViewers) {
+        Viewer& viewer = m_Viewers[index];
+        viewer.queued = false;
+
+        if (viewer.stamped)
+            state.cellsTouched += ApplyStamp(state, viewer.cell, viewer.radius, -1);
+
+        viewer.stamped = viewer.alive;
+        if (!viewer.alive)
+            continue;
+
+        viewer.cell = viewer.pendingCell;
+        viewer.radius = viewer.pendingRadius;
+        state.cellsTouched += ApplyStamp(state, viewer.cell, viewer.radius, 1);
+    }
+}
+
+uint32_t VisibilityGrid::ApplyStamp(PlayerState& state, const glm::ivec2& center, uint32_t radius, int delta) {
+    const std::vector<int32_t>& rows = m_StampRows[radius];
+    int32_t r = static_cast<int32_t>(radius);
+    int32_t firstRow = std::max(center.y - r, 0);
+    int32_t lastRow = std::min(center.y + r, static_cast<int32_t>(m_Height) - 1);
+    uint32_t touched = 0;
+
+    for (int32_t y = firstRow; y <= lastRow; y++) {
+        int32_t halfWidth = rows[y - center.y + r];
+        int32_t x0 = std::max(center.x - halfWidth, 0);
+        int32_t x1 = std::min(center.x + halfWidth, static_cast<int32_t>(m_Width) - 1);
+        if (x0 > x1)
+            continue;
+
+        uint16_t* counts = &state.viewerCount[static_cast<size_t>(y) * m_Width];
+        uint64_t* visible = &state.visible[static_cast<size_t>(y) * m_WordsPerRow];
+        uint64_t* explored = &state.explored[static_cast<size_t>(y) * m_WordsPerRow];
+
+        // El bit de visibilidad es (contador != 0), sin distinguir altas y bajas
+        for (int32_t x = x0; x <= x1; x++) {
+            uint16_t count = static_cast<uint16_t>(counts[x] + delta);
+            counts[x] = count;
+
+            uint64_t mask = 1ull << (x & 63);
+            uint64_t& word = visible[x >> 6];
+            word = (word & ~mask) | (count != 0 ? mask : 0);
+        }
+
+        for (int32_t w = x0 >> 6; w <= (x1 >> 6); w++)
+            explored[w] |= visible[w];
+
+        touched += static_cast<uint32_t>(x1 - x0 + 1);
+    }
+
+    if (firstRow <= lastRow) {
+        state.dirtyFirstRow = std::min(state.dirtyFirstRow, static_cast<uint32_t>(firstRow));
+        state.dirtyLastRow = std::max(state.dirtyLastRow, static_cast<uint32_t>(lastRow));
+    }
+    return touched;
+}
+
+bool VisibilityGrid::IsVisible(uint32_t player, uint32_t x, uint32_t y) const {
+    if (x >= m_Width || y >= m_Height)
+        return false;
+    return (m_Players[player].visible[static_cast<size_t>(y) * m_WordsPerRow + (x >> 6)] >> (x & 63)) & 1;
+}
+
+bool VisibilityGrid::IsExplored(uint32_t player, uint32_t x, uint32_t y) const {
+    if (x >= m_Width || y >= m_Height)
+        return false;
+    return (m_Players[player].explored[static_cast<size_t>(y) * m_WordsPerRow + (x >> 6)] >> (x & 63)) & 1;
+}
+
+bool VisibilityGrid::IsVisibleAt(uint32_t player, const glm::vec2& position) const {
+    glm::ivec2 cell = WorldToCell(position);
+    return cell.x >= 0 && cell.y >= 0 && IsVisible(player, cell.x, cell.y);
+}
+
+bool VisibilityGrid::IsExploredAt(uint32_t player, const glm::vec2& position) const {
+    glm::ivec2 cell = WorldToCell(position);
+    return cell.x >= 0 && cell.y >= 0 && IsExplored(player, cell.x, cell.y);
+}
+
+glm::ivec2 VisibilityGrid::WorldToCell(const glm::vec2& position) const {
+    glm::vec2 local = (position - m_Origin) / m_CellSize;
+    return glm::ivec2(static_cast<int>(std::floor(local.x)), static_cast<int>(std::floor(local.y)));
+}
+
+bool VisibilityGrid::ConsumeDirtyRows(uint32_t player, uint32_t& outFirstRow, uint32_t& outLastRow) {
+    PlayerState& state = m_Players[player];
+    if (state.dirtyFirstRow > state.dirtyLastRow)
+        return false;
+
+    outFirstRow = state.dirtyFirstRow;
+    outLastRow = state.dirtyLastRow;
+    state.dirtyFirstRow = 0xffffffff;
+    state.dirtyLastRow = 0;
+    return true;
+}
+
+uint32_t VisibilityGrid::RadiusToCells(float sightRadius) const {
+    float cells = std::max(sightRadius / m_CellSize, 0.0f);
+    return std::min(static_cast<uint32_t>(cells + 0.5f), MaxSightCells);
+}
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace Destiny {
+
+class JobSystem;
+
+// Niebla de guerra por celdas. Cada jugador tiene dos bitsets empaquetados
+// (visible y explorado, 64 celdas por palabra) y un contador de observadores por
+// celda. Los observadores se estampan con máscaras circulares precalculadas
+// (semiancho de cada fila por radio): al moverse uno se resta su estampa vieja y
+// se suma la nueva, así que Update sólo toca las celdas alrededor de los que
+// cambiaron de celda o de radio, nunca el mapa entero. Los jugadores son
+// independientes y se actualizan en paralelo.
+//
+// Los bitsets son la fuente de verdad para red e IA (IsVisible, GetVisibleBits);
+// FogOfWarOverlay los convierte en una textura R8 para dibujar.
+class VisibilityGrid {
+public:
+    static constexpr uint32_t MaxPlayers = 8;
+    static constexpr uint32_t MaxSightCells = 64;      // Radio máximo de visión en celdas
+    static constexpr uint32_t InvalidViewer = 0xffffffff;
+
+    // La celda (0, 0) empieza en origin y la y de las celdas crece con la del mundo
+    VisibilityGrid(uint32_t width, uint32_t height, float cellSize, const glm::vec2& origin,
+                   uint32_t playerCount, JobSystem* jobSystem = nullptr);
+    ~VisibilityGrid() = default;
+
+    // No permitir copia
+    VisibilityGrid(const VisibilityGrid&) = delete;
+    VisibilityGrid& operator=(const VisibilityGrid&) = delete;
+
+    // Observadores (unidades, edificios...). Los cambios se aplican en Update.
+    uint32_t AddViewer(uint32_t player, const glm::vec2& position, float sightRadius);
+    void MoveViewer(uint32_t viewer, const glm::vec2& position);
+    void SetViewerRadius(uint32_t viewer, float sightRadius);
+    void RemoveViewer(uint32_t viewer);
+
+    void Update();
+
+    // Consultas (válidas desde varios hilos mientras no se llame a Update)
+    bool IsVisible(uint32_t player, uint32_t x, uint32_t y) const;
+    bool IsExplored(uint32_t player, uint32_t x, uint32_t y) const;
+    bool IsVisibleAt(uint32_t player, const glm::vec2& position) const;
+    bool IsExploredAt(uint32_t player, const glm::vec2& position) const;
+    glm::ivec2 WorldToCell(const glm::vec2& position) const;
+
+    // Bitsets crudos: fila y en [y * GetWordsPerRow(), (y + 1) * GetWordsPerRow()), celda x en el bit x % 64
+    const uint64_t* GetVisibleBits(uint32_t player) const { return m_Players[player].visible.data(); }
+    const uint64_t* GetExploredBits(uint32_t player) const { return m_Players[player].explored.data(); }
+    uint32_t GetWordsPerRow() const { return m_WordsPerRow; }
+
+    // Filas cambiadas desde la última llamada para este jugador; false si ninguna
+    bool ConsumeDirtyRows(uint32_t player, uint32_t& outFirstRow, uint32_t& outLastRow);
+
+    // Información
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+    float GetCellSize() const { return m_CellSize; }
+    const glm::vec2& GetOrigin() const { return m_Origin; }
+    uint32_t GetPlayerCount() const { return static_cast<uint32_t>(m_Players.size()); }
+
+    // Estadísticas del último Update
+    struct Stats {
+        float updateMs = 0.0f;
+        uint32_t viewerCount = 0;
+        uint32_t viewersUpdated = 0;
+        uint32_t cellsTouched = 0;
+    };
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    struct Viewer {
+        uint32_t player = 0;
+        glm::ivec2 cell = glm::ivec2(0);         // Estampa aplicada
+        uint32_t radius = 0;
+        glm::ivec2 pendingCell = glm::ivec2(0);  // Estampa que se aplicará en Update
+        uint32_t pendingRadius = 0;
+        bool stamped = false;
+        bool alive = false;
+        bool queued = false;
+    };
+
+    struct PlayerState {
+        std::vector<uint16_t> viewerCount;       // Observadores que ven cada celda
+        std::vector<uint64_t> visible;
+        std::vector<uint64_t> explored;
+        std::vector<uint32_t> queuedViewers;     // Cambios pendientes de este jugador
+        uint32_t dirtyFirstRow = 0xffffffff;
+        uint32_t dirtyLastRow = 0;
+        uint32_t cellsTouched = 0;
+    };
+
+    void QueueViewer(uint32_t viewer);
+    void UpdatePlayer(uint32_t player);
+    uint32_t ApplyStamp(PlayerState& state, const glm::ivec2& center, uint32_t radius, int delta);
+    uint32_t RadiusToCells(float sightRadius) const;
+
+    uint32_t m_Width;
+    uint32_t m_Height;
+    float m_CellSize;
+    glm::vec2 m_Origin;
+    uint32_t m_WordsPerRow;
+    JobSystem* m_JobSystem;
+
+    // m_StampRows[r] = semiancho de cada fila (dy = -r..r) del círculo de radio r
+    std::vector<std::vector<int32_t>> m_StampRows;
+
+    std::vector<PlayerState> m_Players;
+    std::vector<Viewer> m_Viewers;
+    std::vector<uint32_t> m_FreeViewers;
+
+    Stats m_Stats;
+};
+
+} // namespace Destiny
\ No newline at end of file
@@ -0,0 +1,160 @@
+// AssetPacker: genera un paquete .pak a partir de un directorio de assets.
+//
+//   AssetPacker <directorio> <salida.pak> [--lz4]
+//
+// Con --lz4 cada archivo se comprime y se guarda comprimido sólo si ahorra al
+// menos un 10%; los demás se guardan tal cual para poder servirse sin copia.
+
+#include "Assets/AssetPackFormat.h"
+#include "Assets/LZ4.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace fs = std::filesystem;
+using namespace Destiny;
+
+struct PackInput {
+    std::string path;            // Normalizada
+    uint64_t hash = 0;
+    std::vector<uint8_t> stored;
+    uint64_t size = 0;
+    uint32_t flags = PackEntryNone;
+};
+
+static bool ReadWholeFile(const fs::path& path, std::vector<uint8_t>& out) {
+    std::ifstream in(path, std::ios::in | std::ios::binary);
+    if (!in)
+        return false;
+
+    in.seekg(0, std::ios::end);
+    out.resize(static_cast<size_t>(in.tellg()));
+    in.seekg(0, std::ios::beg);
+    in.read(reinterpret_cast<char*>(out.data()), out.size());
+    return static_cast<bool>(in) || out.empty();
+}
+
+static uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        DESTINY_ERROR("Uso: AssetPacker <directorio> <salida.pak> [--lz4]");
+        return 1;
+    }
+
+    fs::path root = argv[1];
+    std::string output = argv[2];
+    bool compress = argc > 3 && std::strcmp(argv[3], "--lz4") == 0;
+
+    if (!fs::is_directory(root)) {
+        DESTINY_ERROR("No es un directorio: {0}", root.string());
+        return 1;
+    }
+
+    // Recoger y, si se pide, comprimir los archivos
+    std::vector<PackInput> inputs;
+    uint64_t totalSize = 0, totalStored = 0;
+
+    for (const auto& item : fs::recursive_directory_iterator(root)) {
+        if (!item.is_regular_file())
+            continue;
+
+        PackInput input;
+        input.path = NormalizeAssetPath(fs::relative(item.path(), root).generic_string());
+        input.hash = HashAssetPath(input.path);
+
+        std::vector<uint8_t> data;
+        if (!ReadWholeFile(item.path(), data)) {
+            DESTINY_ERROR("No se pudo leer {0}", item.path().string());
+            return 1;
+        }
+        input.size = data.size();
+
+        if (compress && !data.empty()) {
+            std::vector<uint8_t> packed(LZ4::CompressBound(data.size()));
+            size_t packedSize = LZ4::Compress(data.data(), data.size(), packed.data(), packed.size());
+            if (packedSize > 0 && packedSize * 10 <= data.size() * 9) {
+                packed.resize(packedSize);
+                input.stored = std::move(packed);
+                input.flags = PackEntryLZ4;
+            }
+        }
+        if (input.flags == PackEntryNone)
+            input.stored = std::move(data);
+
+        totalSize += input.size;
+        totalStored += input.stored.size();
+        inputs.push_back(std::move(input));
+    }
+
+    // Ordenar por hash (y ruta para que la salida sea reproducible)
+    std::sort(inputs.begin(), inputs.end(), [](const PackInput& a, const PackInput& b) {
+        return a.hash != b.hash ? a.hash < b.hash : a.path < b.path;
+    });
+
+    for (size_t i = 1; i < inputs.size(); i++) {
+        if (inputs[i].path == inputs[i - 1].path) {
+            DESTINY_ERROR("Ruta duplicada tras normalizar: {0}", inputs[i].path);
+            return 1;
+        }
+    }
+
+    // Calcular la disposición: cabecera, tabla, strings y blobs alineados
+    PackHeader header = {};
+    std::memcpy(header.magic, PackMagic, sizeof(PackMagic));
+    header.version = PackVersion;
+    header.entryCount = static_cast<uint32_t>(inputs.size());
+    header.tocOffset = sizeof(PackHeader);
+    header.stringTableOffset = header.tocOffset + inputs.size() * sizeof(PackEntry);
+
+    std::string strings;
+    std::vector<PackEntry> entries(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        entries[i].pathHash = inputs[i].hash;
+        entries[i].pathOffset = static_cast<uint32_t>(strings.size());
+        entries[i].pathLength = static_cast<uint32_t>(inputs[i].path.size());
+        strings += inputs[i].path;
+    }
+    header.stringTableSize = static_cast<uint32_t>(strings.size());
+
+    uint64_t offset = AlignUp(header.stringTableOffset + strings.size(), PackDataAlignment);
+    for (size_t i = 0; i < inputs.size(); i++) {
+        entries[i].offset = offset;
+        entries[i].size = inputs[i].size;
+        entries[i].storedSize = inputs[i].stored.size();
+        entries[i].flags = inputs[i].flags;
+        offset = AlignUp(offset + inputs[i].stored.size(), PackDataAlignment);
+    }
+
+    // Escribir
+    std::ofstream out(output, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+        DESTINY_ERROR("No se pudo crear {0}", output);
+        return 1;
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(PackEntry));
+    out.write(strings.data(), strings.size());
+
+    static const char padding[PackDataAlignment] = {};
+    for (size_t i = 0; i < inputs.size(); i++) {
+        uint64_t position = static_cast<uint64_t>(out.tellp());
+        out.write(padding, entries[i].offset - position);
+        out.write(reinterpret_cast<const char*>(inputs[i].stored.data()), inputs[i].stored.size());
+    }
+
+    if (!out) {
+        DESTINY_ERROR("Error al escribir {0}", output);
+        return 1;
+    }
+
+    DESTINY_INFO("{0}: {1} archivos, {2} bytes ({3} almacenados)", output, inputs.size(), totalSize, totalStored);
+    return 0;
+}
\ No newline at end of file
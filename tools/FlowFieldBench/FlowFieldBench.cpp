@@ -0,0 +1,186 @@
+// FlowFieldBench: mide el pathfinding por campos de flujo en mapas de 512x512
+// y 1024x1024.
+//
+//   FlowFieldBench [hilos] [repeticiones]
+//
+// hilos = 0 calcula sin JobSystem; por defecto se usan (núcleos - 1) trabajadores.
+// Para cada tamaño se mide la construcción del grafo de portales, un campo
+// completo (todos los sectores), campos locales para grupos de unidades y la
+// invalidación al colocar edificios. La suma de comprobación de direcciones
+// permite comparar resultados entre compilaciones.
+
+#include "Navigation/FlowField.h"
+#include "Core/JobSystem.h"
+#include "Core/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Destiny;
+
+static constexpr uint32_t GroupCount = 8;
+static constexpr uint32_t GroupSize = 200;
+static constexpr uint32_t BuildingCount = 16;
+
+struct BenchResult {
+    std::vector<float> graphMs;
+    std::vector<float> fullFieldMs;
+    std::vector<float> groupFieldsMs;
+    std::vector<float> invalidateGraphMs;
+    std::vector<float> invalidatePrepareMs;
+    uint32_t portalCount = 0;
+    uint32_t fieldsInvalidated = 0;
+    uint32_t checksum = 0;
+};
+
+static float ElapsedMs(std::chrono::high_resolution_clock::time_point start) {
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+static float Median(std::vector<float> values) {
+    if (values.empty())
+        return 0.0f;
+
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static std::string FormatMs(float ms) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2f ms", ms);
+    return buffer;
+}
+
+// Terreno con zonas de coste alto y edificios; siempre igual para una semilla
+static void GenerateMap(FlowFieldPathfinder& pathfinder, uint32_t size, std::mt19937& rng) {
+    std::uniform_int_distribution<int> position(0, static_cast<int>(size) - 1);
+    std::uniform_int_distribution<int> extent(2, 24);
+    std::uniform_int_distribution<int> cost(2, 8);
+
+    uint32_t patches = size * size / 2048;
+    for (uint32_t i = 0; i < patches; i++) {
+        glm::ivec2 min(position(rng), position(rng));
+        pathfinder.SetCostRect(min, min + glm::ivec2(extent(rng), extent(rng)), static_cast<uint8_t>(cost(rng)));
+    }
+
+    uint32_t buildings = size * size / 1024;
+    for (uint32_t i = 0; i < buildings; i++) {
+        glm::ivec2 min(position(rng), position(rng));
+        pathfinder.SetCostRect(min, min + glm::ivec2(extent(rng) / 2, extent(rng) / 2), FlowFieldPathfinder::Impassable);
+    }
+}
+
+static uint32_t Checksum(const FlowField& field, uint32_t size) {
+    // FNV-1a sobre el índice de dirección de cada celda
+    uint32_t hash = 2166136261u;
+    for (int y = 0; y < static_cast<int>(size); y++) {
+        for (int x = 0; x < static_cast<int>(size); x++) {
+            hash ^= field.GetDirectionIndex(glm::ivec2(x, y));
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+static void RunOnce(uint32_t size, JobSystem* jobSystem, bool computeChecksum, BenchResult& result) {
+    std::mt19937 rng(size);
+    FlowFieldPathfinder pathfinder(size, size, jobSystem);
+    GenerateMap(pathfinder, size, rng);
+
+    // Grafo de portales: lo construye la primera petición
+    glm::ivec2 goal(static_cast<int>(size) / 2, static_cast<int>(size) / 2);
+    pathfinder.SetCostRect(goal - glm::ivec2(1), goal + glm::ivec2(1), 1);
+    auto full = pathfinder.RequestField(goal);
+    result.graphMs.push_back(pathfinder.GetStats().graphBuildMs);
+    result.portalCount = pathfinder.GetStats().portalCount;
+
+    // Campo completo: una celda por sector
+    std::vector<glm::ivec2> sectorCells;
+    for (uint32_t y = 0; y < size; y += FlowFieldPathfinder::SectorSize) {
+        for (uint32_t x = 0; x < size; x += FlowFieldPathfinder::SectorSize)
+            sectorCells.emplace_back(x, y);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    pathfinder.Prepare(*full, sectorCells.data(), static_cast<uint32_t>(sectorCells.size()));
+    result.fullFieldMs.push_back(ElapsedMs(start));
+
+    if (computeChecksum)
+        result.checksum = Checksum(*full, size);
+
+    // Grupos de unidades, cada uno con su destino
+    std::uniform_int_distribution<int> position(0, static_cast<int>(size) - 1);
+    std::normal_distribution<float> spread(0.0f, 24.0f);
+    std::vector<std::shared_ptr<FlowField>> fields;
+    std::vector<std::vector<glm::ivec2>> groups(GroupCount);
+
+    for (uint32_t i = 0; i < GroupCount; i++) {
+        glm::ivec2 groupGoal(position(rng), position(rng));
+        pathfinder.SetCostRect(groupGoal, groupGoal, 1);
+        fields.push_back(pathfinder.RequestField(groupGoal));
+
+        glm::ivec2 center(position(rng), position(rng));
+        for (uint32_t j = 0; j < GroupSize; j++) {
+            glm::ivec2 cell = center + glm::ivec2(static_cast<int>(spread(rng)), static_cast<int>(spread(rng)));
+            groups[i].push_back(glm::clamp(cell, glm::ivec2(0), glm::ivec2(static_cast<int>(size) - 1)));
+        }
+    }
+
+    start = std::chrono::high_resolution_clock::now();
+    for (uint32_t i = 0; i < GroupCount; i++)
+        pathfinder.Prepare(*fields[i], groups[i].data(), GroupSize);
+    result.groupFieldsMs.push_back(ElapsedMs(start));
+
+    // Invalidación: cada edificio reconstruye los portales de su zona y
+    // descarta sólo los campos que pasaban por ella
+    uint32_t invalidatedBefore = pathfinder.GetStats().fieldsInvalidated;
+    std::uniform_int_distribution<int> inner(8, static_cast<int>(size) - 9);
+    for (uint32_t b = 0; b < BuildingCount; b++) {
+        glm::ivec2 min(inner(rng), inner(rng));
+        pathfinder.SetCostRect(min, min + glm::ivec2(3), FlowFieldPathfinder::Impassable);
+
+        // La siguiente petición aplica los cambios pendientes
+        pathfinder.RequestField(fields[0]->GetGoal());
+        result.invalidateGraphMs.push_back(pathfinder.GetStats().graphBuildMs);
+
+        start = std::chrono::high_resolution_clock::now();
+        for (uint32_t i = 0; i < GroupCount; i++)
+            pathfinder.Prepare(*fields[i], groups[i].data(), GroupSize);
+        result.invalidatePrepareMs.push_back(ElapsedMs(start));
+    }
+    result.fieldsInvalidated += pathfinder.GetStats().fieldsInvalidated - invalidatedBefore;
+}
+
+int main(int argc, char** argv) {
+    std::unique_ptr<JobSystem> jobSystem;
+    if (argc < 2 || std::atoi(argv[1]) > 0)
+        jobSystem.reset(new JobSystem(argc < 2 ? 0 : static_cast<uint32_t>(std::atoi(argv[1]))));
+
+    int repetitions = argc < 3 ? 5 : std::max(1, std::atoi(argv[2]));
+    DESTINY_INFO("FlowFieldBench: {0} trabajadores, {1} repeticiones (medianas)",
+                 jobSystem ? jobSystem->GetWorkerCount() : 0, repetitions);
+
+    for (uint32_t size : { 512u, 1024u }) {
+        BenchResult result;
+        for (int r = 0; r < repetitions; r++)
+            RunOnce(size, jobSystem.get(), r == 0, result);
+
+        uint32_t sectors = (size / FlowFieldPathfinder::SectorSize) * (size / FlowFieldPathfinder::SectorSize);
+        DESTINY_INFO("{0}x{1}: {2} sectores, {3} portales, direcciones {4}", size, size, sectors, result.portalCount, result.checksum);
+        DESTINY_INFO("  Grafo de portales:       {0}", FormatMs(Median(result.graphMs)));
+        DESTINY_INFO("  Campo completo:          {0}", FormatMs(Median(result.fullFieldMs)));
+        DESTINY_INFO("  Grupos ({0} x {1}):        {2}", GroupCount, GroupSize, FormatMs(Median(result.groupFieldsMs)));
+        DESTINY_INFO("  Edificio (portales):     {0}", FormatMs(Median(result.invalidateGraphMs)));
+        DESTINY_INFO("  Edificio (recalcular):   {0}", FormatMs(Median(result.invalidatePrepareMs)));
+        DESTINY_INFO("  Campos invalidados:      {0} de {1}", result.fieldsInvalidated / repetitions, GroupCount * BuildingCount);
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+// QuadTransformBench: compara la colocación de esquinas de quads con matrices glm
+// (como hacía Sprite::Draw) frente a las rutas escalar, SSE2 y AVX2 de QuadTransform.
+//
+//   QuadTransformBench [quads] [repeticiones]
+//
+// Por defecto 100000 quads y 21 repeticiones (medianas). Las rutas del kernel deben
+// coincidir bit a bit con la escalar; frente a glm se informa del error máximo,
+// que viene de FastSinCos y del orden de las operaciones.
+
+#include "Math/QuadTransform.h"
+#include "Core/Log.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Destiny;
+
+struct QuadColumns {
+    std::vector<float> positionX, positionY;
+    std::vector<float> sizeX, sizeY;
+    std::vector<float> rotation;
+    std::vector<float> pivotX, pivotY;
+
+    QuadTransformInput GetInput() const {
+        return { positionX.data(), positionY.data(), sizeX.data(), sizeY.data(),
+                 rotation.data(), pivotX.data(), pivotY.data() };
+    }
+};
+
+static float ElapsedMs(std::chrono::high_resolution_clock::time_point start) {
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+static float Median(std::vector<float> values) {
+    if (values.empty())
+        return 0.0f;
+
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2];
+}
+
+static std::string FormatMs(float ms) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.2f ms", ms);
+    return buffer;
+}
+
+// Quads repartidos por un mapa de 4096x4096, con giros en [-pi, pi]
+static void GenerateQuads(QuadColumns& quads, uint32_t count) {
+    std::mt19937 rng(27);
+    std::uniform_real_distribution<float> position(0.0f, 4096.0f);
+    std::uniform_real_distribution<float> size(8.0f, 128.0f);
+    std::uniform_real_distribution<float> angle(-3.14159265f, 3.14159265f);
+    std::uniform_real_distribution<float> pivot(0.0f, 1.0f);
+
+    for (uint32_t i = 0; i < count; i++) {
+        quads.positionX.push_back(position(rng));
+        quads.positionY.push_back(position(rng));
+        quads.sizeX.push_back(size(rng));
+        quads.sizeY.push_back(size(rng));
+        quads.rotation.push_back(angle(rng));
+        quads.pivotX.push_back(pivot(rng));
+        quads.pivotY.push_back(pivot(rng));
+    }
+}
+
+// Referencia: matriz de modelo por quad y 4 esquinas transformadas por ella
+static void ComputeGlm(const QuadColumns& quads, uint32_t count, float* outCorners) {
+    static const glm::vec2 corners[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
+
+    for (uint32_t i = 0; i < count; i++) {
+        glm::vec2 size(quads.sizeX[i], quads.sizeY[i]);
+        glm::vec2 pivot(quads.pivotX[i] * size.x, quads.pivotY[i] * size.y);
+
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(quads.positionX[i] + pivot.x, quads.positionY[i] + pivot.y, 0.0f));
+        model = glm::rotate(model, quads.rotation[i], glm::vec3(0.0f, 0.0f, 1.0f));
+        model = glm::translate(model, glm::vec3(-pivot.x, -pivot.y, 0.0f));
+        model = glm::scale(model, glm::vec3(size.x, size.y, 1.0f));
+
+        for (int v = 0; v < 4; v++) {
+            glm::vec4 corner = model * glm::vec4(corners[v].x, corners[v].y, 0.0f, 1.0f);
+            outCorners[i * 8 + v * 2 + 0] = corner.x;
+            outCorners[i * 8 + v * 2 + 1] = corner.y;
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    uint32_t count = argc < 2 ? 100000u : static_cast<uint32_t>(std::max(1, std::atoi(argv[1])));
+    int repetitions = argc < 3 ? 21 : std::max(1, std::atoi(argv[2]));
+
+    SimdLevel level = QuadTransform::GetSimdLevel();
+    DESTINY_INFO("QuadTransformBench: {0} quads, {1} repeticiones (medianas), CPU: {2}",
+                 count, repetitions, QuadTransform::GetSimdLevelName(level));
+
+    QuadColumns quads;
+    GenerateQuads(quads, count);
+    QuadTransformInput input = quads.GetInput();
+
+    std::vector<float> reference(static_cast<size_t>(count) * 8);
+    std::vector<float> corners(static_cast<size_t>(count) * 8);
+
+    auto measure = [&](auto&& compute) {
+        std::vector<float> times;
+        for (int r = 0; r < repetitions; r++) {
+            auto start = std::chrono::high_resolution_clock::now();
+            compute();
+            times.push_back(ElapsedMs(start));
+        }
+        return Median(times);
+    };
+
+    float glmMs = measure([&] { ComputeGlm(quads, count, corners.data()); });
+    std::vector<float> glmCorners = corners;
+
+    float scalarMs = measure([&] { QuadTransform::ComputeScalar(input, count, reference.data()); });
+
+    float maxError = 0.0f;
+    for (size_t i = 0; i < reference.size(); i++)
+        maxError = std::max(maxError, std::fabs(reference[i] - glmCorners[i]));
+
+    char errorText[32];
+    std::snprintf(errorText, sizeof(errorText), "%.3g", maxError);
+    DESTINY_INFO("  glm (mat4 por quad):  {0}", FormatMs(glmMs));
+    DESTINY_INFO("  Escalar:              {0} (error máximo frente a glm {1})", FormatMs(scalarMs), errorText);
+
+    bool identical = true;
+    float sse2Ms = measure([&] { QuadTransform::ComputeSSE2(input, count, corners.data()); });
+    bool sse2Identical = std::memcmp(corners.data(), reference.data(), reference.size() * sizeof(float)) == 0;
+    identical = identical && sse2Identical;
+    DESTINY_INFO("  SSE2:                 {0} ({1})", FormatMs(sse2Ms), sse2Identical ? "idéntico a escalar" : "DIFIERE de escalar");
+
+    if (level == SimdLevel::AVX2) {
+        float avx2Ms = measure([&] { QuadTransform::ComputeAVX2(input, count, corners.data()); });
+        bool avx2Identical = std::memcmp(corners.data(), reference.data(), reference.size() * sizeof(float)) == 0;
+        identical = identical && avx2Identical;
+        DESTINY_INFO("  AVX2:                 {0} ({1})", FormatMs(avx2Ms), avx2Identical ? "idéntico a escalar" : "DIFIERE de escalar");
+    } else {
+        DESTINY_INFO("  AVX2:                 no disponible en esta CPU");
+    }
+
+    return identical ? 0 : 1;
+}
\ No newline at end of file